@@ -144,11 +144,17 @@ public:
     std::vector<signal> negative_divisors;
     std::vector<signal> next_candidates;
 
+    /* global signatures of the positive divisors and complemented ones of the negative divisors */
+    detail::signature_index positive_signatures;
+    detail::signature_index negative_signatures;
+
     void clear()
     {
       positive_divisors.clear();
       negative_divisors.clear();
       next_candidates.clear();
+      positive_signatures.clear();
+      negative_signatures.clear();
     }
   };
 
@@ -285,10 +291,11 @@ public:
   {
     (void)required;
     auto const tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( auto i = 0u; i < num_divs; ++i )
     {
       auto const d = divs.at( i );
-      if ( tt != sim.get_tt( ntk.make_signal( d ) ) )
+      if ( sig != sim.get_signature( ntk.make_signal( d ) ) || tt != sim.get_tt( ntk.make_signal( d ) ) )
         continue; /* next */
 
       return ( sim.get_phase( d ) ^ sim.get_phase( root ) ) ? !ntk.make_signal( d ) : ntk.make_signal( d );
@@ -302,6 +309,7 @@ public:
     udivs.clear();
 
     auto const& tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( auto i = 0u; i < num_divs; ++i )
     {
       auto const d = divs.at( i );
@@ -309,20 +317,29 @@ public:
       if ( ntk.level( d ) > required - 1 )
         continue;
 
-      auto const& tt_d = sim.get_tt( ntk.make_signal( d ) );
-
-      /* check positive containment */
-      if ( kitty::implies( tt_d, tt ) )
+      /* containment of the truth tables implies containment of the signatures */
+      auto const sig_d = sim.get_signature( ntk.make_signal( d ) );
+      auto const maybe_positive = ( sig_d & ~sig ) == 0u;
+      auto const maybe_negative = ( sig & ~sig_d ) == 0u;
+      if ( maybe_positive || maybe_negative )
       {
-        udivs.positive_divisors.emplace_back( ntk.make_signal( d ) );
-        continue;
-      }
+        auto const& tt_d = sim.get_tt( ntk.make_signal( d ) );
 
-      /* check negative containment */
-      if ( kitty::implies( tt, tt_d ) )
-      {
-        udivs.negative_divisors.emplace_back( ntk.make_signal( d ) );
-        continue;
+        /* check positive containment */
+        if ( maybe_positive && kitty::implies( tt_d, tt ) )
+        {
+          udivs.positive_divisors.emplace_back( ntk.make_signal( d ) );
+          udivs.positive_signatures.push_back( sig_d );
+          continue;
+        }
+
+        /* check negative containment */
+        if ( maybe_negative && kitty::implies( tt, tt_d ) )
+        {
+          udivs.negative_divisors.emplace_back( ntk.make_signal( d ) );
+          udivs.negative_signatures.push_back( ~sig_d );
+          continue;
+        }
       }
 
       udivs.next_candidates.emplace_back( ntk.make_signal( d ) );
@@ -333,49 +350,52 @@ public:
   {
     (void)required;
     auto const& tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
+    std::optional<signal> g;
 
     /* check for positive unate divisors */
+    auto& pos = udivs.positive_signatures;
     for ( auto i = 0u; i < udivs.positive_divisors.size(); ++i )
     {
       auto const& s0 = udivs.positive_divisors.at( i );
+      auto const& tt_s0 = sim.get_tt( s0 );
 
-      for ( auto j = i + 1; j < udivs.positive_divisors.size(); ++j )
-      {
+      /* the second divisor has to cover the bits of the root missing in the first one */
+      pos.foreach_superset( sig & ~pos[i], i + 1, [&]( uint32_t j ) {
         auto const& s1 = udivs.positive_divisors.at( j );
-
-        auto const& tt_s0 = sim.get_tt( s0 );
-        auto const& tt_s1 = sim.get_tt( s1 );
-
-        if ( ( tt_s0 | tt_s1 ) == tt )
-        {
-          ++st.num_div1_or_accepts;
-          auto const l = sim.get_phase( ntk.get_node( s0 ) ) ? !s0 : s0;
-          auto const r = sim.get_phase( ntk.get_node( s1 ) ) ? !s1 : s1;
-          return sim.get_phase( root ) ? !ntk.create_or( l, r ) : ntk.create_or( l, r );
-        }
-      }
+        if ( ( tt_s0 | sim.get_tt( s1 ) ) != tt )
+          return false;
+
+        ++st.num_div1_or_accepts;
+        auto const l = sim.get_phase( ntk.get_node( s0 ) ) ? !s0 : s0;
+        auto const r = sim.get_phase( ntk.get_node( s1 ) ) ? !s1 : s1;
+        g = sim.get_phase( root ) ? !ntk.create_or( l, r ) : ntk.create_or( l, r );
+        return true;
+      } );
+      if ( g )
+        return g;
     }
 
-    /* check for negative unate divisors */
+    /* check for negative unate divisors (their signatures are stored complemented) */
+    auto& neg = udivs.negative_signatures;
     for ( auto i = 0u; i < udivs.negative_divisors.size(); ++i )
     {
       auto const& s0 = udivs.negative_divisors.at( i );
+      auto const& tt_s0 = sim.get_tt( s0 );
 
-      for ( auto j = i + 1; j < udivs.negative_divisors.size(); ++j )
-      {
+      neg.foreach_superset( ~sig & ~neg[i], i + 1, [&]( uint32_t j ) {
         auto const& s1 = udivs.negative_divisors.at( j );
-
-        auto const& tt_s0 = sim.get_tt( s0 );
-        auto const& tt_s1 = sim.get_tt( s1 );
-
-        if ( ( tt_s0 & tt_s1 ) == tt )
-        {
-          ++st.num_div1_and_accepts;
-          auto const l = sim.get_phase( ntk.get_node( s0 ) ) ? !s0 : s0;
-          auto const r = sim.get_phase( ntk.get_node( s1 ) ) ? !s1 : s1;
-          return sim.get_phase( root ) ? !ntk.create_and( l, r ) : ntk.create_and( l, r );
-        }
-      }
+        if ( ( tt_s0 & sim.get_tt( s1 ) ) != tt )
+          return false;
+
+        ++st.num_div1_and_accepts;
+        auto const l = sim.get_phase( ntk.get_node( s0 ) ) ? !s0 : s0;
+        auto const r = sim.get_phase( ntk.get_node( s1 ) ) ? !s1 : s1;
+        g = sim.get_phase( root ) ? !ntk.create_and( l, r ) : ntk.create_and( l, r );
+        return true;
+      } );
+      if ( g )
+        return g;
     }
 
     return std::nullopt;
@@ -386,8 +406,42 @@ public:
     (void)required;
     auto const s = ntk.make_signal( root );
     auto const& tt = sim.get_tt( s );
+    auto const sig = sim.get_signature( s );
+    std::optional<signal> g;
+
+    /* orders the three divisors by level, the one with the highest level is used last */
+    auto const order_by_level = [&]( signal const& s0, signal const& s1, signal const& s2 ) {
+      auto const max_level = std::max({
+          ntk.level( ntk.get_node( s0 ) ),
+          ntk.level( ntk.get_node( s1 ) ),
+          ntk.level( ntk.get_node( s2 ) )
+        });
+      assert( max_level <= required - 1 );
+
+      signal max = s0;
+      signal min0 = s1;
+      signal min1 = s2;
+      if ( ntk.level( ntk.get_node( s1 ) ) == max_level )
+      {
+        max = s1;
+        min0 = s0;
+        min1 = s2;
+      }
+      else if ( ntk.level( ntk.get_node( s2 ) ) == max_level )
+      {
+        max = s2;
+        min0 = s0;
+        min1 = s1;
+      }
+
+      auto const a = sim.get_phase( ntk.get_node( max  ) ) ? !max  : max;
+      auto const b = sim.get_phase( ntk.get_node( min0 ) ) ? !min0 : min0;
+      auto const c = sim.get_phase( ntk.get_node( min1 ) ) ? !min1 : min1;
+      return std::array<signal, 3>{a, b, c};
+    };
 
     /* check positive unate divisors */
+    auto& pos = udivs.positive_signatures;
     for ( auto i = 0u; i < udivs.positive_divisors.size(); ++i )
     {
       auto const s0 = udivs.positive_divisors.at( i );
@@ -396,100 +450,56 @@ public:
       {
         auto const s1 = udivs.positive_divisors.at( j );
 
-        for ( auto k = j + 1; k < udivs.positive_divisors.size(); ++k )
-        {
+        pos.foreach_superset( sig & ~( pos[i] | pos[j] ), j + 1, [&]( uint32_t k ) {
           auto const s2 = udivs.positive_divisors.at( k );
 
           auto const& tt_s0 = sim.get_tt( s0 );
           auto const& tt_s1 = sim.get_tt( s1 );
           auto const& tt_s2 = sim.get_tt( s2 );
 
-          if ( ( tt_s0 | tt_s1 | tt_s2 ) == tt )
-          {
-            auto const max_level = std::max({
-                ntk.level( ntk.get_node( s0 ) ),
-                ntk.level( ntk.get_node( s1 ) ),
-                ntk.level( ntk.get_node( s2 ) )
-              });
-            assert( max_level <= required - 1 );
-
-            signal max = s0;
-            signal min0 = s1;
-            signal min1 = s2;
-            if ( ntk.level( ntk.get_node( s1 ) ) == max_level )
-            {
-              max = s1;
-              min0 = s0;
-              min1 = s2;
-            }
-            else if ( ntk.level( ntk.get_node( s2 ) ) == max_level )
-            {
-              max = s2;
-              min0 = s0;
-              min1 = s1;
-            }
-
-            auto const a = sim.get_phase( ntk.get_node( max  ) ) ? !max  : max;
-            auto const b = sim.get_phase( ntk.get_node( min0 ) ) ? !min0 : min0;
-            auto const c = sim.get_phase( ntk.get_node( min1 ) ) ? !min1 : min1;
-
-            ++st.num_div12_2or_accepts;
-            return sim.get_phase( root ) ? !ntk.create_or( a, ntk.create_or( b, c ) ) : ntk.create_or( a, ntk.create_or( b, c ) );
-          }
-        }
+          if ( ( tt_s0 | tt_s1 | tt_s2 ) != tt )
+            return false;
+
+          auto const [a, b, c] = order_by_level( s0, s1, s2 );
+          ++st.num_div12_2or_accepts;
+          g = sim.get_phase( root ) ? !ntk.create_or( a, ntk.create_or( b, c ) ) : ntk.create_or( a, ntk.create_or( b, c ) );
+          return true;
+        } );
+        if ( g )
+          return g;
       }
     }
 
-    /* check negative unate divisors */
+    /* check negative unate divisors (each divisor of the AND must contain the root's signature) */
     for ( auto i = 0u; i < udivs.positive_divisors.size(); ++i )
     {
       auto const s0 = udivs.positive_divisors.at( i );
+      if ( ( pos[i] & sig ) != sig )
+        continue;
 
       for ( auto j = i + 1; j < udivs.positive_divisors.size(); ++j )
       {
         auto const s1 = udivs.positive_divisors.at( j );
+        if ( ( pos[j] & sig ) != sig )
+          continue;
 
-        for ( auto k = j + 1; k < udivs.positive_divisors.size(); ++k )
-        {
+        pos.foreach_superset( sig, j + 1, [&]( uint32_t k ) {
           auto const s2 = udivs.positive_divisors.at( k );
 
           auto const& tt_s0 = sim.get_tt( s0 );
           auto const& tt_s1 = sim.get_tt( s1 );
           auto const& tt_s2 = sim.get_tt( s2 );
 
-          if ( ( tt_s0 & tt_s1 & tt_s2 ) == tt )
-          {
-            auto const max_level = std::max({
-                ntk.level( ntk.get_node( s0 ) ),
-                ntk.level( ntk.get_node( s1 ) ),
-                ntk.level( ntk.get_node( s2 ) )
-              });
-            assert( max_level <= required - 1 );
-
-            signal max = s0;
-            signal min0 = s1;
-            signal min1 = s2;
-            if ( ntk.level( ntk.get_node( s1 ) ) == max_level )
-            {
-              max = s1;
-              min0 = s0;
-              min1 = s2;
-            }
-            else if ( ntk.level( ntk.get_node( s2 ) ) == max_level )
-            {
-              max = s2;
-              min0 = s0;
-              min1 = s1;
-            }
-
-            auto const a = sim.get_phase( ntk.get_node( max  ) ) ? !max  : max;
-            auto const b = sim.get_phase( ntk.get_node( min0 ) ) ? !min0 : min0;
-            auto const c = sim.get_phase( ntk.get_node( min1 ) ) ? !min1 : min1;
-
-            ++st.num_div12_2and_accepts;
-            return sim.get_phase( root ) ? !ntk.create_and( a, ntk.create_and( b, c ) ) : ntk.create_and( a, ntk.create_and( b, c ) );
-          }
-        }
+          if ( ( tt_s0 & tt_s1 & tt_s2 ) != tt )
+            return false;
+
+          auto const [a, b, c] = order_by_level( s0, s1, s2 );
+          ++st.num_div12_2and_accepts;
+          g = sim.get_phase( root ) ? !ntk.create_and( a, ntk.create_and( b, c ) ) : ntk.create_and( a, ntk.create_and( b, c ) );
+          return true;
+        } );
+        if ( g )
+          return g;
       }
     }
 
@@ -501,41 +511,46 @@ public:
     bdivs.clear();
 
     auto const& tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( auto i = 0u; i < udivs.next_candidates.size(); ++i )
     {
       auto const& s0 = udivs.next_candidates.at( i );
       if ( ntk.level( ntk.get_node( s0 ) ) > required - 2 )
         continue;
 
+      auto const sig0 = sim.get_signature( s0 );
+
       for ( auto j = i + 1; j < udivs.next_candidates.size(); ++j )
       {
         auto const& s1 = udivs.next_candidates.at( j );
         if ( ntk.level( ntk.get_node( s1 ) ) > required - 2 )
           continue;
 
+        auto const sig1 = sim.get_signature( s1 );
+
         if ( bdivs.positive_divisors0.size() < 500 ) // ps.max_divisors2
         {
           auto const& tt_s0 = sim.get_tt( s0 );
           auto const& tt_s1 = sim.get_tt( s1 );
-          if ( kitty::implies( tt_s0 & tt_s1, tt ) )
+          if ( ( sig0 & sig1 & ~sig ) == 0u && kitty::implies( tt_s0 & tt_s1, tt ) )
           {
             bdivs.positive_divisors0.emplace_back(  s0 );
             bdivs.positive_divisors1.emplace_back(  s1 );
           }
 
-          if ( kitty::implies( ~tt_s0 & tt_s1, tt ) )
+          if ( ( ~sig0 & sig1 & ~sig ) == 0u && kitty::implies( ~tt_s0 & tt_s1, tt ) )
           {
             bdivs.positive_divisors0.emplace_back( !s0 );
             bdivs.positive_divisors1.emplace_back(  s1 );
           }
 
-          if ( kitty::implies( tt_s0 & ~tt_s1, tt ) )
+          if ( ( sig0 & ~sig1 & ~sig ) == 0u && kitty::implies( tt_s0 & ~tt_s1, tt ) )
           {
             bdivs.positive_divisors0.emplace_back(  s0 );
             bdivs.positive_divisors1.emplace_back( !s1 );
           }
 
-          if ( kitty::implies( ~tt_s0 & ~tt_s1, tt ) )
+          if ( ( ~sig0 & ~sig1 & ~sig ) == 0u && kitty::implies( ~tt_s0 & ~tt_s1, tt ) )
           {
             bdivs.positive_divisors0.emplace_back( !s0 );
             bdivs.positive_divisors1.emplace_back( !s1 );
@@ -546,25 +561,25 @@ public:
         {
           auto const& tt_s0 = sim.get_tt( s0 );
           auto const& tt_s1 = sim.get_tt( s1 );
-          if ( kitty::implies( tt, tt_s0 & tt_s1 ) )
+          if ( ( sig & ~( sig0 & sig1 ) ) == 0u && kitty::implies( tt, tt_s0 & tt_s1 ) )
           {
             bdivs.negative_divisors0.emplace_back(  s0 );
             bdivs.negative_divisors1.emplace_back(  s1 );
           }
 
-          if ( kitty::implies( tt, ~tt_s0 & tt_s1 ) )
+          if ( ( sig & ~( ~sig0 & sig1 ) ) == 0u && kitty::implies( tt, ~tt_s0 & tt_s1 ) )
           {
             bdivs.negative_divisors0.emplace_back( !s0 );
             bdivs.negative_divisors1.emplace_back(  s1 );
           }
 
-          if ( kitty::implies( tt, tt_s0 & ~tt_s1 ) )
+          if ( ( sig & ~( sig0 & ~sig1 ) ) == 0u && kitty::implies( tt, tt_s0 & ~tt_s1 ) )
           {
             bdivs.negative_divisors0.emplace_back(  s0 );
             bdivs.negative_divisors1.emplace_back( !s1 );
           }
 
-          if ( kitty::implies( tt, ~tt_s0 & ~tt_s1 ) )
+          if ( ( sig & ~( ~sig0 & ~sig1 ) ) == 0u && kitty::implies( tt, ~tt_s0 & ~tt_s1 ) )
           {
             bdivs.negative_divisors0.emplace_back( !s0 );
             bdivs.negative_divisors1.emplace_back( !s1 );
@@ -579,17 +594,22 @@ public:
     (void)required;
     auto const s = ntk.make_signal( root );
     auto const& tt = sim.get_tt( s );
+    auto const sig = sim.get_signature( s );
 
     /* check positive unate divisors */
     for ( const auto& s0 : udivs.positive_divisors )
     {
       auto const& tt_s0 = sim.get_tt( s0 );
+      auto const sig0 = sim.get_signature( s0 );
 
       for ( auto j = 0u; j < bdivs.positive_divisors0.size(); ++j )
       {
         auto const s1 = bdivs.positive_divisors0.at( j );
         auto const s2 = bdivs.positive_divisors1.at( j );
 
+        if ( ( sig0 | ( sim.get_signature( s1 ) & sim.get_signature( s2 ) ) ) != sig )
+          continue;
+
         auto const& tt_s1 = sim.get_tt( s1 );
         auto const& tt_s2 = sim.get_tt( s2 );
 
@@ -611,12 +631,16 @@ public:
     for ( const auto& s0 : udivs.negative_divisors )
     {
       auto const& tt_s0 = sim.get_tt( s0 );
+      auto const sig0 = sim.get_signature( s0 );
 
       for ( auto j = 0u; j < bdivs.negative_divisors0.size(); ++j )
       {
         auto const s1 = bdivs.negative_divisors0.at( j );
         auto const s2 = bdivs.negative_divisors1.at( j );
 
+        if ( ( sig0 | ( sim.get_signature( s1 ) & sim.get_signature( s2 ) ) ) != sig )
+          continue;
+
         auto const& tt_s1 = sim.get_tt( s1 );
         auto const& tt_s2 = sim.get_tt( s2 );
 
@@ -643,17 +667,26 @@ public:
 
     auto const s = ntk.make_signal( root );
     auto const& tt = sim.get_tt( s );
+    auto const sig = sim.get_signature( s );
 
     for ( auto i = 0u; i < bdivs.positive_divisors0.size(); ++i )
     {
       auto const s0 = bdivs.positive_divisors0.at( i );
       auto const s1 = bdivs.positive_divisors1.at( i );
+      auto const sig01 = sim.get_signature( s0 ) | sim.get_signature( s1 );
+
+      /* both ORs have to contain the root's signature */
+      if ( ( sig01 & sig ) != sig )
+        continue;
 
       for ( auto j = i + 1; j < bdivs.positive_divisors0.size(); ++j )
       {
         auto const s2 = bdivs.positive_divisors0.at( j );
         auto const s3 = bdivs.positive_divisors1.at( j );
 
+        if ( ( sig01 & ( sim.get_signature( s2 ) | sim.get_signature( s3 ) ) ) != sig )
+          continue;
+
         auto const& tt_s0 = sim.get_tt( s0 );
         auto const& tt_s1 = sim.get_tt( s1 );
         auto const& tt_s2 = sim.get_tt( s2 );
@@ -678,12 +711,20 @@ public:
     {
       auto const s0 = bdivs.negative_divisors0.at( i );
       auto const s1 = bdivs.negative_divisors1.at( i );
+      auto const sig01 = sim.get_signature( s0 ) & sim.get_signature( s1 );
+
+      /* both ANDs have to be contained in the root's signature */
+      if ( ( sig01 & ~sig ) != 0u )
+        continue;
 
       for ( auto j = i + 1; j < bdivs.negative_divisors0.size(); ++j )
       {
         auto const s2 = bdivs.negative_divisors0.at( j );
         auto const s3 = bdivs.negative_divisors1.at( j );
 
+        if ( ( sig01 | ( sim.get_signature( s2 ) & sim.get_signature( s3 ) ) ) != sig )
+          continue;
+
         auto const& tt_s0 = sim.get_tt( s0 );
         auto const& tt_s1 = sim.get_tt( s1 );
         auto const& tt_s2 = sim.get_tt( s2 );
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <iostream>
+#include <limits>
 #include <type_traits>
 #include <vector>
 
@@ -381,4 +382,194 @@ Ntk cleanup_luts( Ntk const& ntk )
   return dest;
 }
 
+/*! \brief Parameters for compact_network. */
+struct compact_network_params
+{
+  /*! \brief Remove gates that do not lead to any output. */
+  bool remove_dangling{true};
+
+  /*! \brief Release the unused capacity of the node array. */
+  bool shrink_to_fit{false};
+};
+
+/*! \brief Compacts a network in-place.
+ *
+ * Removes dead nodes, and dangling nodes if `remove_dangling` is set, by
+ * moving the remaining nodes to the front of the node array.  The relative
+ * order of the nodes does not change, such that the structural hashing keys
+ * remain canonical.  In contrast to `cleanup_dangling`, no second network is
+ * created; only a remapping table of one entry per node is allocated.
+ * Fanout sizes and the structural hashing table are rebuilt, and primary
+ * inputs, outputs, and registers keep their positions.
+ *
+ * The returned table maps each old node index to its new index, or to
+ * `std::numeric_limits<node<Ntk>>::max()` if the node was removed.  It can
+ * be passed to `compact_node_map` to update node maps.  Views, node maps,
+ * and signals that refer to the network before compaction are invalid
+ * afterwards.
+ *
+   \verbatim embed:rst
+
+   .. note::
+
+      In contrast to ``cleanup_dangling``, this method does not reorder nodes
+      topologically.
+   \endverbatim
+ *
+ * **Required network functions:**
+ * - `size`
+ * - `is_dead`
+ *
+ * \param ntk Network (will be modified)
+ * \param ps Parameters
+ */
+template<typename Ntk>
+std::vector<node<Ntk>> compact_network( Ntk& ntk, compact_network_params const& ps = {} )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+  static_assert( has_is_dead_v<Ntk>, "Ntk does not implement the is_dead method" );
+
+  constexpr auto removed = std::numeric_limits<node<Ntk>>::max();
+
+  auto& storage = *ntk._storage;
+  auto& nodes = storage.nodes;
+  const auto size = nodes.size();
+
+  /* mark nodes to keep, CIs and the constant are always kept */
+  std::vector<node<Ntk>> remap( size, removed );
+  std::vector<bool> is_ci( size, false );
+  remap[0] = 0;
+  for ( auto const& n : storage.inputs )
+  {
+    remap[n] = 0;
+    is_ci[n] = true;
+  }
+
+  if ( ps.remove_dangling )
+  {
+    std::vector<node<Ntk>> stack;
+    for ( auto const& f : storage.outputs )
+    {
+      stack.push_back( f.index );
+    }
+    while ( !stack.empty() )
+    {
+      const auto n = stack.back();
+      stack.pop_back();
+      if ( remap[n] != removed )
+      {
+        continue;
+      }
+      remap[n] = 1;
+      for ( auto const& c : nodes[n].children )
+      {
+        stack.push_back( c.index );
+      }
+    }
+  }
+  else
+  {
+    for ( auto n = 1u; n < size; ++n )
+    {
+      if ( !is_ci[n] && !ntk.is_dead( n ) )
+      {
+        remap[n] = 1;
+      }
+    }
+  }
+
+  /* move nodes to the front, new indexes are never larger than old ones */
+  node<Ntk> next = 0;
+  for ( auto n = 0u; n < size; ++n )
+  {
+    if ( remap[n] == removed )
+    {
+      continue;
+    }
+    remap[n] = next;
+    if ( next != n )
+    {
+      nodes[next] = std::move( nodes[n] );
+    }
+    ++next;
+  }
+  nodes.resize( next );
+  if ( ps.shrink_to_fit )
+  {
+    nodes.shrink_to_fit();
+  }
+  is_ci.assign( next, false );
+
+  for ( auto& n : storage.inputs )
+  {
+    n = remap[n];
+    is_ci[n] = true;
+  }
+
+  /* rebuild fanout sizes and structural hashing */
+  for ( auto& n : nodes )
+  {
+    n.data[0].h1 = 0;
+  }
+  storage.hash.clear();
+  for ( auto n = 1u; n < next; ++n )
+  {
+    if ( is_ci[n] )
+    {
+      continue;
+    }
+    for ( auto& c : nodes[n].children )
+    {
+      c.index = remap[c.index];
+      nodes[c.index].data[0].h1++;
+    }
+    storage.hash[nodes[n]] = n;
+  }
+  for ( auto& f : storage.outputs )
+  {
+    f.index = remap[f.index];
+    nodes[f.index].data[0].h1++;
+  }
+
+  if ( !storage.latch_information.empty() )
+  {
+    decltype( storage.latch_information ) latch_information;
+    for ( auto const& [n, info] : storage.latch_information )
+    {
+      if ( n < size && remap[n] != removed )
+      {
+        latch_information[remap[n]] = info;
+      }
+    }
+    storage.latch_information = std::move( latch_information );
+  }
+
+  return remap;
+}
+
+/*! \brief Moves the values of a node map after compaction.
+ *
+ * Returns a node map for the compacted network `ntk`, in which each value of
+ * `map` is stored at the new index of its node.  Values of removed nodes are
+ * dropped.
+ *
+ * \param ntk Compacted network
+ * \param map Node map of the network before compaction
+ * \param remap Table returned by `compact_network`
+ */
+template<typename T, typename Ntk>
+node_map<T, Ntk> compact_node_map( Ntk const& ntk, node_map<T, Ntk> const& map, std::vector<node<Ntk>> const& remap )
+{
+  node_map<T, Ntk> compacted( ntk );
+  for ( auto n = 0u; n < remap.size(); ++n )
+  {
+    if ( remap[n] != std::numeric_limits<node<Ntk>>::max() )
+    {
+      compacted[remap[n]] = map[n];
+    }
+  }
+  return compacted;
+}
+
 } // namespace mockturtle
@@ -32,12 +32,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <set>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "../networks/klut.hpp"
@@ -81,6 +86,13 @@ struct cut_rewriting_params
   /*! \brief Use don't cares for optimization. */
   bool use_dont_cares{false};
 
+  /*! \brief Parameters for the don't-care computation (with `use_dont_cares`).
+   *
+   * Since the selected candidates are substituted together, only
+   * satisfiability don't cares are used and `max_tfo_levels` is ignored.
+   */
+  windowed_dont_cares_params dont_cares_ps{};
+
   /*! \brief Candidate selection strategy. */
   enum
   {
@@ -94,6 +106,22 @@ struct cut_rewriting_params
   /*! \brief Minimum candidate cut size override (in conflict graph) */
   std::optional<uint32_t> min_cand_cut_size_override{};
 
+  /*! \brief Number of threads for candidate evaluation.
+   *
+   * If larger than 1, nodes are partitioned among worker threads that build
+   * their candidates in private scratch networks.  Only the candidates that
+   * are selected in the independent set are copied into the network.  Each
+   * worker calls its own copy of the rewriting function, which must be
+   * copy-constructible, and state that copies share (e.g., a cache) must be
+   * safe to access concurrently.  Candidate
+   * gains are estimated without structural sharing with the network, and
+   * don't cares are not used in this mode.
+   */
+  uint32_t num_threads{1u};
+
+  /*! \brief Number of nodes a worker thread evaluates at a time. */
+  uint32_t partition_size{1024u};
+
   /*! \brief Show progress. */
   bool progress{false};
 
@@ -123,12 +151,24 @@ struct cut_rewriting_stats
   /*! \brief Runtime to find minimal independent set. */
   stopwatch<>::duration time_mis{0};
 
+  /*! \brief Runtime to copy selected candidates into the network (parallel mode). */
+  stopwatch<>::duration time_commit{0};
+
+  /*! \brief Runtime to presynthesize cut functions in a batch. */
+  stopwatch<>::duration time_presynthesis{0};
+
+  /*! \brief Statistics of the don't-care computation. */
+  windowed_dont_cares_stats dont_cares_st;
+
   void report() const
   {
     std::cout << fmt::format( "[i] total time     = {:>5.2f} secs\n", to_seconds( time_total ) );
     std::cout << fmt::format( "[i] cut enum. time = {:>5.2f} secs\n", to_seconds( time_cuts ) );
     std::cout << fmt::format( "[i] rewriting time = {:>5.2f} secs\n", to_seconds( time_rewriting ) );
     std::cout << fmt::format( "[i] ind. set time  = {:>5.2f} secs\n", to_seconds( time_mis ) );
+    std::cout << fmt::format( "[i] commit time    = {:>5.2f} secs\n", to_seconds( time_commit ) );
+    std::cout << fmt::format( "[i] presynth. time = {:>5.2f} secs\n", to_seconds( time_presynthesis ) );
+    std::cout << fmt::format( "[i] don't cares    = {:>5.2f} secs\n", to_seconds( dont_cares_st.time_total ) );
   }
 };
 
@@ -279,7 +319,7 @@ struct cut_enumeration_cut_rewriting_cut
 };
 
 template<typename Ntk, bool ComputeTruth>
-std::tuple<graph, std::vector<std::pair<node<Ntk>, uint32_t>>> network_cuts_graph( Ntk const& ntk, network_cuts<Ntk, ComputeTruth, cut_enumeration_cut_rewriting_cut> const& cuts, cut_rewriting_params const& ps )
+std::tuple<graph, std::vector<std::pair<node<Ntk>, uint32_t>>> network_cuts_graph( Ntk const& ntk, network_cuts<Ntk, ComputeTruth, cut_enumeration_cut_rewriting_cut> const& cuts, mffc_engine<Ntk> const& mffcs, cut_rewriting_params const& ps )
 {
   static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
   static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
@@ -299,7 +339,7 @@ std::tuple<graph, std::vector<std::pair<node<Ntk>, uint32_t>>> network_cuts_grap
     if ( index >= cuts.nodes_size() || ntk.is_constant( n ) || ntk.is_pi( n ) )
       return;
 
-    if ( mffc_size( ntk, n ) == 1 )
+    if ( mffcs.mffc_size( n ) == 1 )
       return;
 
     const auto& set = cuts.cuts( ntk.node_to_index( n ) );
@@ -379,6 +419,41 @@ struct has_rewrite_with_dont_cares<Ntk,
 template<class Ntk, class RewritingFn, class Iterator>
 inline constexpr bool has_rewrite_with_dont_cares_v = has_rewrite_with_dont_cares<Ntk, RewritingFn, Iterator>::value;
 
+template<class RewritingFn, class = void>
+struct has_presynthesize : std::false_type
+{
+};
+
+template<class RewritingFn>
+struct has_presynthesize<RewritingFn,
+                         std::void_t<decltype( std::declval<RewritingFn>().presynthesize( std::declval<std::vector<kitty::dynamic_truth_table> const&>(),
+                                                                                          std::declval<uint32_t>() ) )>> : std::true_type
+{
+};
+
+template<class RewritingFn>
+inline constexpr bool has_presynthesize_v = has_presynthesize<RewritingFn>::value;
+
+template<class Ntk, class RewritingFn, class NodeCostFn, class = void>
+struct supports_parallel_rewriting : std::false_type
+{
+};
+
+template<class Ntk, class RewritingFn, class NodeCostFn>
+struct supports_parallel_rewriting<Ntk,
+                                   RewritingFn, NodeCostFn,
+                                   std::void_t<decltype( std::declval<RewritingFn>()( std::declval<typename Ntk::base_type&>(),
+                                                                                      std::declval<kitty::dynamic_truth_table>(),
+                                                                                      std::declval<typename std::vector<signal<typename Ntk::base_type>>::iterator const&>(),
+                                                                                      std::declval<typename std::vector<signal<typename Ntk::base_type>>::iterator const&>(),
+                                                                                      std::declval<void( signal<typename Ntk::base_type> )>() ) ),
+                                               decltype( std::declval<NodeCostFn const&>()( std::declval<typename Ntk::base_type const&>(), std::declval<node<typename Ntk::base_type> const&>() ) )>> : std::true_type
+{
+};
+
+template<class Ntk, class RewritingFn, class NodeCostFn>
+inline constexpr bool supports_parallel_rewriting_v = std::is_copy_constructible_v<std::decay_t<RewritingFn>> && supports_parallel_rewriting<Ntk, RewritingFn, NodeCostFn>::value;
+
 template<class Ntk>
 struct unit_cost
 {
@@ -399,7 +474,8 @@ public:
         rewriting_fn( rewriting_fn ),
         ps( ps ),
         st( st ),
-        cost_fn( cost_fn ) {}
+        cost_fn( cost_fn ),
+        mffcs( ntk ) {}
 
   void run()
   {
@@ -414,9 +490,64 @@ public:
       ntk.set_value( n, ntk.fanout_size( n ) );
     } );
 
+    /* MFFC sizes of all original nodes, they do not change while evaluating
+       since new nodes are dereferenced again */
+    mffcs.compute_all();
+
+    /* let the rewriting function process all cut functions in a batch */
+    if constexpr ( has_presynthesize_v<RewritingFn> )
+    {
+      presynthesize( cuts );
+    }
+
     /* store best replacement for each cut */
     node_map<std::vector<signal<Ntk>>, Ntk> best_replacements( ntk );
 
+    if constexpr ( supports_parallel_rewriting_v<Ntk, RewritingFn, NodeCostFn> )
+    {
+      if ( ps.num_threads > 1u && !ps.use_dont_cares )
+      {
+        evaluate_parallel( cuts );
+        select_and_substitute( cuts, best_replacements );
+        return;
+      }
+    }
+
+    evaluate( cuts, best_replacements );
+    select_and_substitute( cuts, best_replacements );
+  }
+
+private:
+  template<class Cuts>
+  void presynthesize( Cuts const& cuts )
+  {
+    stopwatch t( st.time_presynthesis );
+
+    std::vector<kitty::dynamic_truth_table> functions;
+    ntk.foreach_gate( [&]( auto const& n ) {
+      for ( auto& cut : cuts.cuts( ntk.node_to_index( n ) ) )
+      {
+        if ( cut->size() >= ps.min_cand_cut_size )
+        {
+          functions.push_back( cuts.truth_table( *cut ) );
+        }
+      }
+    } );
+
+    std::sort( functions.begin(), functions.end() );
+    functions.erase( std::unique( functions.begin(), functions.end() ), functions.end() );
+    rewriting_fn.presynthesize( functions, ps.num_threads );
+  }
+
+  template<class Cuts>
+  void evaluate( Cuts const& cuts, node_map<std::vector<signal<Ntk>>, Ntk>& best_replacements )
+  {
+    std::optional<windowed_dont_cares<Ntk>> dont_cares;
+    if ( ps.use_dont_cares )
+    {
+      dont_cares.emplace( ntk, ps.dont_cares_ps, st.dont_cares_st );
+    }
+
     /* iterate over all original nodes in the network */
     const auto size = ntk.size();
     auto max_total_gain = 0u;
@@ -431,7 +562,7 @@ public:
         return true;
 
       /* skip cuts with small MFFC */
-      if ( mffc_size( ntk, n ) == 1 )
+      if ( mffcs.mffc_size( n ) == 1 )
         return true;
 
       /* foreach cut */
@@ -489,7 +620,7 @@ public:
               {
                 pivots.push_back( ntk.get_node( c ) );
               }
-              rewriting_fn( ntk, cuts.truth_table( *cut ), satisfiability_dont_cares( ntk, pivots ), children.begin(), children.end(), on_signal );
+              rewriting_fn( ntk, cuts.truth_table( *cut ), ~dont_cares->care( pivots ), children.begin(), children.end(), on_signal );
             }
             else
             {
@@ -512,9 +643,13 @@ public:
 
       return true;
     } );
+  }
 
+  template<class Cuts>
+  void select_and_substitute( Cuts const& cuts, node_map<std::vector<signal<Ntk>>, Ntk>& best_replacements )
+  {
     stopwatch t2( st.time_mis );
-    auto [g, map] = network_cuts_graph( ntk, cuts, ps );
+    auto [g, map] = network_cuts_graph( ntk, cuts, mffcs, ps );
 
     if ( ps.very_verbose )
     {
@@ -528,6 +663,12 @@ public:
       std::cout << "[i] size of independent set is " << is.size() << "\n";
     }
 
+    if ( !_workers.empty() )
+    {
+      stopwatch t3( st.time_commit );
+      commit_candidates( is, map, best_replacements );
+    }
+
     for ( const auto v : is )
     {
       const auto v_node = map[v].first;
@@ -555,7 +696,264 @@ public:
     }
   }
 
-private:
+  using scratch_ntk_t = typename Ntk::base_type;
+
+  /* candidate of a worker thread, built in its scratch network */
+  struct scratch_candidate
+  {
+    uint32_t worker;
+    signal<scratch_ntk_t> f;
+  };
+
+  /* worker thread state: a scratch network whose PIs stand for cut leaves
+   * in `ntk`, private reference counters, and a buffer of candidates */
+  struct rewriting_worker
+  {
+    scratch_ntk_t scratch;
+    std::unordered_map<node<Ntk>, signal<scratch_ntk_t>> leaf_to_pi;
+    std::unordered_map<node<scratch_ntk_t>, node<Ntk>> pi_to_leaf;
+    std::vector<uint32_t> refs;
+    std::vector<std::pair<node<Ntk>, signal<scratch_ntk_t>>> candidates;
+    stopwatch<>::duration time_rewriting{0};
+    std::optional<std::decay_t<RewritingFn>> rewriting_fn;
+  };
+
+  template<class Cuts>
+  void evaluate_parallel( Cuts const& cuts )
+  {
+    const auto size = ntk.size();
+    const auto num_partitions = ( size + ps.partition_size - 1 ) / ps.partition_size;
+
+    std::vector<uint32_t> refs( size );
+    ntk.foreach_node( [&]( auto const& n ) {
+      refs[ntk.node_to_index( n )] = ntk.value( n );
+    } );
+
+    _workers.resize( ps.num_threads );
+    for ( auto& w : _workers )
+    {
+      w.refs = refs;
+      w.rewriting_fn.emplace( rewriting_fn );
+    }
+
+    std::atomic<uint32_t> next_partition{0u};
+    std::vector<std::thread> threads;
+    for ( auto i = 0u; i < ps.num_threads; ++i )
+    {
+      threads.emplace_back( [&, i]() {
+        auto& w = _workers[i];
+        while ( true )
+        {
+          const auto p = next_partition++;
+          if ( p >= num_partitions )
+            break;
+
+          const auto last = std::min<uint32_t>( size, ( p + 1 ) * ps.partition_size );
+          for ( auto index = p * ps.partition_size; index < last; ++index )
+          {
+            evaluate_node( w, cuts, ntk.index_to_node( index ) );
+          }
+        }
+      } );
+    }
+    for ( auto& t : threads )
+    {
+      t.join();
+    }
+    for ( auto& w : _workers )
+    {
+      w.rewriting_fn.reset();
+    }
+
+    /* collect per-thread candidate buffers in cut order of each node */
+    _candidates = std::make_unique<node_map<std::vector<scratch_candidate>, Ntk>>( ntk );
+    for ( auto i = 0u; i < _workers.size(); ++i )
+    {
+      for ( auto const& [n, f] : _workers[i].candidates )
+      {
+        ( *_candidates )[n].push_back( {i, f} );
+      }
+      st.time_rewriting = std::max( st.time_rewriting, _workers[i].time_rewriting );
+    }
+  }
+
+  template<class Cuts>
+  void evaluate_node( rewriting_worker& w, Cuts const& cuts, node<Ntk> const& n )
+  {
+    if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+      return;
+
+    /* skip cuts with small MFFC */
+    const auto no_leaves = []( auto const& ) { return false; };
+    if ( worker_deref( w, n, unit_cost<Ntk>(), no_leaves ) == 1 )
+    {
+      worker_ref( w, n, unit_cost<Ntk>(), no_leaves );
+      return;
+    }
+    worker_ref( w, n, unit_cost<Ntk>(), no_leaves );
+
+    for ( auto& cut : cuts.cuts( ntk.node_to_index( n ) ) )
+    {
+      if ( cut->size() < ps.min_cand_cut_size )
+        continue;
+
+      std::vector<signal<scratch_ntk_t>> children;
+      for ( auto l : *cut )
+      {
+        const auto leaf = ntk.index_to_node( l );
+        auto it = w.leaf_to_pi.find( leaf );
+        if ( it == w.leaf_to_pi.end() )
+        {
+          const auto pi = w.scratch.create_pi();
+          w.pi_to_leaf.emplace( w.scratch.get_node( pi ), leaf );
+          it = w.leaf_to_pi.emplace( leaf, pi ).first;
+        }
+        children.push_back( it->second );
+      }
+
+      /* leaves are free in the scratch network, hence the MFFC is bounded
+       * by the cut */
+      const auto is_leaf = [&]( auto const& l ) { return std::find( cut->begin(), cut->end(), ntk.node_to_index( l ) ) != cut->end(); };
+      int32_t value = worker_deref( w, n, cost_fn, is_leaf );
+      {
+        stopwatch t( w.time_rewriting );
+        int32_t best_gain{-1};
+
+        const auto on_signal = [&]( auto const& f_new ) {
+          /* candidates are built over fresh PIs and therefore never share
+           * logic with the network, this under-estimates the gain */
+          int32_t gain = value - static_cast<int32_t>( scratch_cone_cost( w.scratch, w.scratch.get_node( f_new ) ) );
+
+          if ( gain > 0 || ( ps.allow_zero_gain && gain == 0 ) )
+          {
+            if ( best_gain == -1 )
+            {
+              ( *cut )->data.gain = best_gain = gain;
+              w.candidates.emplace_back( n, f_new );
+            }
+            else if ( gain > best_gain )
+            {
+              ( *cut )->data.gain = best_gain = gain;
+              w.candidates.back().second = f_new;
+            }
+          }
+
+          return true;
+        };
+
+        ( *w.rewriting_fn )( w.scratch, cuts.truth_table( *cut ), children.begin(), children.end(), on_signal );
+      }
+      worker_ref( w, n, cost_fn, is_leaf );
+    }
+  }
+
+  template<class CostFn, class TermCond>
+  uint32_t worker_deref( rewriting_worker& w, node<Ntk> const& n, CostFn const& cost, TermCond&& terminate ) const
+  {
+    if ( ntk.is_constant( n ) || ntk.is_pi( n ) || terminate( n ) )
+      return 0;
+
+    uint32_t value{cost( ntk, n )};
+    ntk.foreach_fanin( n, [&]( auto const& s ) {
+      if ( --w.refs[ntk.node_to_index( ntk.get_node( s ) )] == 0 )
+      {
+        value += worker_deref( w, ntk.get_node( s ), cost, terminate );
+      }
+    } );
+    return value;
+  }
+
+  template<class CostFn, class TermCond>
+  uint32_t worker_ref( rewriting_worker& w, node<Ntk> const& n, CostFn const& cost, TermCond&& terminate ) const
+  {
+    if ( ntk.is_constant( n ) || ntk.is_pi( n ) || terminate( n ) )
+      return 0;
+
+    uint32_t value{cost( ntk, n )};
+    ntk.foreach_fanin( n, [&]( auto const& s ) {
+      if ( w.refs[ntk.node_to_index( ntk.get_node( s ) )]++ == 0 )
+      {
+        value += worker_ref( w, ntk.get_node( s ), cost, terminate );
+      }
+    } );
+    return value;
+  }
+
+  uint32_t scratch_cone_cost( scratch_ntk_t const& scratch, node<scratch_ntk_t> const& root ) const
+  {
+    uint32_t value{0u};
+    std::vector<node<scratch_ntk_t>> stack{root};
+    scratch.incr_trav_id();
+    while ( !stack.empty() )
+    {
+      const auto n = stack.back();
+      stack.pop_back();
+
+      if ( scratch.is_constant( n ) || scratch.is_pi( n ) || scratch.visited( n ) == scratch.trav_id() )
+        continue;
+      scratch.set_visited( n, scratch.trav_id() );
+
+      value += cost_fn( scratch, n );
+      scratch.foreach_fanin( n, [&]( auto const& s ) {
+        stack.push_back( scratch.get_node( s ) );
+      } );
+    }
+    return value;
+  }
+
+  /* copies the candidates in the independent set from the scratch networks
+   * into `ntk`; this happens before any substitution, such that cut leaves
+   * are still alive */
+  void commit_candidates( std::vector<uint32_t> const& is, std::vector<std::pair<node<Ntk>, uint32_t>> const& map, node_map<std::vector<signal<Ntk>>, Ntk>& best_replacements )
+  {
+    for ( const auto v : is )
+    {
+      const auto [v_node, v_cut] = map[v];
+      auto const& cands = ( *_candidates )[v_node];
+      if ( v_cut >= cands.size() )
+        continue;
+
+      auto& w = _workers[cands[v_cut].worker];
+      std::unordered_map<node<scratch_ntk_t>, signal<Ntk>> old_to_new;
+      bool contains{false};
+      const auto f = copy_from_scratch( w, w.scratch.get_node( cands[v_cut].f ), v_node, old_to_new, contains );
+
+      /* an unchanged root is skipped during substitution */
+      best_replacements[v_node].resize( cands.size(), ntk.make_signal( v_node ) );
+      if ( !contains )
+      {
+        best_replacements[v_node][v_cut] = w.scratch.is_complemented( cands[v_cut].f ) ? ntk.create_not( f ) : f;
+      }
+    }
+  }
+
+  signal<Ntk> copy_from_scratch( rewriting_worker& w, node<scratch_ntk_t> const& n, node<Ntk> const& root, std::unordered_map<node<scratch_ntk_t>, signal<Ntk>>& old_to_new, bool& contains )
+  {
+    if ( w.scratch.is_constant( n ) )
+    {
+      return ntk.get_constant( n != w.scratch.get_node( w.scratch.get_constant( false ) ) );
+    }
+    if ( w.scratch.is_pi( n ) )
+    {
+      return ntk.make_signal( w.pi_to_leaf.at( n ) );
+    }
+    if ( const auto it = old_to_new.find( n ); it != old_to_new.end() )
+    {
+      return it->second;
+    }
+
+    std::vector<signal<Ntk>> children;
+    w.scratch.foreach_fanin( n, [&]( auto const& s ) {
+      const auto f = copy_from_scratch( w, w.scratch.get_node( s ), root, old_to_new, contains );
+      children.push_back( w.scratch.is_complemented( s ) ? ntk.create_not( f ) : f );
+    } );
+
+    const auto f = ntk.clone_node( w.scratch, n, children );
+    contains = contains || ( ntk.get_node( f ) == root );
+    old_to_new.emplace( n, f );
+    return f;
+  }
+
   uint32_t recursive_deref( node<Ntk> const& n )
   {
     /* terminate? */
@@ -617,6 +1015,10 @@ private:
   cut_rewriting_params const& ps;
   cut_rewriting_stats& st;
   NodeCostFn cost_fn;
+  mffc_engine<Ntk> mffcs;
+
+  std::vector<rewriting_worker> _workers;
+  std::unique_ptr<node_map<std::vector<scratch_candidate>, Ntk>> _candidates;
 };
 
 } /* namespace detail */
@@ -639,6 +1041,11 @@ private:
  * `mockturtle/algorithms/node_resyntesis`, since the resynthesis functions
  * have the same signature.
  *
+ * If the rewriting function has a method `presynthesize(
+ * std::vector<kitty::dynamic_truth_table> const&, uint32_t num_threads )`, it
+ * is called once with all distinct candidate cut functions before the cuts
+ * are evaluated, such that it can process them in a batch.
+ *
  * In contrast to node resynthesis, cut rewriting uses the same type for the
  * input and output network.  Consequently, the algorithm does not return a
  * new network but applies changes in-place to the input network.
@@ -36,6 +36,9 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "../../traits.hpp"
 
@@ -112,4 +115,281 @@ uint32_t mffc_size( Ntk const& ntk, node<Ntk> const& n )
   return v1;
 }
 
+/*! \brief MFFC computation on a persistent reference-count array.
+ *
+ * The engine keeps its own reference counters, initialized from the fanout
+ * sizes, such that the node values of the network are not used.  `size` and
+ * `collect` dereference the MFFC of a node with an explicit work list and
+ * restore the counters by applying the same deltas in reverse, which takes
+ * time linear in the size of the MFFC, without recursion and, once the
+ * buffers have grown, without allocation.
+ *
+ * `compute_all` computes the MFFCs of all nodes in one pass in reverse
+ * topological order.  A node is in the MFFC of another node, if and only if
+ * the latter dominates it on all paths to the outputs, such that the MFFCs
+ * form a tree, in which the parent of a node is the closest node whose MFFC
+ * contains it.  The MFFC size of a node is the number of nodes in its
+ * subtree.  If the node indices are not in topological order, e.g., after
+ * substitutions, a topological order is computed first.
+ *
+ * The counters must be re-initialized with `update` after the network
+ * changed.
+ */
+template<typename Ntk>
+class mffc_engine
+{
+public:
+  using node = typename Ntk::node;
+
+  explicit mffc_engine( Ntk const& ntk )
+      : _ntk( ntk )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+    static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+    static_assert( has_foreach_node_v<Ntk>, "Ntk does not implement the foreach_node method" );
+    static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+    static_assert( has_fanout_size_v<Ntk>, "Ntk does not implement the fanout_size method" );
+    static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+    static_assert( has_is_pi_v<Ntk>, "Ntk does not implement the is_pi method" );
+    static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+    static_assert( has_index_to_node_v<Ntk>, "Ntk does not implement the index_to_node method" );
+
+    update();
+  }
+
+  /*! \brief Re-initializes the reference counters from the fanout sizes. */
+  void update()
+  {
+    _refs.assign( _ntk.size(), 0u );
+    _ntk.foreach_node( [&]( auto const& n ) {
+      _refs[_ntk.node_to_index( n )] = _ntk.fanout_size( n );
+    } );
+    _dominators.clear();
+    _sizes.clear();
+    _roots.clear();
+  }
+
+  /*! \brief Returns the size of the MFFC of `n`. */
+  uint32_t size( node const& n )
+  {
+    deref( n );
+    ref();
+    return static_cast<uint32_t>( _collected.size() );
+  }
+
+  /*! \brief Returns the nodes in the MFFC of `n`, starting with `n`.
+   *
+   * The returned vector is valid until the next query.
+   */
+  std::vector<node> const& collect( node const& n )
+  {
+    deref( n );
+    ref();
+    return _collected;
+  }
+
+  /*! \brief Computes the MFFCs of all nodes in one pass. */
+  void compute_all()
+  {
+    const auto num_nodes = static_cast<uint32_t>( _refs.size() );
+    const auto sink = num_nodes;
+
+    _dominators.assign( num_nodes + 1u, unset );
+    _depths.assign( num_nodes + 1u, 0u );
+    _gate_refs.assign( num_nodes, 0u );
+    _dominators[sink] = sink;
+
+    compute_order();
+
+    for ( auto it = _order.rbegin(); it != _order.rend(); ++it )
+    {
+      const auto index = *it;
+      const auto n = _ntk.index_to_node( index );
+
+      /* all gate fanouts have been merged, remaining references are outputs */
+      if ( _refs[index] == 0u || _refs[index] != _gate_refs[index] )
+      {
+        merge( index, sink );
+      }
+      _depths[index] = _depths[_dominators[index]] + 1u;
+
+      _ntk.foreach_fanin( n, [&]( auto const& f ) {
+        const auto child = _ntk.node_to_index( _ntk.get_node( f ) );
+        ++_gate_refs[child];
+        merge( child, index );
+      } );
+    }
+
+    _sizes.assign( num_nodes + 1u, 0u );
+    for ( auto const& index : _order )
+    {
+      if ( !is_terminal( _ntk.index_to_node( index ) ) )
+      {
+        _sizes[index] += 1u;
+      }
+      _sizes[_dominators[index]] += _sizes[index];
+    }
+
+    _roots.assign( num_nodes, 0u );
+    for ( auto it = _order.rbegin(); it != _order.rend(); ++it )
+    {
+      const auto d = _dominators[*it];
+      _roots[*it] = d == sink ? *it : _roots[d];
+    }
+  }
+
+  /*! \brief Returns the MFFC size of `n` computed by `compute_all`. */
+  uint32_t mffc_size( node const& n ) const
+  {
+    assert( _ntk.node_to_index( n ) < _roots.size() );
+    return _sizes[_ntk.node_to_index( n )];
+  }
+
+  /*! \brief Returns the closest node whose MFFC contains `n`, or `n` itself
+   *         if there is none. */
+  node dominator( node const& n ) const
+  {
+    const auto index = _ntk.node_to_index( n );
+    assert( index < _roots.size() );
+    const auto d = _dominators[index];
+    return d == _roots.size() ? n : _ntk.index_to_node( d );
+  }
+
+  /*! \brief Returns the root of the largest MFFC that contains `n`. */
+  node root( node const& n ) const
+  {
+    assert( _ntk.node_to_index( n ) < _roots.size() );
+    return _ntk.index_to_node( _roots[_ntk.node_to_index( n )] );
+  }
+
+private:
+  bool is_terminal( node const& n ) const
+  {
+    return _ntk.is_constant( n ) || _ntk.is_pi( n );
+  }
+
+  /* node indices in topological order, usually just the index order */
+  void compute_order()
+  {
+    _order.clear();
+    bool topological = true;
+    _ntk.foreach_node( [&]( auto const& n ) {
+      const auto index = _ntk.node_to_index( n );
+      _ntk.foreach_fanin( n, [&]( auto const& f ) {
+        topological = topological && _ntk.node_to_index( _ntk.get_node( f ) ) < index;
+      } );
+      _order.push_back( index );
+    } );
+
+    if ( topological )
+      return;
+
+    /* substitutions may have moved fanins behind their fanouts, sort with an
+       iterative DFS that does not touch the node values */
+    std::vector<uint8_t> state( _refs.size(), 0u );
+    std::vector<std::pair<uint32_t, bool>> stack;
+    const auto nodes = std::move( _order );
+    _order.clear();
+    for ( auto const& start : nodes )
+    {
+      stack.emplace_back( start, false );
+      while ( !stack.empty() )
+      {
+        const auto [index, expanded] = stack.back();
+        stack.pop_back();
+        if ( expanded )
+        {
+          state[index] = 2u;
+          _order.push_back( index );
+          continue;
+        }
+        if ( state[index] != 0u )
+          continue;
+
+        state[index] = 1u;
+        stack.emplace_back( index, true );
+        _ntk.foreach_fanin( _ntk.index_to_node( index ), [&]( auto const& f ) {
+          const auto child = _ntk.node_to_index( _ntk.get_node( f ) );
+          assert( state[child] != 1u && "network is cyclic" );
+          if ( state[child] == 0u )
+          {
+            stack.emplace_back( child, false );
+          }
+        } );
+      }
+    }
+  }
+
+  void deref( node const& n )
+  {
+    _collected.clear();
+    if ( is_terminal( n ) )
+      return;
+
+    /* the collected nodes serve as work list */
+    _collected.push_back( n );
+    for ( auto i = 0u; i < _collected.size(); ++i )
+    {
+      const auto m = _collected[i];
+      _ntk.foreach_fanin( m, [&]( auto const& f ) {
+        const auto child = _ntk.get_node( f );
+        if ( --_refs[_ntk.node_to_index( child )] == 0u && !is_terminal( child ) )
+        {
+          _collected.push_back( child );
+        }
+      } );
+    }
+  }
+
+  void ref()
+  {
+    for ( auto const& n : _collected )
+    {
+      _ntk.foreach_fanin( n, [&]( auto const& f ) {
+        ++_refs[_ntk.node_to_index( _ntk.get_node( f ) )];
+      } );
+    }
+  }
+
+  void merge( uint32_t index, uint32_t fanout )
+  {
+    auto& d = _dominators[index];
+    if ( d == unset )
+    {
+      d = fanout;
+      return;
+    }
+
+    /* lowest common ancestor in the dominator tree */
+    auto a = d, b = fanout;
+    while ( a != b )
+    {
+      if ( _depths[a] >= _depths[b] )
+      {
+        a = _dominators[a];
+      }
+      else
+      {
+        b = _dominators[b];
+      }
+    }
+    d = a;
+  }
+
+private:
+  static constexpr uint32_t unset = std::numeric_limits<uint32_t>::max();
+
+  Ntk const& _ntk;
+  std::vector<uint32_t> _refs;
+  std::vector<node> _collected;
+
+  std::vector<uint32_t> _order;
+  std::vector<uint32_t> _gate_refs;
+  std::vector<uint32_t> _dominators;
+  std::vector<uint32_t> _depths;
+  std::vector<uint32_t> _sizes;
+  std::vector<uint32_t> _roots;
+};
+
 } /* namespace mockturtle::detail */
@@ -0,0 +1,675 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file minmc_database.hpp
+  \brief Binary database of XAGs with minimum multiplicative complexity
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/hash.hpp>
+#include <kitty/operators.hpp>
+#include <kitty/print.hpp>
+#include <kitty/spectral.hpp>
+#include <kitty/static_truth_table.hpp>
+
+#include "../../traits.hpp"
+#include "walsh_spectra.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mockturtle::detail
+{
+
+/*! \brief Read-only database of XAGs for spectral classes of 6-input functions.
+ *
+ * The database is a flat little-endian buffer that is either mapped from a
+ * binary file or built in memory from the text format.  It starts with a
+ * 24-byte header (magic ``mtminmc1``, version, and the number of entries,
+ * literals, and operations), followed by the entries sorted by their
+ * representative, the literals of all circuits, and the spectral operations
+ * of all entries.  Each entry takes 32 bytes:
+ *
+ * - the spectral representative and the original function (2 x 8 bytes),
+ * - offsets into literals and operations (2 x 4 bytes),
+ * - number of literals and operations (2 x 2 bytes),
+ * - multiplicative complexity, number of inputs, and 2 reserved bytes.
+ *
+ * A circuit is a sequence of gates with two fanin literals followed by the
+ * output literal.  Literals 0 and 1 are the constants, and literal ``l`` with
+ * ``l >= 2`` refers to the ``l / 2 - 1``-th input or gate, complemented if
+ * ``l`` is odd.  A gate is an XOR if its first literal is larger than its
+ * second one, and an AND otherwise.  The operations map the original
+ * function into the representative, in reverse order; an entry without
+ * stored operations has ``no_operations`` as count.
+ */
+class minmc_database
+{
+public:
+  struct entry
+  {
+    uint64_t repr;
+    uint64_t original;
+    uint32_t literals_offset;
+    uint32_t operations_offset;
+    uint16_t num_literals;
+    uint16_t num_operations;
+    uint8_t mc;
+    uint8_t num_inputs;
+    uint16_t reserved;
+  };
+  static_assert( sizeof( entry ) == 32u, "unexpected padding in database entry" );
+
+  static constexpr uint16_t no_operations = 0xffff;
+
+  minmc_database() = default;
+
+  ~minmc_database()
+  {
+#ifndef _WIN32
+    if ( _map != nullptr )
+    {
+      munmap( const_cast<char*>( _map ), _map_size );
+    }
+#endif
+  }
+
+  minmc_database( minmc_database const& ) = delete;
+  minmc_database& operator=( minmc_database const& ) = delete;
+
+  /*! \brief Loads a database in binary or in text format.
+   *
+   * The format is detected from the first bytes of the file.  Binary files
+   * are mapped into memory, whereas text files are parsed into a buffer.
+   */
+  bool load( std::string const& filename )
+  {
+    {
+      std::ifstream in( filename, std::ios::binary );
+      char buffer[sizeof( magic )] = {};
+      in.read( buffer, sizeof( magic ) );
+      if ( !in.good() || std::memcmp( buffer, magic, sizeof( magic ) ) != 0 )
+      {
+        return load_text( filename );
+      }
+    }
+
+#ifndef _WIN32
+    const auto fd = ::open( filename.c_str(), O_RDONLY );
+    if ( fd < 0 )
+    {
+      return false;
+    }
+    struct stat st;
+    if ( fstat( fd, &st ) != 0 || st.st_size < static_cast<off_t>( header_size ) )
+    {
+      ::close( fd );
+      return false;
+    }
+    auto* map = mmap( nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    if ( map == MAP_FAILED )
+    {
+      return false;
+    }
+    _map = static_cast<char const*>( map );
+    _map_size = st.st_size;
+    return attach( _map, _map_size );
+#else
+    std::ifstream in( filename, std::ios::binary );
+    _buffer.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+    return attach( _buffer.data(), _buffer.size() );
+#endif
+  }
+
+  /*! \brief Writes the database in binary format.
+   *
+   * Spectral operations that are not stored yet are computed.
+   */
+  bool write( std::string const& filename ) const
+  {
+    std::vector<entry> entries( _num_entries );
+    std::vector<uint16_t> literals;
+    std::vector<uint16_t> operations;
+    for ( auto i = 0u; i < _num_entries; ++i )
+    {
+      auto& e = entries[i] = at( i );
+
+      const auto* lits = literals_of( e );
+      e.literals_offset = static_cast<uint32_t>( literals.size() );
+      literals.insert( literals.end(), lits, lits + e.num_literals );
+
+      std::vector<uint16_t> ops;
+      for_each_operation( e, [&]( auto const& op ) { ops.push_back( encode( op ) ); } );
+      e.operations_offset = static_cast<uint32_t>( operations.size() );
+      e.num_operations = static_cast<uint16_t>( ops.size() );
+      operations.insert( operations.end(), ops.begin(), ops.end() );
+    }
+
+    std::ofstream out( filename, std::ios::binary | std::ios::trunc );
+    const auto buffer = serialize( entries, literals, operations );
+    out.write( buffer.data(), buffer.size() );
+    return out.good();
+  }
+
+  /*! \brief Checks the circuits of all entries.
+   *
+   * Prints a warning for each circuit that does not compute the original
+   * function of its entry.  If the database was read from a text file, the
+   * original function is replaced by the function of the circuit.
+   */
+  void verify()
+  {
+    for ( auto i = 0u; i < _num_entries; ++i )
+    {
+      const auto e = at( i );
+      const auto tt = simulate( e );
+      if ( *tt.cbegin() == e.original )
+      {
+        continue;
+      }
+
+      kitty::static_truth_table<6> original, repr;
+      *original.begin() = e.original;
+      *repr.begin() = e.repr;
+      std::cerr << "[w] invalid circuit for " << kitty::to_hex( original ) << ", got " << kitty::to_hex( tt ) << "\n";
+      if ( kitty::exact_spectral_canonization( original ) != repr )
+      {
+        std::cerr << "[e] representatives do not match\n";
+      }
+
+      if ( !_buffer.empty() )
+      {
+        std::memcpy( _buffer.data() + header_size + i * sizeof( entry ) + offsetof( entry, original ), &*tt.cbegin(), sizeof( uint64_t ) );
+      }
+    }
+  }
+
+  /*! \brief Number of entries. */
+  uint32_t size() const
+  {
+    return _num_entries;
+  }
+
+  /*! \brief Returns the `index`-th entry. */
+  entry at( uint32_t index ) const
+  {
+    entry e;
+    std::memcpy( &e, _entries + index * sizeof( entry ), sizeof( entry ) );
+    return e;
+  }
+
+  /*! \brief Finds the entry of a representative by binary search. */
+  std::optional<entry> find( uint64_t repr ) const
+  {
+    uint32_t lo = 0u, hi = _num_entries;
+    while ( lo < hi )
+    {
+      const auto mid = lo + ( hi - lo ) / 2;
+      uint64_t key;
+      std::memcpy( &key, _entries + mid * sizeof( entry ), sizeof( key ) );
+      if ( key < repr )
+      {
+        lo = mid + 1;
+      }
+      else if ( repr < key )
+      {
+        hi = mid;
+      }
+      else
+      {
+        return at( mid );
+      }
+    }
+    return std::nullopt;
+  }
+
+  /*! \brief Checks whether some class of the database has the spectral signature.
+   *
+   * Functions whose signature is not contained cannot be in any class of the
+   * database and need not be classified.  The signatures are computed on the
+   * first call.
+   */
+  bool has_signature( uint64_t signature ) const
+  {
+    std::call_once( _signatures_flag, [this]() {
+      std::vector<uint64_t> reprs( _num_entries );
+      for ( auto i = 0u; i < _num_entries; ++i )
+      {
+        std::memcpy( &reprs[i], _entries + i * sizeof( entry ), sizeof( uint64_t ) );
+      }
+      _signatures = spectral_signatures( reprs );
+      std::sort( _signatures.begin(), _signatures.end() );
+    } );
+    return std::binary_search( _signatures.begin(), _signatures.end(), signature );
+  }
+
+  /*! \brief Calls `fn` for all operations that map the original function into the representative. */
+  template<class Fn>
+  void for_each_operation( entry const& e, Fn&& fn ) const
+  {
+    if ( e.num_operations == no_operations )
+    {
+      kitty::static_truth_table<6> original;
+      *original.begin() = e.original;
+      kitty::exact_spectral_canonization( original, [&]( auto const& ops ) {
+        std::for_each( ops.rbegin(), ops.rend(), fn );
+      } );
+      return;
+    }
+
+    for ( auto i = 0u; i < e.num_operations; ++i )
+    {
+      uint16_t code;
+      std::memcpy( &code, _operations + ( e.operations_offset + i ) * sizeof( uint16_t ), sizeof( code ) );
+      fn( decode( code ) );
+    }
+  }
+
+  /*! \brief Creates the circuit of an entry in `ntk` and returns its output. */
+  template<class Ntk>
+  signal<Ntk> instantiate( entry const& e, Ntk& ntk, std::vector<signal<Ntk>> const& pis ) const
+  {
+    std::vector<signal<Ntk>> signals( pis.begin(), pis.begin() + e.num_inputs );
+    const auto literal = [&]( uint16_t lit ) {
+      return lit < 2u ? ntk.get_constant( lit == 1u ) : signals[lit / 2 - 1] ^ ( lit % 2 != 0 );
+    };
+
+    const auto* lits = literals_of( e );
+    for ( auto i = 0u; i + 1u < e.num_literals; i += 2u )
+    {
+      const auto a = literal( lits[i] ), b = literal( lits[i + 1] );
+      signals.push_back( lits[i] > lits[i + 1] ? ntk.create_xor( a, b ) : ntk.create_and( a, b ) );
+    }
+    return literal( lits[e.num_literals - 1] );
+  }
+
+  /*! \brief Simulates the circuit of an entry. */
+  kitty::static_truth_table<6> simulate( entry const& e ) const
+  {
+    std::vector<kitty::static_truth_table<6>> tts( e.num_inputs );
+    for ( auto i = 0u; i < e.num_inputs; ++i )
+    {
+      kitty::create_nth_var( tts[i], i );
+    }
+    const auto literal = [&]( uint16_t lit ) {
+      kitty::static_truth_table<6> tt;
+      if ( lit >= 2u )
+      {
+        tt = tts[lit / 2 - 1];
+      }
+      return ( lit % 2 != 0 ) ? ~tt : tt;
+    };
+
+    const auto* lits = literals_of( e );
+    for ( auto i = 0u; i + 1u < e.num_literals; i += 2u )
+    {
+      const auto a = literal( lits[i] ), b = literal( lits[i + 1] );
+      tts.push_back( lits[i] > lits[i + 1] ? a ^ b : a & b );
+    }
+    return literal( lits[e.num_literals - 1] );
+  }
+
+private:
+  static constexpr char magic[8] = {'m', 't', 'm', 'i', 'n', 'm', 'c', '1'};
+  static constexpr uint32_t version = 1u;
+  static constexpr uint64_t header_size = 24u;
+
+  /* reads the text format, in which each line contains a name, the original
+     function, its representative, the multiplicative complexity, and the
+     circuit, separated by tabs */
+  bool load_text( std::string const& filename )
+  {
+    std::ifstream in( filename, std::ifstream::in );
+    if ( !in.good() )
+    {
+      return false;
+    }
+
+    std::vector<entry> entries;
+    std::vector<uint16_t> literals;
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+      auto pos = line.find( '\t' );
+      if ( pos == std::string::npos || line.size() < pos + 36u )
+      {
+        continue;
+      }
+      ++pos;
+
+      entry e{};
+      e.original = std::stoull( line.substr( pos, 16u ), nullptr, 16 );
+      pos += 17u;
+      e.repr = std::stoull( line.substr( pos, 16u ), nullptr, 16 );
+      pos += 17u;
+      e.mc = static_cast<uint8_t>( line[pos] - '0' );
+      pos += 2u;
+
+      /* the circuit consists of the number of inputs, triples of two fanin
+         literals and an unused token, and the output literal */
+      std::istringstream circuit( line.substr( pos ) );
+      std::vector<std::string> tokens{std::istream_iterator<std::string>( circuit ), std::istream_iterator<std::string>()};
+      if ( tokens.size() < 2u || ( tokens.size() - 2u ) % 3u != 0u )
+      {
+        continue;
+      }
+
+      e.num_inputs = static_cast<uint8_t>( std::stoul( tokens[0] ) );
+      e.literals_offset = static_cast<uint32_t>( literals.size() );
+      for ( auto i = 1u; i + 1u < tokens.size(); i += 3u )
+      {
+        literals.push_back( static_cast<uint16_t>( std::stoul( tokens[i] ) ) );
+        literals.push_back( static_cast<uint16_t>( std::stoul( tokens[i + 1] ) ) );
+      }
+      literals.push_back( static_cast<uint16_t>( std::stoul( tokens.back() ) ) );
+      e.num_literals = static_cast<uint16_t>( literals.size() - e.literals_offset );
+      e.num_operations = no_operations;
+      entries.push_back( e );
+    }
+
+    std::stable_sort( entries.begin(), entries.end(), []( auto const& a, auto const& b ) { return a.repr < b.repr; } );
+    entries.erase( std::unique( entries.begin(), entries.end(), []( auto const& a, auto const& b ) { return a.repr == b.repr; } ), entries.end() );
+
+    _buffer = serialize( entries, literals, {} );
+    return attach( _buffer.data(), _buffer.size() );
+  }
+
+  static std::vector<char> serialize( std::vector<entry> const& entries, std::vector<uint16_t> const& literals, std::vector<uint16_t> const& operations )
+  {
+    std::vector<char> buffer( magic, magic + sizeof( magic ) );
+    const auto write_u32 = [&]( uint32_t value ) {
+      const auto* p = reinterpret_cast<char const*>( &value );
+      buffer.insert( buffer.end(), p, p + sizeof( value ) );
+    };
+    write_u32( version );
+    write_u32( static_cast<uint32_t>( entries.size() ) );
+    write_u32( static_cast<uint32_t>( literals.size() ) );
+    write_u32( static_cast<uint32_t>( operations.size() ) );
+
+    const auto* pe = reinterpret_cast<char const*>( entries.data() );
+    buffer.insert( buffer.end(), pe, pe + entries.size() * sizeof( entry ) );
+    const auto* pl = reinterpret_cast<char const*>( literals.data() );
+    buffer.insert( buffer.end(), pl, pl + literals.size() * sizeof( uint16_t ) );
+    const auto* po = reinterpret_cast<char const*>( operations.data() );
+    buffer.insert( buffer.end(), po, po + operations.size() * sizeof( uint16_t ) );
+    return buffer;
+  }
+
+  bool attach( char const* data, uint64_t size )
+  {
+    if ( size < header_size || std::memcmp( data, magic, sizeof( magic ) ) != 0 )
+    {
+      return false;
+    }
+
+    uint32_t header[4];
+    std::memcpy( header, data + sizeof( magic ), sizeof( header ) );
+    if ( header[0] != version )
+    {
+      return false;
+    }
+
+    const auto num_literals = static_cast<uint64_t>( header[2] );
+    const auto num_operations = static_cast<uint64_t>( header[3] );
+    if ( size < header_size + header[1] * sizeof( entry ) + ( num_literals + num_operations ) * sizeof( uint16_t ) )
+    {
+      return false;
+    }
+
+    _num_entries = header[1];
+    _entries = data + header_size;
+    _literals = _entries + _num_entries * sizeof( entry );
+    _operations = _literals + num_literals * sizeof( uint16_t );
+
+    /* entries are used without further checks, so reject the whole file if
+       one of them points outside of the literals or operations */
+    for ( auto i = 0u; i < _num_entries; ++i )
+    {
+      entry e;
+      std::memcpy( &e, _entries + i * sizeof( entry ), sizeof( entry ) );
+      if ( !is_valid( e, num_literals, num_operations ) )
+      {
+        _num_entries = 0u;
+        _entries = _literals = _operations = nullptr;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool is_valid( entry const& e, uint64_t num_literals, uint64_t num_operations ) const
+  {
+    /* gates with two literals each followed by the output literal */
+    if ( e.num_inputs > 6u || e.num_literals % 2u != 1u || uint64_t( e.literals_offset ) + e.num_literals > num_literals )
+    {
+      return false;
+    }
+
+    /* literals may only refer to inputs and preceding gates */
+    const auto* lits = literals_of( e );
+    for ( auto i = 0u; i < e.num_literals; ++i )
+    {
+      uint16_t lit;
+      std::memcpy( &lit, lits + i, sizeof( lit ) );
+      if ( lit >= 2u && lit / 2u - 1u >= e.num_inputs + i / 2u )
+      {
+        return false;
+      }
+    }
+
+    if ( e.num_operations == no_operations )
+    {
+      return true;
+    }
+    if ( uint64_t( e.operations_offset ) + e.num_operations > num_operations )
+    {
+      return false;
+    }
+    for ( auto i = 0u; i < e.num_operations; ++i )
+    {
+      uint16_t code;
+      std::memcpy( &code, _operations + ( e.operations_offset + i ) * sizeof( uint16_t ), sizeof( code ) );
+      if ( ( code & 7u ) > static_cast<uint16_t>( kitty::detail::spectral_operation::kind::disjoint_translation ) || ( ( code >> 3 ) & 7u ) > 6u || ( ( code >> 6 ) & 7u ) > 6u || ( code >> 9 ) != 0u )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  uint16_t const* literals_of( entry const& e ) const
+  {
+    return reinterpret_cast<uint16_t const*>( _literals ) + e.literals_offset;
+  }
+
+  /* kind in bits 0-2, variables in bits 3-5 and 6-8 as index + 1 */
+  static uint16_t encode( kitty::detail::spectral_operation const& op )
+  {
+    const auto index = []( uint16_t mask ) {
+      uint16_t i = 0u;
+      for ( ; mask != 0u; mask >>= 1 )
+      {
+        ++i;
+      }
+      return i;
+    };
+    return static_cast<uint16_t>( op._kind ) | ( index( op._var1 ) << 3 ) | ( index( op._var2 ) << 6 );
+  }
+
+  static kitty::detail::spectral_operation decode( uint16_t code )
+  {
+    const auto mask = []( uint16_t index ) {
+      return index == 0u ? uint16_t( 0 ) : static_cast<uint16_t>( 1u << ( index - 1u ) );
+    };
+    return kitty::detail::spectral_operation( static_cast<kitty::detail::spectral_operation::kind>( code & 7u ), mask( ( code >> 3 ) & 7u ), mask( ( code >> 6 ) & 7u ) );
+  }
+
+private:
+  uint32_t _num_entries{0u};
+  char const* _entries{nullptr};
+  char const* _literals{nullptr};
+  char const* _operations{nullptr};
+
+  std::vector<char> _buffer;
+#ifndef _WIN32
+  char const* _map{nullptr};
+  uint64_t _map_size{0u};
+#endif
+
+  mutable std::once_flag _signatures_flag;
+  mutable std::vector<uint64_t> _signatures;
+};
+
+/*! \brief Lock-free cache of spectral classifications of 6-input functions.
+ *
+ * The cache is an open-addressing hash table with a fixed number of slots.
+ * Each slot points to an immutable record, which is published with a single
+ * compare-and-swap, such that several threads can look up and insert
+ * classifications concurrently.  If no free slot is found within a few
+ * probes, a classification is not cached.
+ */
+class minmc_classification_cache
+{
+public:
+  struct record
+  {
+    kitty::static_truth_table<6> function;
+    bool success;
+    bool unknown{false}; /* function is in no class of the database */
+    kitty::static_truth_table<6> repr;
+    std::vector<kitty::detail::spectral_operation> operations;
+  };
+
+  explicit minmc_classification_cache( uint32_t size = 1u << 16 )
+      : _mask( size_of( size ) - 1u ),
+        _slots( new std::atomic<record const*>[_mask + 1u] )
+  {
+    for ( auto i = 0u; i <= _mask; ++i )
+    {
+      _slots[i].store( nullptr, std::memory_order_relaxed );
+    }
+  }
+
+  ~minmc_classification_cache()
+  {
+    for ( auto i = 0u; i <= _mask; ++i )
+    {
+      delete _slots[i].load( std::memory_order_relaxed );
+    }
+  }
+
+  minmc_classification_cache( minmc_classification_cache const& ) = delete;
+  minmc_classification_cache& operator=( minmc_classification_cache const& ) = delete;
+
+  /*! \brief Returns the classification of a function or `nullptr`. */
+  record const* find( kitty::static_truth_table<6> const& function ) const
+  {
+    auto index = hash( function );
+    for ( auto i = 0u; i < max_probes; ++i, index = ( index + 1u ) & _mask )
+    {
+      const auto* r = _slots[index].load( std::memory_order_acquire );
+      if ( r == nullptr )
+      {
+        return nullptr;
+      }
+      if ( r->function == function )
+      {
+        return r;
+      }
+    }
+    return nullptr;
+  }
+
+  /*! \brief Inserts a classification and returns the cached record.
+   *
+   * The cache takes ownership of `r` if it is stored.  If another thread has
+   * inserted the same function in the meantime, its record is returned.  If
+   * the cache is full, `nullptr` is returned and `r` is not stored.
+   */
+  record const* insert( std::unique_ptr<record>& r )
+  {
+    auto index = hash( r->function );
+    for ( auto i = 0u; i < max_probes; ++i, index = ( index + 1u ) & _mask )
+    {
+      record const* expected{nullptr};
+      if ( _slots[index].compare_exchange_strong( expected, r.get(), std::memory_order_acq_rel, std::memory_order_acquire ) )
+      {
+        return r.release();
+      }
+      if ( expected->function == r->function )
+      {
+        return expected;
+      }
+    }
+    return nullptr;
+  }
+
+private:
+  static uint32_t size_of( uint32_t size )
+  {
+    uint32_t s = 1u;
+    while ( s < size )
+    {
+      s <<= 1;
+    }
+    return s;
+  }
+
+  uint32_t hash( kitty::static_truth_table<6> const& function ) const
+  {
+    return static_cast<uint32_t>( ( *function.cbegin() * 0x9e3779b97f4a7c15ull ) >> 32 ) & _mask;
+  }
+
+private:
+  static constexpr uint32_t max_probes = 16u;
+
+  uint32_t _mask;
+  std::unique_ptr<std::atomic<record const*>[]> _slots;
+};
+
+} // namespace mockturtle::detail
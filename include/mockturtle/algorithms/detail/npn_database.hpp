@@ -0,0 +1,201 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file npn_database.hpp
+  \brief Flat structures of an NPN database
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "../../traits.hpp"
+
+namespace mockturtle::detail
+{
+
+/*! \brief Flat read-only structures of an NPN database.
+ *
+ * Each candidate structure of an NPN class is stored as a short program of
+ * gates in topological order.  A fanin is a literal ``2 * p + c`` in which
+ * position ``p`` is 0 for the constant, 1 to ``n`` for the ``n`` inputs
+ * (4 by default), and ``n + 1 + i`` for the ``i``-th gate of the candidate.  Instantiating a candidate only
+ * needs a small local array, such that a database can be shared by several
+ * resynthesis functions that are called concurrently.
+ */
+class npn_database
+{
+public:
+  struct gate
+  {
+    std::array<uint32_t, 3> fanins;
+    bool is_xor;
+  };
+
+  struct candidate
+  {
+    uint32_t first_gate;
+    uint32_t num_gates;
+    uint32_t output;
+  };
+
+  explicit npn_database( uint32_t num_classes = 0u, uint32_t num_inputs = 4u )
+      : _classes( num_classes ),
+        _num_inputs( num_inputs )
+  {
+  }
+
+  /*! \brief Adds a class without candidates and returns its index. */
+  uint32_t add_class()
+  {
+    _classes.emplace_back();
+    return static_cast<uint32_t>( _classes.size() ) - 1u;
+  }
+
+  /*! \brief Number of classes. */
+  uint32_t num_classes() const
+  {
+    return static_cast<uint32_t>( _classes.size() );
+  }
+
+  /*! \brief Adds the structure of `f` in `db` as candidate for a class.
+   *
+   * The constant of `db` must have index 0 and its primary inputs the
+   * indexes 1 to ``n``.  The gates of the structure are ordered as in a
+   * depth-first traversal from `f`.
+   */
+  template<class DatabaseNtk, class IsXor>
+  void add( uint32_t class_index, DatabaseNtk const& db, signal<DatabaseNtk> const& f, IsXor&& is_xor )
+  {
+    if ( _positions.size() < db.size() )
+    {
+      _positions.resize( db.size(), 0u );
+      _stamps.resize( db.size(), 0u );
+    }
+    ++_stamp;
+
+    candidate cand;
+    cand.first_gate = static_cast<uint32_t>( _gates.size() );
+    cand.output = ( position( db, db.get_node( f ), cand.first_gate, is_xor ) << 1 ) | ( db.is_complemented( f ) ? 1u : 0u );
+    cand.num_gates = static_cast<uint32_t>( _gates.size() ) - cand.first_gate;
+
+    _max_gates = std::max( _max_gates, cand.num_gates );
+    _classes[class_index].push_back( static_cast<uint32_t>( _candidates.size() ) );
+    _candidates.push_back( cand );
+  }
+
+  /*! \brief Number of candidates of a class. */
+  uint32_t num_candidates( uint32_t class_index ) const
+  {
+    return static_cast<uint32_t>( _classes[class_index].size() );
+  }
+
+  /*! \brief Number of classes with at least one candidate. */
+  uint32_t num_covered_classes() const
+  {
+    return static_cast<uint32_t>( std::count_if( _classes.begin(), _classes.end(), []( auto const& cands ) { return !cands.empty(); } ) );
+  }
+
+  /*! \brief Maximum number of gates in a candidate. */
+  uint32_t max_gates() const
+  {
+    return _max_gates;
+  }
+
+  /*! \brief Creates the `index`-th candidate of a class in `ntk`.
+   *
+   * The ``n`` signals in `pis` drive the inputs of the candidate, and its output
+   * is complemented if `complement` is true.  The function `create_gate` is
+   * called with the network, an array of three fanin signals, and whether
+   * the gate is an XOR gate; `signals` is scratch space.
+   */
+  template<class Ntk, class Leaves, class CreateGate>
+  signal<Ntk> instantiate( uint32_t class_index, uint32_t index, bool complement, Ntk& ntk, Leaves const& pis, std::vector<signal<Ntk>>& signals, CreateGate&& create_gate ) const
+  {
+    assert( pis.size() == _num_inputs );
+    auto const& cand = _candidates[_classes[class_index][index]];
+
+    signals.clear();
+    signals.push_back( ntk.get_constant( false ) );
+    signals.insert( signals.end(), pis.begin(), pis.end() );
+
+    const auto literal = [&]( uint32_t lit ) {
+      return ( lit & 1 ) ? ntk.create_not( signals[lit >> 1] ) : signals[lit >> 1];
+    };
+
+    for ( auto i = cand.first_gate; i < cand.first_gate + cand.num_gates; ++i )
+    {
+      auto const& g = _gates[i];
+      const std::array<signal<Ntk>, 3> fanins{{literal( g.fanins[0] ), literal( g.fanins[1] ), literal( g.fanins[2] )}};
+      signals.push_back( create_gate( ntk, fanins, g.is_xor ) );
+    }
+
+    return literal( cand.output ^ ( complement ? 1u : 0u ) );
+  }
+
+private:
+  template<class DatabaseNtk, class IsXor>
+  uint32_t position( DatabaseNtk const& db, node<DatabaseNtk> const& n, uint32_t first_gate, IsXor&& is_xor )
+  {
+    const auto index = db.node_to_index( n );
+    if ( index <= _num_inputs )
+    {
+      return index;
+    }
+    if ( _stamps[index] == _stamp )
+    {
+      return _positions[index];
+    }
+
+    gate g{{{0u, 0u, 0u}}, is_xor( n )};
+    auto i = 0u;
+    db.foreach_fanin( n, [&]( auto const& f ) {
+      g.fanins[i++] = ( position( db, db.get_node( f ), first_gate, is_xor ) << 1 ) | ( db.is_complemented( f ) ? 1u : 0u );
+    } );
+
+    _gates.push_back( g );
+    _stamps[index] = _stamp;
+    return _positions[index] = _num_inputs + 1u + static_cast<uint32_t>( _gates.size() ) - 1u - first_gate;
+  }
+
+private:
+  std::vector<std::vector<uint32_t>> _classes;
+  std::vector<candidate> _candidates;
+  std::vector<gate> _gates;
+  uint32_t _num_inputs;
+  uint32_t _max_gates{0u};
+
+  /* only used while adding candidates */
+  std::vector<uint32_t> _positions;
+  std::vector<uint32_t> _stamps;
+  uint32_t _stamp{0u};
+};
+
+} // namespace mockturtle::detail
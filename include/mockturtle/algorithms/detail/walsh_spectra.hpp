@@ -0,0 +1,119 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file walsh_spectra.hpp
+  \brief Batched Walsh-Hadamard spectra of 6-input functions
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace mockturtle::detail
+{
+
+/*! \brief Computes spectral signatures of 6-input functions in batches.
+ *
+ * The Walsh-Hadamard spectra of up to 64 functions are computed together in
+ * a coefficient-major layout, such that each butterfly of the fast transform
+ * is a loop over all functions of the batch, which the compiler vectorizes.
+ * The signature of a function is a hash of the histogram of the absolute
+ * values of its spectral coefficients.  It is invariant under all spectral
+ * operations (input permutation and negation, output negation, spectral and
+ * disjoint translation), such that functions with different signatures are
+ * in different spectral classes.
+ */
+inline void spectral_signatures( uint64_t const* functions, uint32_t count, uint64_t* signatures )
+{
+  constexpr uint32_t batch = 64u;
+  alignas( 64 ) std::array<int32_t, 64u * batch> s;
+
+  for ( auto first = 0u; first < count; first += batch )
+  {
+    const auto size = std::min( batch, count - first );
+
+    /* coefficient k of function j is s[k * batch + j], starting from the
+       +1/-1 encoding of the truth table */
+    for ( auto k = 0u; k < 64u; ++k )
+    {
+      auto* row = s.data() + k * batch;
+      for ( auto j = 0u; j < batch; ++j )
+      {
+        const auto f = j < size ? functions[first + j] : 0u;
+        row[j] = 1 - 2 * static_cast<int32_t>( ( f >> k ) & 1u );
+      }
+    }
+
+    for ( auto m = 1u; m < 64u; m <<= 1 )
+    {
+      for ( auto i = 0u; i < 64u; i += m << 1 )
+      {
+        for ( auto k = i; k < i + m; ++k )
+        {
+          auto* a = s.data() + k * batch;
+          auto* b = s.data() + ( k + m ) * batch;
+          for ( auto j = 0u; j < batch; ++j )
+          {
+            const auto x = a[j], y = b[j];
+            a[j] = x + y;
+            b[j] = x - y;
+          }
+        }
+      }
+    }
+
+    for ( auto j = 0u; j < size; ++j )
+    {
+      /* absolute values are even numbers from 0 to 64 */
+      std::array<uint8_t, 33u> histogram{};
+      for ( auto k = 0u; k < 64u; ++k )
+      {
+        const auto c = s[k * batch + j];
+        ++histogram[( c < 0 ? -c : c ) >> 1];
+      }
+
+      uint64_t h = 0xcbf29ce484222325ull;
+      for ( auto c : histogram )
+      {
+        h = ( h ^ c ) * 0x100000001b3ull;
+      }
+      signatures[first + j] = h;
+    }
+  }
+}
+
+/*! \brief Computes the spectral signatures of a vector of functions. */
+inline std::vector<uint64_t> spectral_signatures( std::vector<uint64_t> const& functions )
+{
+  std::vector<uint64_t> signatures( functions.size() );
+  spectral_signatures( functions.data(), static_cast<uint32_t>( functions.size() ), signatures.data() );
+  return signatures;
+}
+
+} // namespace mockturtle::detail
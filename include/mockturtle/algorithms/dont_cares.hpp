@@ -32,7 +32,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <unordered_map>
 #include <vector>
 
 #include "../algorithms/cnf.hpp"
@@ -40,13 +47,17 @@
 #include "../algorithms/simulation.hpp"
 #include "../traits.hpp"
 #include "../utils/node_map.hpp"
+#include "../utils/stopwatch.hpp"
 #include "../views/fanout_view.hpp"
 #include "../views/topo_view.hpp"
 #include "../views/window_view.hpp"
 
 #include <fmt/format.h>
 #include <kitty/bit_operations.hpp>
+#include <kitty/cnf.hpp>
+#include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
+#include <kitty/hash.hpp>
 #include <percy/solvers/bsat2.hpp>
 
 namespace mockturtle
@@ -126,6 +137,760 @@ kitty::dynamic_truth_table observability_dont_cares( Ntk const& ntk, node<Ntk> c
   return ~care;
 }
 
+/*! \brief Parameters for windowed_dont_cares.
+ *
+ * The data structure `windowed_dont_cares_params` holds configurable
+ * parameters with default arguments for `windowed_dont_cares`.
+ */
+struct windowed_dont_cares_params
+{
+  /*! \brief Maximum number of inputs of the window below the leaves. */
+  uint32_t max_window_inputs{12u};
+
+  /*! \brief Maximum number of fanout levels above the root for observability
+   *         don't cares (0 computes only satisfiability don't cares). */
+  uint32_t max_tfo_levels{0u};
+
+  /*! \brief Maximum number of nodes in the bounded transitive fanout. */
+  uint32_t max_tfo_nodes{64u};
+
+  /*! \brief Number of 64-bit words per node for bit-parallel simulation.
+   *
+   * Windows with at most `6 + log2( num_words )` inputs are simulated
+   * exhaustively, larger windows with random patterns.
+   */
+  uint32_t num_words{16u};
+
+  /*! \brief Maximum number of SAT calls per query to confirm don't-care
+   *         candidates of sampled windows. */
+  uint32_t max_sat_calls{16u};
+
+  /*! \brief Conflict limit for each SAT call (0 means no limit). */
+  uint32_t conflict_limit{1000u};
+};
+
+/*! \brief Statistics for windowed_dont_cares.
+ *
+ * The data structure `windowed_dont_cares_stats` provides data collected
+ * by `windowed_dont_cares`.
+ */
+struct windowed_dont_cares_stats
+{
+  /*! \brief Total runtime. */
+  stopwatch<>::duration time_total{0};
+
+  /*! \brief Runtime for window simulation. */
+  stopwatch<>::duration time_simulation{0};
+
+  /*! \brief Runtime for SAT-based confirmation. */
+  stopwatch<>::duration time_sat{0};
+
+  /*! \brief Number of queries. */
+  uint64_t num_queries{0};
+
+  /*! \brief Number of queries answered by exhaustive simulation. */
+  uint64_t num_exhaustive{0};
+
+  /*! \brief Total number of window nodes. */
+  uint64_t num_window_nodes{0};
+
+  /*! \brief Number of SAT calls. */
+  uint64_t num_sat_calls{0};
+
+  /*! \brief Number of candidates confirmed as don't cares by SAT. */
+  uint64_t num_sat_dont_cares{0};
+
+  /*! \brief Number of candidates kept as care because SAT timed out or the
+   *         call budget was exhausted. */
+  uint64_t num_unresolved{0};
+
+  /*! \brief Total number of don't-care minterms. */
+  uint64_t num_dont_cares{0};
+
+  void report() const
+  {
+    std::cout << fmt::format( "[i] total time     = {:>5.2f} secs\n", to_seconds( time_total ) );
+    std::cout << fmt::format( "[i]   sim. time    = {:>5.2f} secs\n", to_seconds( time_simulation ) );
+    std::cout << fmt::format( "[i]   SAT time     = {:>5.2f} secs\n", to_seconds( time_sat ) );
+    std::cout << fmt::format( "[i] queries        = {:8d} ({} exhaustive)\n", num_queries, num_exhaustive );
+    std::cout << fmt::format( "[i] window nodes   = {:8d}\n", num_window_nodes );
+    std::cout << fmt::format( "[i] SAT calls      = {:8d} ({} don't cares, {} unresolved)\n", num_sat_calls, num_sat_dont_cares, num_unresolved );
+    std::cout << fmt::format( "[i] don't cares    = {:8d}\n", num_dont_cares );
+  }
+};
+
+/*! \brief Memory-bounded don't-care computation.
+ *
+ * This class computes care sets over a set of leaves within a small window.
+ * The window inputs are found by expanding the leaves towards the primary
+ * inputs up to `max_window_inputs` nodes.  The window is simulated
+ * bit-parallel, exhaustively if it is small enough and with random patterns
+ * otherwise.  In the latter case, leaf assignments that were never observed
+ * are don't-care candidates which are confirmed with SAT calls on the
+ * window; unconfirmed candidates are conservatively kept in the care set.
+ *
+ * If a root is given and `max_tfo_levels` is positive, observability don't
+ * cares with respect to the transitive fanout of the root up to that many
+ * levels are included.  The fanout is extended by all side inputs that
+ * depend on the root; if it grows beyond `max_tfo_nodes`, only
+ * satisfiability don't cares are computed.  This requires the network to
+ * provide fanouts (e.g., by wrapping it into `fanout_view`).
+ *
+ * All bookkeeping is kept in arrays that are reused between queries, so the
+ * memory per query is bounded by the window size.
+ *
+ * **Required network functions:**
+ * - `size`
+ * - `node_to_index`
+ * - `get_node`
+ * - `is_complemented`
+ * - `is_pi`
+ * - `is_constant`
+ * - `constant_value`
+ * - `foreach_fanin`
+ * - `compute`
+ * - `node_function`
+ */
+template<class Ntk>
+class windowed_dont_cares
+{
+public:
+  using node = typename Ntk::node;
+  using signal = typename Ntk::signal;
+
+  explicit windowed_dont_cares( Ntk const& ntk, windowed_dont_cares_params const& ps, windowed_dont_cares_stats& st )
+      : ntk( ntk ),
+        ps( ps ),
+        st( st )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+    static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+    static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+    static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+    static_assert( has_is_pi_v<Ntk>, "Ntk does not implement the is_pi method" );
+    static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+    static_assert( has_constant_value_v<Ntk>, "Ntk does not implement the constant_value method" );
+    static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+    static_assert( has_compute_v<Ntk, kitty::dynamic_truth_table>, "Ntk does not implement the compute method for kitty::dynamic_truth_table" );
+    static_assert( has_node_function_v<Ntk>, "Ntk does not implement the node_function method" );
+
+    auto words = 1u;
+    while ( words * 2u <= ps.num_words )
+    {
+      words *= 2u;
+      ++num_vars;
+    }
+  }
+
+  /*! \brief Computes the care set of the leaves (satisfiability don't cares only). */
+  kitty::dynamic_truth_table care( std::vector<node> const& leaves )
+  {
+    return compute( std::nullopt, leaves );
+  }
+
+  /*! \brief Computes the care set of a root in terms of the leaves.
+   *
+   * In addition to satisfiability don't cares, assignments for which a
+   * change of the root cannot be observed within `max_tfo_levels` levels of
+   * its transitive fanout are don't cares.  The leaves must be a cut of the
+   * root.
+   */
+  kitty::dynamic_truth_table care( node const& root, std::vector<node> const& leaves )
+  {
+    return compute( root, leaves );
+  }
+
+private:
+  kitty::dynamic_truth_table compute( std::optional<node> const& root, std::vector<node> const& leaves )
+  {
+    stopwatch t( st.time_total );
+    ++st.num_queries;
+
+    prepare();
+    inputs.clear();
+    gates.clear();
+    tfo.clear();
+    frontier.clear();
+
+    collect_window( leaves );
+    auto const with_odc = root && ps.max_tfo_levels > 0u && collect_tfo( *root );
+    st.num_window_nodes += inputs.size() + gates.size() + tfo.size();
+
+    kitty::dynamic_truth_table care( static_cast<uint32_t>( leaves.size() ) );
+    auto const exhaustive = inputs.size() <= num_vars;
+    call_with_stopwatch( st.time_simulation, [&]() {
+      simulate( exhaustive, with_odc );
+
+      kitty::dynamic_truth_table observable = kitty::create<kitty::dynamic_truth_table>( num_vars );
+      if ( with_odc )
+      {
+        for ( auto const& r : frontier )
+        {
+          observable |= value( r, false ) ^ value( r, true );
+        }
+      }
+      else
+      {
+        observable = ~observable;
+      }
+
+      for ( auto i = 0u; i < observable.num_blocks(); ++i )
+      {
+        auto bits = observable._bits[i];
+        while ( bits )
+        {
+          auto const b = static_cast<uint32_t>( __builtin_ctzll( bits ) );
+          bits &= bits - 1u;
+
+          uint64_t minterm{0u};
+          for ( auto j = 0u; j < leaves.size(); ++j )
+          {
+            minterm |= ( ( values[local_index( leaves[j] )]._bits[i] >> b ) & 1u ) << j;
+          }
+          kitty::set_bit( care, minterm );
+        }
+      }
+    } );
+
+    if ( exhaustive )
+    {
+      ++st.num_exhaustive;
+    }
+    else
+    {
+      call_with_stopwatch( st.time_sat, [&]() { confirm( care, leaves, with_odc ); } );
+    }
+
+    st.num_dont_cares += care.num_bits() - kitty::count_ones( care );
+    return care;
+  }
+
+  /* resets the per-query markers */
+  void prepare()
+  {
+    if ( stamps.size() < ntk.size() )
+    {
+      stamps.resize( ntk.size(), 0u );
+      cut_stamps.resize( ntk.size(), 0u );
+      tfo_stamps.resize( ntk.size(), 0u );
+      sorted_stamps.resize( ntk.size(), 0u );
+      locals.resize( ntk.size(), 0u );
+    }
+    ++current;
+  }
+
+  bool in_window( node const& n ) const
+  {
+    return stamps[ntk.node_to_index( n )] == current;
+  }
+
+  bool in_tfo( node const& n ) const
+  {
+    return tfo_stamps[ntk.node_to_index( n )] == current;
+  }
+
+  uint32_t local_index( node const& n ) const
+  {
+    return locals[ntk.node_to_index( n )];
+  }
+
+  uint32_t tfo_index( node const& n, bool flipped ) const
+  {
+    return tfo_offset + ( flipped ? static_cast<uint32_t>( tfo.size() ) : 0u ) + local_index( n );
+  }
+
+  void add_to_window( node const& n, bool is_input )
+  {
+    stamps[ntk.node_to_index( n )] = current;
+    locals[ntk.node_to_index( n )] = static_cast<uint32_t>( order.size() );
+    order.push_back( n );
+    ( is_input ? inputs : gates ).push_back( n );
+  }
+
+  /* expands the leaves towards the inputs as long as the window stays small */
+  void collect_window( std::vector<node> const& leaves )
+  {
+    order.clear();
+    cut.clear();
+    for ( auto const& l : leaves )
+    {
+      if ( cut_stamps[ntk.node_to_index( l )] != current )
+      {
+        cut_stamps[ntk.node_to_index( l )] = current;
+        cut.push_back( l );
+      }
+    }
+
+    auto const cost = [&]( node const& n ) {
+      int32_t c = -1;
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        auto const child = ntk.get_node( f );
+        if ( !ntk.is_constant( child ) && cut_stamps[ntk.node_to_index( child )] != current )
+          ++c;
+      } );
+      return c;
+    };
+
+    while ( true )
+    {
+      auto best = cut.end();
+      int32_t best_cost = std::numeric_limits<int32_t>::max();
+      for ( auto it = cut.begin(); it != cut.end(); ++it )
+      {
+        if ( ntk.is_pi( *it ) || ntk.is_constant( *it ) )
+          continue;
+        if ( auto const c = cost( *it ); c < best_cost )
+        {
+          best = it;
+          best_cost = c;
+        }
+      }
+      if ( best == cut.end() || static_cast<int32_t>( cut.size() ) + best_cost > static_cast<int32_t>( std::max<uint64_t>( ps.max_window_inputs, leaves.size() ) ) )
+        break;
+
+      auto const n = *best;
+      cut.erase( best );
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        auto const child = ntk.get_node( f );
+        if ( !ntk.is_constant( child ) && cut_stamps[ntk.node_to_index( child )] != current )
+        {
+          cut_stamps[ntk.node_to_index( child )] = current;
+          cut.push_back( child );
+        }
+      } );
+    }
+
+    for ( auto const& n : cut )
+    {
+      add_to_window( n, true );
+    }
+    budget = std::numeric_limits<uint32_t>::max();
+    for ( auto const& l : leaves )
+    {
+      collect_gates( l );
+    }
+  }
+
+  /* returns false if the node is not covered by the window (or the budget is exhausted) */
+  bool collect_gates( node const& n )
+  {
+    if ( in_window( n ) )
+      return true;
+    if ( budget == 0u )
+      return false;
+    --budget;
+
+    if ( ntk.is_constant( n ) )
+    {
+      add_to_window( n, false );
+      return true;
+    }
+    if ( ntk.is_pi( n ) )
+      return false;
+
+    auto covered = true;
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      covered = collect_gates( ntk.get_node( f ) );
+      return covered;
+    } );
+    if ( covered )
+    {
+      add_to_window( n, false );
+    }
+    return covered;
+  }
+
+  /* collects the fanout of the root up to `max_tfo_levels` fanout levels */
+  bool collect_tfo( node const& root )
+  {
+    if constexpr ( has_foreach_fanout_v<Ntk> )
+    {
+      /* the root's cone must be covered by the window */
+      if ( ps.max_tfo_nodes == 0u || !collect_gates( root ) )
+        return false;
+      this->root = root;
+
+      auto const add_tfo = [&]( node const& n ) {
+        if ( tfo.size() == ps.max_tfo_nodes )
+          return false;
+        tfo_stamps[ntk.node_to_index( n )] = current;
+        tfo.push_back( n );
+        return true;
+      };
+
+      auto complete = true;
+      std::size_t begin = 0u;
+      auto end = add_tfo( root ) ? tfo.size() : 0u;
+      for ( auto level = 0u; complete && level < ps.max_tfo_levels && begin < end; ++level )
+      {
+        for ( auto i = begin; complete && i < end; ++i )
+        {
+          auto const n = tfo[i];
+          ntk.foreach_fanout( n, [&]( node const& p ) {
+            if ( !in_tfo( p ) )
+              complete = add_tfo( p );
+            return complete;
+          } );
+        }
+        begin = end;
+        end = tfo.size();
+      }
+
+      /* side inputs that depend on the root must be part of the fanout, side
+       * inputs whose cone is covered by the window are computed, and all
+       * others are free inputs */
+      budget = ps.max_tfo_nodes;
+      for ( auto i = 1u; complete && i < tfo.size(); ++i )
+      {
+        auto const n = tfo[i];
+        ntk.foreach_fanin( n, [&]( auto const& f ) {
+          auto const child = ntk.get_node( f );
+          if ( in_tfo( child ) || in_window( child ) )
+            return true;
+          if ( auto const dependent = depends_on_root( child ); !dependent )
+            complete = false;
+          else if ( *dependent )
+            complete = add_tfo( child );
+          return complete;
+        } );
+      }
+
+      if ( complete )
+      {
+        /* the root is kept as first element until the fanout is sorted */
+        tfo.erase( tfo.begin() );
+        tfo_stamps[ntk.node_to_index( root )] = 0u;
+
+        for ( auto const& p : tfo )
+        {
+          ntk.foreach_fanin( p, [&]( auto const& f ) {
+            auto const child = ntk.get_node( f );
+            if ( !in_tfo( child ) && !collect_gates( child ) )
+            {
+              add_to_window( child, true );
+            }
+          } );
+        }
+      }
+      else
+      {
+        for ( auto const& p : tfo )
+          tfo_stamps[ntk.node_to_index( p )] = 0u;
+        tfo.clear();
+        return false;
+      }
+
+      /* order the fanout topologically */
+      sorted.clear();
+      for ( auto const& p : tfo )
+        sort_tfo( p );
+      std::swap( tfo, sorted );
+
+      /* both copies of the fanout are stored after the window nodes */
+      tfo_offset = static_cast<uint32_t>( order.size() );
+      for ( auto i = 0u; i < tfo.size(); ++i )
+      {
+        locals[ntk.node_to_index( tfo[i] )] = i;
+      }
+
+      /* nodes whose change may be visible outside the fanout */
+      auto const add_frontier = [&]( node const& n ) {
+        auto num_fanouts = 0u;
+        auto leaves_tfo = false;
+        ntk.foreach_fanout( n, [&]( node const& p ) {
+          ++num_fanouts;
+          if ( !in_tfo( p ) )
+            leaves_tfo = true;
+        } );
+        if ( leaves_tfo || ntk.fanout_size( n ) > num_fanouts )
+          frontier.push_back( n );
+      };
+      add_frontier( root );
+      for ( auto const& p : tfo )
+        add_frontier( p );
+      return true;
+    }
+    else
+    {
+      (void)root;
+      return false;
+    }
+  }
+
+  /* checks whether the root is in the transitive fanin of a node, returns
+   * std::nullopt if the budget is exhausted */
+  std::optional<bool> depends_on_root( node const& n )
+  {
+    if ( n == root || in_tfo( n ) )
+      return true;
+    if ( in_window( n ) || ntk.is_constant( n ) || ntk.is_pi( n ) || cut_stamps[ntk.node_to_index( n )] == current )
+      return false;
+    if ( budget == 0u )
+      return std::nullopt;
+    --budget;
+
+    std::optional<bool> dependent = false;
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      dependent = depends_on_root( ntk.get_node( f ) );
+      return dependent && !*dependent;
+    } );
+
+    /* the expansion markers are no longer needed and remember independent nodes */
+    if ( dependent && !*dependent )
+      cut_stamps[ntk.node_to_index( n )] = current;
+    return dependent;
+  }
+
+  void sort_tfo( node const& n )
+  {
+    if ( !in_tfo( n ) || sorted_stamps[ntk.node_to_index( n )] == current )
+      return;
+    sorted_stamps[ntk.node_to_index( n )] = current;
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      sort_tfo( ntk.get_node( f ) );
+    } );
+    sorted.push_back( n );
+  }
+
+  /* value of a node, where `flipped` selects the copy with the complemented root */
+  kitty::dynamic_truth_table const& value( node const& n, bool flipped ) const
+  {
+    if ( in_tfo( n ) )
+      return values[tfo_index( n, flipped )];
+    if ( flipped && n == root )
+      return flipped_root;
+    return values[local_index( n )];
+  }
+
+  void simulate( bool exhaustive, bool with_odc )
+  {
+    values.resize( order.size() + 2u * tfo.size(), kitty::create<kitty::dynamic_truth_table>( num_vars ) );
+
+    auto i = 0u;
+    for ( auto const& n : inputs )
+    {
+      auto& tt = values[local_index( n )];
+      if ( exhaustive )
+      {
+        kitty::create_nth_var( tt, i++ );
+      }
+      else
+      {
+        std::generate( tt.begin(), tt.end(), std::ref( random_patterns ) );
+      }
+    }
+
+    for ( auto const& n : gates )
+    {
+      auto& tt = values[local_index( n )];
+      if ( ntk.is_constant( n ) )
+      {
+        tt = kitty::create<kitty::dynamic_truth_table>( num_vars );
+        if ( ntk.constant_value( n ) )
+          tt = ~tt;
+        continue;
+      }
+      tt = compute_node( n, false );
+    }
+
+    if ( with_odc )
+    {
+      flipped_root = ~values[local_index( root )];
+      for ( auto const& flipped : {false, true} )
+      {
+        for ( auto const& p : tfo )
+        {
+          values[tfo_index( p, flipped )] = compute_node( p, flipped );
+        }
+      }
+    }
+  }
+
+  kitty::dynamic_truth_table compute_node( node const& n, bool flipped )
+  {
+    fanin_values.clear();
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      fanin_values.push_back( value( ntk.get_node( f ), flipped ) );
+    } );
+    return ntk.compute( n, fanin_values.begin(), fanin_values.end() );
+  }
+
+  /* confirms don't-care candidates of a sampled window with SAT */
+  void confirm( kitty::dynamic_truth_table& care, std::vector<node> const& leaves, bool with_odc )
+  {
+    auto encoded = false;
+
+    auto num_calls = 0u;
+    for ( uint64_t minterm = 0u; minterm < care.num_bits(); ++minterm )
+    {
+      if ( kitty::get_bit( care, minterm ) )
+        continue;
+
+      if ( num_calls == ps.max_sat_calls )
+      {
+        ++st.num_unresolved;
+        kitty::set_bit( care, minterm );
+        continue;
+      }
+
+      if ( !encoded )
+      {
+        encode( with_odc );
+        encoded = true;
+      }
+
+      std::vector<pabc::lit> assumptions( leaves.size() );
+      for ( auto j = 0u; j < leaves.size(); ++j )
+      {
+        assumptions[j] = lit_not_cond( literals[local_index( leaves[j] )], ( ( minterm >> j ) & 1u ) == 0u );
+      }
+
+      ++num_calls;
+      ++st.num_sat_calls;
+      auto const result = solver.solve( &assumptions[0], &assumptions[0] + assumptions.size(), static_cast<int>( ps.conflict_limit ) );
+      if ( result == percy::failure )
+      {
+        ++st.num_sat_dont_cares;
+      }
+      else
+      {
+        if ( result == percy::timeout )
+          ++st.num_unresolved;
+        kitty::set_bit( care, minterm );
+      }
+    }
+  }
+
+  void encode( bool with_odc )
+  {
+    /* variable 0 is constant false */
+    solver.restart();
+    uint32_t next_var = 1u;
+    solver.add_clause( std::vector<uint32_t>{make_lit( 0u, true )} );
+
+    literals.resize( values.size() );
+    for ( auto const& n : inputs )
+    {
+      literals[local_index( n )] = make_lit( next_var++ );
+    }
+
+    for ( auto const& n : gates )
+    {
+      if ( ntk.is_constant( n ) )
+      {
+        literals[local_index( n )] = make_lit( 0u, ntk.constant_value( n ) );
+        continue;
+      }
+      literals[local_index( n )] = make_lit( next_var++ );
+      encode_gate( n, literals[local_index( n )], false );
+    }
+
+    if ( with_odc )
+    {
+      encode_miter( next_var );
+    }
+    solver.set_nr_vars( static_cast<int>( next_var ) );
+  }
+
+  /* encodes that both copies of the fanout differ at some frontier node */
+  void encode_miter( uint32_t& next_var )
+  {
+    for ( auto const& flipped : {false, true} )
+    {
+      for ( auto const& p : tfo )
+      {
+        auto const lit = make_lit( next_var++ );
+        literals[tfo_index( p, flipped )] = lit;
+        encode_gate( p, lit, flipped );
+      }
+    }
+
+    /* without frontier nodes the root is unobservable, the clause {const1} is unsatisfiable */
+    std::vector<uint32_t> differs{make_lit( 0u )};
+    for ( auto const& r : frontier )
+    {
+      auto const d = make_lit( next_var++ );
+      auto const a = literal( r, false );
+      auto const b = literal( r, true );
+      solver.add_clause( std::vector<uint32_t>{lit_not( d ), a, b} );
+      solver.add_clause( std::vector<uint32_t>{lit_not( d ), lit_not( a ), lit_not( b )} );
+      differs.push_back( d );
+    }
+    solver.add_clause( differs );
+  }
+
+  uint32_t literal( node const& n, bool flipped ) const
+  {
+    if ( in_tfo( n ) )
+      return literals[tfo_index( n, flipped )];
+    if ( flipped && n == root )
+      return lit_not( literals[local_index( n )] );
+    return literals[local_index( n )];
+  }
+
+  void encode_gate( node const& n, uint32_t lit, bool flipped )
+  {
+    std::vector<uint32_t> child_lits;
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      child_lits.push_back( lit_not_cond( literal( ntk.get_node( f ), flipped ), ntk.is_complemented( f ) ) );
+    } );
+    child_lits.push_back( lit );
+
+    auto const function = ntk.node_function( n );
+    auto it = cnf_cache.find( function );
+    if ( it == cnf_cache.end() )
+    {
+      it = cnf_cache.emplace( function, kitty::cnf_characteristic( function ) ).first;
+    }
+
+    for ( auto const& cube : it->second )
+    {
+      std::vector<uint32_t> clause;
+      for ( auto i = 0u; i < child_lits.size(); ++i )
+      {
+        if ( cube.get_mask( i ) )
+        {
+          clause.push_back( lit_not_cond( child_lits[i], !cube.get_bit( i ) ) );
+        }
+      }
+      solver.add_clause( clause );
+    }
+  }
+
+private:
+  Ntk const& ntk;
+  windowed_dont_cares_params const& ps;
+  windowed_dont_cares_stats& st;
+
+  uint32_t num_vars{6u};
+  uint32_t current{0u};
+  std::vector<uint32_t> stamps;
+  std::vector<uint32_t> cut_stamps;
+  std::vector<uint32_t> tfo_stamps;
+  std::vector<uint32_t> sorted_stamps;
+  std::vector<uint32_t> locals;
+
+  std::vector<node> cut;
+  std::vector<node> order;
+  std::vector<node> inputs;
+  std::vector<node> gates;
+  std::vector<node> tfo;
+  std::vector<node> sorted;
+  std::vector<node> frontier;
+  node root{};
+  uint32_t tfo_offset{0u};
+  uint32_t budget{0u};
+
+  std::vector<kitty::dynamic_truth_table> values;
+  std::vector<kitty::dynamic_truth_table> fanin_values;
+  std::unordered_map<kitty::dynamic_truth_table, std::vector<kitty::cube>, kitty::hash<kitty::dynamic_truth_table>> cnf_cache;
+  std::vector<uint32_t> literals;
+  percy::bsat_wrapper solver;
+  kitty::dynamic_truth_table flipped_root;
+  std::mt19937_64 random_patterns{0x5eed};
+};
+
 /*! \brief SAT-based satisfiability don't cares checker
  *
  * Initialize this class with a network and then call `is_dont_care` on a node
@@ -272,11 +272,12 @@ public:
   {
     (void)required;
     auto const tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( auto i = 0u; i < num_divs; ++i )
     {
       auto const d = divs.at( i );
 
-      if ( tt != sim.get_tt( ntk.make_signal( d ) ) )
+      if ( sig != sim.get_signature( ntk.make_signal( d ) ) || tt != sim.get_tt( ntk.make_signal( d ) ) )
         continue; /* next */
 
       return ( sim.get_phase( d ) ^ sim.get_phase( root ) ) ? !ntk.make_signal( d ) : ntk.make_signal( d );
@@ -371,30 +372,44 @@ public:
     udivs.clear();
 
     auto const& tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( auto i = 0u; i < num_divs; ++i )
     {
       auto const d0 = divs.at( i );
       if ( ntk.level( d0 ) > required - 1 )
         continue;
 
+      auto const sig0 = sim.get_signature( ntk.make_signal( d0 ) );
+
       for ( auto j = i + 1; j < num_divs; ++j )
       {
         auto const d1 = divs.at( j );
         if ( ntk.level( d1 ) > required - 1 )
           continue;
 
+        auto const sig1 = sim.get_signature( ntk.make_signal( d1 ) );
+        auto const maybe_positive = majority( sig0, sig1, sig ) == sig;
+        auto const maybe_negative = majority( ~sig0, sig1, sig ) == sig;
+
+        if ( !maybe_positive && !maybe_negative )
+        {
+          if ( std::find( udivs.next_candidates.begin(), udivs.next_candidates.end(), ntk.make_signal( d1 ) ) == udivs.next_candidates.end() )
+            udivs.next_candidates.emplace_back( ntk.make_signal( d1 ) );
+          continue;
+        }
+
         auto const& tt_s0 = sim.get_tt( ntk.make_signal( d0 ) );
         auto const& tt_s1 = sim.get_tt( ntk.make_signal( d1 ) );
 
         /* Boolean filtering rule for MAJ-3 */
-        if ( kitty::ternary_majority( tt_s0, tt_s1, tt ) == tt )
+        if ( maybe_positive && kitty::ternary_majority( tt_s0, tt_s1, tt ) == tt )
         {
           udivs.positive_divisors0.emplace_back( ntk.make_signal( d0 ) );
           udivs.positive_divisors1.emplace_back( ntk.make_signal( d1 ) );
           continue;
         }
 
-        if ( kitty::ternary_majority( ~tt_s0, tt_s1, tt ) == tt )
+        if ( maybe_negative && kitty::ternary_majority( ~tt_s0, tt_s1, tt ) == tt )
         {
           udivs.negative_divisors0.emplace_back( ntk.make_signal( d0 ) );
           udivs.negative_divisors1.emplace_back( ntk.make_signal( d1 ) );
@@ -414,16 +429,25 @@ public:
   {
     (void)required;
     auto const& tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
 
     /* check for positive unate divisors */
     for ( auto i = 0u; i < udivs.positive_divisors0.size(); ++i )
     {
       auto const s0 = udivs.positive_divisors0.at( i );
       auto const s1 = udivs.positive_divisors1.at( i );
+      auto const sig0 = sim.get_signature( s0 );
+      auto const sig1 = sim.get_signature( s1 );
+
+      /* where both divisors agree, the third one cannot change the majority */
+      if ( ( ~( sig0 ^ sig1 ) & ( sig0 ^ sig ) ) != 0u )
+        continue;
 
       for ( auto j = i + 1; j < udivs.positive_divisors0.size(); ++j )
       {
         auto s2 = udivs.positive_divisors0.at( j );
+        if ( majority( sig0, sig1, sim.get_signature( s2 ) ) != sig && majority( sig0, sig1, sim.get_signature( udivs.positive_divisors1.at( j ) ) ) != sig )
+          continue;
 
         auto const& tt_s0 = sim.get_tt( s0 );
         auto const& tt_s1 = sim.get_tt( s1 );
@@ -457,10 +481,18 @@ public:
     {
       auto const s0 = udivs.negative_divisors0.at( i );
       auto const s1 = udivs.negative_divisors1.at( i );
+      auto const sig0 = ~sim.get_signature( s0 );
+      auto const sig1 = sim.get_signature( s1 );
+
+      /* where both divisors agree, the third one cannot change the majority */
+      if ( ( ~( sig0 ^ sig1 ) & ( sig0 ^ sig ) ) != 0u )
+        continue;
 
       for ( auto j = i + 1; j < udivs.negative_divisors0.size(); ++j )
       {
         auto s2 = udivs.negative_divisors0.at( j );
+        if ( majority( sig0, sig1, sim.get_signature( s2 ) ) != sig && majority( sig0, sig1, sim.get_signature( udivs.negative_divisors1.at( j ) ) ) != sig )
+          continue;
 
         auto const& tt_s0 = sim.get_tt( s0 );
         auto const& tt_s1 = sim.get_tt( s1 );
@@ -497,6 +529,7 @@ public:
     bdivs.clear();
 
     auto const& tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( auto i = 0u; i < udivs.next_candidates.size(); ++i )
     {
       auto const& s0 = udivs.next_candidates.at( i );
@@ -504,6 +537,7 @@ public:
         continue;
 
       auto const& tt_s0 = sim.get_tt( s0 );
+      auto const sig0 = sim.get_signature( s0 );
 
       for ( auto j = i + 1; j < udivs.next_candidates.size(); ++j )
       {
@@ -512,6 +546,7 @@ public:
           continue;
 
         auto const& tt_s1 = sim.get_tt( s1 );
+        auto const sig1 = sim.get_signature( s1 );
 
         for ( auto k = j + 1; k < udivs.next_candidates.size(); ++k )
         {
@@ -519,6 +554,12 @@ public:
           if ( ntk.level( ntk.get_node( s2 ) ) > required - 2 )
             continue;
 
+          auto const sig2 = sim.get_signature( s2 );
+          auto const maj_pos = majority( sig0, sig1, sig2 );
+          auto const maj_neg = majority( ~sig0, sig1, sig2 );
+          if ( ( maj_pos & ~sig ) != 0u && ( maj_neg & ~sig ) != 0u && ( sig & ~maj_pos ) != 0u && ( sig & ~maj_neg ) != 0u )
+            continue;
+
           auto const& tt_s2 = sim.get_tt( s2 );
 
           if ( kitty::implies( kitty::ternary_majority( tt_s0, tt_s1, tt_s2 ), tt ) )
@@ -562,6 +603,7 @@ public:
     (void)required;
     auto const s = ntk.make_signal( root );
     auto const& tt = sim.get_tt( s );
+    auto const sig = sim.get_signature( s );
 
     /* check positive unate divisors */
     for ( auto i = 0u; i < udivs.positive_divisors0.size(); ++i )
@@ -575,6 +617,9 @@ public:
         auto const& s3 = bdivs.positive_divisors1.at( j );
         auto const& s4 = bdivs.positive_divisors2.at( j );
 
+        if ( majority( majority( sim.get_signature( s0 ), sim.get_signature( s1 ), sim.get_signature( s2 ) ), sim.get_signature( s3 ), sim.get_signature( s4 ) ) != sig )
+          continue;
+
         auto const a = sim.get_phase( ntk.get_node( s0 ) ) ? !s0 : s0;
         auto const b = sim.get_phase( ntk.get_node( s1 ) ) ? !s1 : s1;
         auto const c = sim.get_phase( ntk.get_node( s2 ) ) ? !s1 : s2;
@@ -608,6 +653,9 @@ public:
         auto const& s3 = bdivs.negative_divisors1.at( j );
         auto const& s4 = bdivs.negative_divisors2.at( j );
 
+        if ( majority( ~majority( sim.get_signature( s0 ), sim.get_signature( s1 ), sim.get_signature( s2 ) ), sim.get_signature( s3 ), sim.get_signature( s4 ) ) != sig )
+          continue;
+
         auto const a = sim.get_phase( ntk.get_node( s0 ) ) ? !s0 : s0;
         auto const b = sim.get_phase( ntk.get_node( s1 ) ) ? !s1 : s1;
         auto const c = sim.get_phase( ntk.get_node( s2 ) ) ? !s1 : s2;
@@ -632,6 +680,13 @@ public:
     return std::nullopt;
   }
 
+private:
+  /* majority of 64-bit signatures */
+  static uint64_t majority( uint64_t a, uint64_t b, uint64_t c )
+  {
+    return ( a & b ) | ( a & c ) | ( b & c );
+  }
+
 private:
   Ntk& ntk;
   Simulator const& sim;
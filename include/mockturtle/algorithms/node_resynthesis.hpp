@@ -32,7 +32,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <iostream>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/hash.hpp>
+#include <kitty/npn.hpp>
 
 #include "../traits.hpp"
 #include "../utils/node_map.hpp"
@@ -51,6 +62,37 @@ namespace mockturtle
  */
 struct node_resynthesis_params
 {
+  /*! \brief Number of threads to presynthesize node functions.
+   *
+   * If larger than 1, the resynthesis function is first called for all
+   * distinct node functions in parallel, using private scratch networks.
+   * If `cache_npn_classes` is used, it is called for the distinct NPN
+   * representatives instead, since only those are resynthesized afterwards.
+   * This fills the cache of a resynthesis function such as
+   * ``exact_resynthesis`` (with its own limits, e.g., ``conflict_limit``),
+   * such that the network is constructed from cached results afterwards.
+   * The resynthesis function must then be safe to call concurrently.
+   */
+  uint32_t num_threads{1u};
+
+  /*! \brief Reuse the resynthesized structure of equal node functions.
+   *
+   * If true, the resynthesis function is called only once for each distinct
+   * node function, on a separate template network, and the resulting
+   * structure is copied for each node with that function.  This requires
+   * ``clone_node`` in the destination network and is ignored otherwise.
+   */
+  bool cache_functions{false};
+
+  /*! \brief Reuse the resynthesized structure of NPN-equivalent functions.
+   *
+   * If true (and `cache_functions` is true), the resynthesis function is
+   * called for the representative of each NPN class of functions with up to
+   * 6 variables, and its structure is copied with permuted and complemented
+   * leaves.  Complemented leaves and outputs are created with ``create_not``.
+   */
+  bool cache_npn_classes{false};
+
   /*! \brief Be verbose. */
   bool verbose{false};
 };
@@ -65,9 +107,33 @@ struct node_resynthesis_stats
   /*! \brief Total runtime. */
   stopwatch<>::duration time_total{0};
 
+  /*! \brief Runtime for presynthesis. */
+  stopwatch<>::duration time_presynthesis{0};
+
+  /*! \brief Number of distinct node functions in presynthesis. */
+  uint32_t num_functions{0};
+
+  /*! \brief Number of distinct NPN classes in presynthesis (only with
+   *         `cache_npn_classes`). */
+  uint32_t num_classes{0};
+
+  /*! \brief Number of structures resynthesized for the function cache. */
+  uint32_t num_templates{0};
+
+  /*! \brief Number of nodes that reused a structure from the function cache. */
+  uint32_t num_template_hits{0};
+
   void report() const
   {
     std::cout << fmt::format( "[i] total time = {:>5.2f} secs\n", to_seconds( time_total ) );
+    if ( num_functions > 0u )
+    {
+      std::cout << fmt::format( "[i] presynthesis time = {:>5.2f} secs ({} functions, {} classes)\n", to_seconds( time_presynthesis ), num_functions, num_classes );
+    }
+    if ( num_templates > 0u )
+    {
+      std::cout << fmt::format( "[i] function cache: {} structures, {} hits\n", num_templates, num_template_hits );
+    }
   }
 };
 
@@ -91,6 +157,11 @@ public:
   {
     stopwatch t( st.time_total );
 
+    if ( ps.num_threads > 1u )
+    {
+      presynthesize();
+    }
+
     node_map<signal<NtkDest>, NtkSource> node2new( ntk );
 
     /* map constants */
@@ -132,7 +203,7 @@ public:
         children.push_back( ntk.is_complemented( f ) ? ntk_dest.create_not( node2new[f] ) : node2new[f] );
       } );
 
-      resynthesis_fn( ntk_dest, ntk.node_function( n ), children.begin(), children.end(), [&]( auto const& f ) {
+      const auto assign = [&]( auto const& f ) {
         node2new[n] = f;
 
         if constexpr ( has_has_name_v<NtkSource> && has_get_name_v<NtkSource> && has_set_name_v<NtkDest> )
@@ -142,7 +213,21 @@ public:
         }
 
         return false;
-      } );
+      };
+
+      if constexpr ( has_clone_node_v<NtkDest> )
+      {
+        if ( ps.cache_functions )
+        {
+          if ( const auto f = copy_template( ntk.node_function( n ), children ) )
+          {
+            assign( *f );
+          }
+          return;
+        }
+      }
+
+      resynthesis_fn( ntk_dest, ntk.node_function( n ), children.begin(), children.end(), assign );
     } );
 
     /* map primary outputs */
@@ -176,11 +261,234 @@ public:
   }
 
 private:
+  void presynthesize()
+  {
+    stopwatch t( st.time_presynthesis );
+
+    using tt_set_t = std::unordered_set<kitty::dynamic_truth_table, kitty::hash<kitty::dynamic_truth_table>>;
+    tt_set_t functions, classes;
+
+    /* the same functions for which the network is resynthesized afterwards */
+    bool npn_classes{false};
+    if constexpr ( has_clone_node_v<NtkDest> )
+    {
+      npn_classes = ps.cache_functions && ps.cache_npn_classes;
+    }
+
+    std::vector<kitty::dynamic_truth_table> jobs;
+    ntk.foreach_node( [&]( auto n ) {
+      if ( ntk.is_constant( n ) || ntk.is_ci( n ) )
+        return;
+
+      const auto function = ntk.node_function( n );
+      if ( !functions.insert( function ).second )
+        return;
+
+      if ( npn_classes && function.num_vars() <= 6 )
+      {
+        const auto repr = std::get<0>( kitty::exact_npn_canonization( function ) );
+        if ( classes.insert( repr ).second )
+        {
+          jobs.push_back( repr );
+        }
+      }
+      else
+      {
+        jobs.push_back( function );
+      }
+    } );
+
+    st.num_functions = static_cast<uint32_t>( functions.size() );
+    st.num_classes = static_cast<uint32_t>( classes.size() );
+
+    presynthesize( jobs );
+  }
+
+  void presynthesize( std::vector<kitty::dynamic_truth_table> const& functions )
+  {
+    std::atomic<uint32_t> next_function{0u};
+    std::vector<std::thread> threads;
+    for ( auto i = 0u; i < ps.num_threads; ++i )
+    {
+      threads.emplace_back( [&]() {
+        while ( true )
+        {
+          const auto j = next_function++;
+          if ( j >= functions.size() )
+            break;
+
+          NtkDest scratch;
+          std::vector<signal<NtkDest>> leaves;
+          for ( auto k = 0u; k < static_cast<uint32_t>( functions[j].num_vars() ); ++k )
+          {
+            leaves.push_back( scratch.create_pi() );
+          }
+          resynthesis_fn( scratch, functions[j], leaves.begin(), leaves.end(), []( auto const& ) { return false; } );
+        }
+      } );
+    }
+    for ( auto& t : threads )
+    {
+      t.join();
+    }
+  }
+
+  /* structure of a resynthesized function in the template network, gates
+     are in topological order */
+  struct function_template
+  {
+    bool valid{false};
+    signal<NtkDest> output;
+    std::vector<node<NtkDest>> gates;
+  };
+
+  /* transformation of a function into the function of its template */
+  struct template_entry
+  {
+    uint32_t index;
+    uint32_t phase;
+    std::vector<uint8_t> perm;
+  };
+
+  template_entry const& find_template( kitty::dynamic_truth_table const& function )
+  {
+    if ( const auto it = _entries.find( function ); it != _entries.end() )
+    {
+      ++st.num_template_hits;
+      return it->second;
+    }
+
+    const auto num_vars = function.num_vars();
+    template_entry entry{0u, 0u, std::vector<uint8_t>( num_vars )};
+    std::iota( entry.perm.begin(), entry.perm.end(), 0u );
+
+    auto repr = function;
+    if ( ps.cache_npn_classes && num_vars <= 6 )
+    {
+      std::tie( repr, entry.phase, entry.perm ) = kitty::exact_npn_canonization( function );
+    }
+
+    if ( const auto it = _classes.find( repr ); it != _classes.end() )
+    {
+      ++st.num_template_hits;
+      entry.index = it->second;
+    }
+    else
+    {
+      entry.index = static_cast<uint32_t>( _templates.size() );
+      _templates.push_back( make_template( repr ) );
+      _classes.emplace( repr, entry.index );
+      ++st.num_templates;
+    }
+
+    return _entries.emplace( function, entry ).first->second;
+  }
+
+  function_template make_template( kitty::dynamic_truth_table const& function )
+  {
+    while ( _template_pis.size() < static_cast<uint32_t>( function.num_vars() ) )
+    {
+      const auto pi = _template_ntk.create_pi();
+      _template_leaf.resize( _template_ntk.size() );
+      _template_leaf[_template_ntk.node_to_index( _template_ntk.get_node( pi ) )] = static_cast<uint32_t>( _template_pis.size() );
+      _template_pis.push_back( pi );
+    }
+
+    function_template t;
+    resynthesis_fn( _template_ntk, function, _template_pis.begin(), _template_pis.begin() + function.num_vars(), [&]( auto const& f ) {
+      t.valid = true;
+      t.output = f;
+      return false;
+    } );
+
+    if ( t.valid )
+    {
+      _template_visited.resize( _template_ntk.size(), 0u );
+      ++_template_stamp;
+      collect_gates( _template_ntk.get_node( t.output ), t.gates );
+    }
+    return t;
+  }
+
+  void collect_gates( node<NtkDest> const& n, std::vector<node<NtkDest>>& gates )
+  {
+    const auto index = _template_ntk.node_to_index( n );
+    if ( _template_visited[index] == _template_stamp || _template_ntk.is_constant( n ) || _template_ntk.is_ci( n ) )
+    {
+      return;
+    }
+    _template_visited[index] = _template_stamp;
+
+    _template_ntk.foreach_fanin( n, [&]( auto const& f ) {
+      collect_gates( _template_ntk.get_node( f ), gates );
+    } );
+    gates.push_back( n );
+  }
+
+  std::optional<signal<NtkDest>> copy_template( kitty::dynamic_truth_table const& function, std::vector<signal<NtkDest>> const& children )
+  {
+    auto const& entry = find_template( function );
+    auto const& t = _templates[entry.index];
+    if ( !t.valid )
+    {
+      return std::nullopt;
+    }
+
+    _copies.resize( _template_ntk.size() );
+    const auto copy_of = [&]( signal<NtkDest> const& f ) {
+      const auto n = _template_ntk.get_node( f );
+      signal<NtkDest> g;
+      if ( _template_ntk.is_constant( n ) )
+      {
+        g = ntk_dest.get_constant( _template_ntk.constant_value( n ) );
+      }
+      else if ( _template_ntk.is_ci( n ) )
+      {
+        /* leaf i of the template is mapped to child perm[i] */
+        const auto i = _template_leaf[_template_ntk.node_to_index( n )];
+        g = children[entry.perm[i]];
+        if ( ( entry.phase >> entry.perm[i] ) & 1 )
+        {
+          g = ntk_dest.create_not( g );
+        }
+      }
+      else
+      {
+        g = _copies[_template_ntk.node_to_index( n )];
+      }
+      return _template_ntk.is_complemented( f ) ? ntk_dest.create_not( g ) : g;
+    };
+
+    std::vector<signal<NtkDest>> fanin;
+    for ( auto const& n : t.gates )
+    {
+      fanin.clear();
+      _template_ntk.foreach_fanin( n, [&]( auto const& f ) {
+        fanin.push_back( copy_of( f ) );
+      } );
+      _copies[_template_ntk.node_to_index( n )] = ntk_dest.clone_node( _template_ntk, n, fanin );
+    }
+
+    const auto f = copy_of( t.output );
+    return ( ( entry.phase >> function.num_vars() ) & 1 ) ? ntk_dest.create_not( f ) : f;
+  }
+
   NtkDest& ntk_dest;
   NtkSource const& ntk;
   ResynthesisFn&& resynthesis_fn;
   node_resynthesis_params const& ps;
   node_resynthesis_stats& st;
+
+  /* function cache */
+  NtkDest _template_ntk;
+  std::vector<signal<NtkDest>> _template_pis;
+  std::vector<uint32_t> _template_leaf;
+  std::vector<function_template> _templates;
+  std::unordered_map<kitty::dynamic_truth_table, uint32_t, kitty::hash<kitty::dynamic_truth_table>> _classes;
+  std::unordered_map<kitty::dynamic_truth_table, template_entry, kitty::hash<kitty::dynamic_truth_table>> _entries;
+  std::vector<uint32_t> _template_visited;
+  uint32_t _template_stamp{0u};
+  std::vector<signal<NtkDest>> _copies;
 };
 
 } /* namespace detail */
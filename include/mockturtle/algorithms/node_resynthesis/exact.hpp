@@ -34,6 +34,7 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -45,17 +46,27 @@
 
 #include "../../networks/aig.hpp"
 #include "../../networks/klut.hpp"
+#include "exact_cache.hpp"
 
 namespace mockturtle
 {
 
 struct exact_resynthesis_params
 {
-  using cache_map_t = std::unordered_map<kitty::dynamic_truth_table, percy::chain, kitty::hash<kitty::dynamic_truth_table>>;
+  /*! \brief In-memory cache, with a mutex for resynthesis functions that
+   *         share it concurrently. */
+  struct cache_map_t : std::unordered_map<kitty::dynamic_truth_table, percy::chain, kitty::hash<kitty::dynamic_truth_table>>
+  {
+    std::mutex mutex;
+  };
+
   using cache_t = std::shared_ptr<cache_map_t>;
 
   cache_t cache;
 
+  /*! \brief Persistent cache, also used for functions with don't cares. */
+  std::shared_ptr<exact_synthesis_cache> persistent_cache;
+
   bool add_alonce_clauses{true};
   bool add_colex_clauses{true};
   bool add_lex_clauses{false};
@@ -96,7 +107,11 @@ struct exact_resynthesis_params
  * A cache can be passed as second parameter to the constructor, which will
  * store optimum networks for all functions for which resynthesis is invoked
  * for.  The cache can be used to retrieve the computed network, which reduces
- * runtime.
+ * runtime.  A persistent cache (see ``exact_synthesis_cache``) can be passed
+ * in addition; it stores the networks in a file, such that they are shared
+ * across runs, and also stores networks for functions with don't cares.
+ * Both caches may be used when the resynthesis function is called
+ * concurrently, e.g., by ``node_resynthesis`` with several threads.
  *
    \verbatim embed:rst
 
@@ -143,28 +158,40 @@ public:
       return;
     }
 
-    percy::spec spec;
-    spec.fanin = _fanin_size;
-    spec.verbosity = 0;
-    spec.add_alonce_clauses = _ps.add_alonce_clauses;
-    spec.add_colex_clauses = _ps.add_colex_clauses;
-    spec.add_lex_clauses = _ps.add_lex_clauses;
-    spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
-    spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
-    spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
-    spec.add_symvar_clauses = _ps.add_symvar_clauses;
-    spec.conflict_limit = _ps.conflict_limit;
-    spec[0] = function;
-    bool with_dont_cares{false};
-    if ( !kitty::is_const0( dont_cares ) )
-    {
-      spec.set_dont_care( 0, dont_cares );
-      with_dont_cares = true;
-    }
+    const auto synthesize = [&]( kitty::dynamic_truth_table const& func, kitty::dynamic_truth_table const& dcs ) -> std::optional<percy::chain> {
+      percy::spec spec;
+      spec.fanin = _fanin_size;
+      spec.verbosity = 0;
+      spec.add_alonce_clauses = _ps.add_alonce_clauses;
+      spec.add_colex_clauses = _ps.add_colex_clauses;
+      spec.add_lex_clauses = _ps.add_lex_clauses;
+      spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
+      spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
+      spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
+      spec.add_symvar_clauses = _ps.add_symvar_clauses;
+      spec.conflict_limit = _ps.conflict_limit;
+      spec[0] = func;
+      if ( !kitty::is_const0( dcs ) )
+      {
+        spec.set_dont_care( 0, dcs );
+      }
+
+      percy::chain c;
+      if ( const auto result = percy::synthesize( spec, c, _ps.solver_type,
+                                                  _ps.encoder_type,
+                                                  _ps.synthesis_method );
+           result != percy::success )
+      {
+        return std::nullopt;
+      }
+      return c;
+    };
+    const bool with_dont_cares = !kitty::is_const0( dont_cares );
 
     auto c = [&]() -> std::optional<percy::chain> {
       if ( !with_dont_cares && _ps.cache )
       {
+        std::lock_guard<std::mutex> lock( _ps.cache->mutex );
         const auto it = _ps.cache->find( function );
         if ( it != _ps.cache->end() )
         {
@@ -172,18 +199,18 @@ public:
         }
       }
 
-      percy::chain c;
-      if ( const auto result = percy::synthesize( spec, c, _ps.solver_type,
-                                                  _ps.encoder_type,
-                                                  _ps.synthesis_method );
-           result != percy::success )
+      auto c = _ps.persistent_cache
+                   ? _ps.persistent_cache->lookup_or_synthesize( ( 1u << 16 ) | _fanin_size, function, ~dont_cares, [&]( auto const& f, auto const& care ) { return synthesize( f, ~care ); } )
+                   : synthesize( function, dont_cares );
+      if ( !c )
       {
         return std::nullopt;
       }
-      c.denormalize();
+      c->denormalize();
       if ( !with_dont_cares && _ps.cache )
       {
-        ( *_ps.cache )[function] = c;
+        std::lock_guard<std::mutex> lock( _ps.cache->mutex );
+        ( *_ps.cache )[function] = *c;
       }
       return c;
     }();
@@ -205,7 +232,16 @@ public:
       signals.emplace_back( ntk.create_node( fanin, c->get_operator( i ) ) );
     }
 
-    fn( signals.back() );
+    /* the output may point to a constant or an input */
+    const auto output = c->get_outputs()[0];
+    if ( ( output >> 1 ) == 0 )
+    {
+      fn( ntk.get_constant( output & 1 ) );
+    }
+    else
+    {
+      fn( ( output & 1 ) ? ntk.create_not( signals[( output >> 1 ) - 1] ) : signals[( output >> 1 ) - 1] );
+    }
   }
 
 private:
@@ -235,7 +271,11 @@ private:
  * A cache can be passed as second parameter to the constructor, which will
  * store optimum networks for all functions for which resynthesis is invoked
  * for.  The cache can be used to retrieve the computed network, which reduces
- * runtime.
+ * runtime.  A persistent cache (see ``exact_synthesis_cache``) can be passed
+ * in addition; it stores the networks in a file, such that they are shared
+ * across runs, and also stores networks for functions with don't cares.
+ * Both caches may be used when the resynthesis function is called
+ * concurrently, e.g., by ``node_resynthesis`` with several threads.
  *
    \verbatim embed:rst
 
@@ -278,32 +318,44 @@ public:
   {
     // TODO: special case for small functions (up to 2 variables)?
 
-    percy::spec spec;
-    if ( !_allow_xor )
-    {
-      spec.set_primitive( percy::AIG );
-    }
-    spec.fanin = 2;
-    spec.verbosity = 0;
-    spec.add_alonce_clauses = _ps.add_alonce_clauses;
-    spec.add_colex_clauses = _ps.add_colex_clauses;
-    spec.add_lex_clauses = _ps.add_lex_clauses;
-    spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
-    spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
-    spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
-    spec.add_symvar_clauses = _ps.add_symvar_clauses;
-    spec.conflict_limit = _ps.conflict_limit;
-    spec[0] = function;
-    bool with_dont_cares{false};
-    if ( !kitty::is_const0( dont_cares ) )
-    {
-      spec.set_dont_care( 0, dont_cares );
-      with_dont_cares = true;
-    }
+    const auto synthesize = [&]( kitty::dynamic_truth_table const& func, kitty::dynamic_truth_table const& dcs ) -> std::optional<percy::chain> {
+      percy::spec spec;
+      if ( !_allow_xor )
+      {
+        spec.set_primitive( percy::AIG );
+      }
+      spec.fanin = 2;
+      spec.verbosity = 0;
+      spec.add_alonce_clauses = _ps.add_alonce_clauses;
+      spec.add_colex_clauses = _ps.add_colex_clauses;
+      spec.add_lex_clauses = _ps.add_lex_clauses;
+      spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
+      spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
+      spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
+      spec.add_symvar_clauses = _ps.add_symvar_clauses;
+      spec.conflict_limit = _ps.conflict_limit;
+      spec[0] = func;
+      if ( !kitty::is_const0( dcs ) )
+      {
+        spec.set_dont_care( 0, dcs );
+      }
+
+      percy::chain c;
+      if ( const auto result = percy::synthesize( spec, c, _ps.solver_type,
+                                                  _ps.encoder_type,
+                                                  _ps.synthesis_method );
+           result != percy::success )
+      {
+        return std::nullopt;
+      }
+      return c;
+    };
+    const bool with_dont_cares = !kitty::is_const0( dont_cares );
 
     auto c = [&]() -> std::optional<percy::chain> {
       if ( !with_dont_cares && _ps.cache )
       {
+        std::lock_guard<std::mutex> lock( _ps.cache->mutex );
         const auto it = _ps.cache->find( function );
         if ( it != _ps.cache->end() )
         {
@@ -311,17 +363,17 @@ public:
         }
       }
 
-      percy::chain c;
-      if ( const auto result = percy::synthesize( spec, c, _ps.solver_type,
-                                                  _ps.encoder_type,
-                                                  _ps.synthesis_method );
-           result != percy::success )
+      auto c = _ps.persistent_cache
+                   ? _ps.persistent_cache->lookup_or_synthesize( ( 2u << 16 ) | ( _allow_xor ? 1u : 0u ), function, ~dont_cares, [&]( auto const& f, auto const& care ) { return synthesize( f, ~care ); } )
+                   : synthesize( function, dont_cares );
+      if ( !c )
       {
         return std::nullopt;
       }
       if ( !with_dont_cares && _ps.cache )
       {
-        ( *_ps.cache )[function] = c;
+        std::lock_guard<std::mutex> lock( _ps.cache->mutex );
+        ( *_ps.cache )[function] = *c;
       }
       return c;
     }();
@@ -361,7 +413,10 @@ public:
       }
     }
 
-    fn( c->is_output_inverted( 0 ) ? !signals.back() : signals.back() );
+    /* the output may point to a constant or an input */
+    const auto output = c->get_outputs()[0];
+    const auto f = ( output >> 1 ) == 0 ? ntk.get_constant( false ) : signals[( output >> 1 ) - 1];
+    fn( ( output & 1 ) ? !f : f );
   }
 
 private:
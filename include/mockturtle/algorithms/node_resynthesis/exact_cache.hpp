@@ -0,0 +1,695 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file exact_cache.hpp
+  \brief Persistent cache for exact synthesis results
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <kitty/bit_operations.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+#include <percy/percy.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+/* inverse of the input transformation in kitty::create_from_npn_config */
+inline kitty::dynamic_truth_table inverse_npn_inputs( kitty::dynamic_truth_table const& tt, uint32_t phase, std::vector<uint8_t> perm )
+{
+  auto res = tt;
+  const auto num_vars = static_cast<uint8_t>( tt.num_vars() );
+
+  for ( auto i = 0u; i < num_vars; ++i )
+  {
+    if ( ( phase >> i ) & 1 )
+    {
+      kitty::flip_inplace( res, i );
+    }
+  }
+
+  std::vector<std::pair<uint8_t, uint8_t>> swaps;
+  for ( uint8_t i = 0u; i < num_vars; ++i )
+  {
+    if ( perm[i] == i )
+    {
+      continue;
+    }
+
+    auto k = i;
+    while ( perm[k] != i )
+    {
+      ++k;
+    }
+
+    swaps.emplace_back( i, k );
+    std::swap( perm[i], perm[k] );
+  }
+
+  for ( auto it = swaps.rbegin(); it != swaps.rend(); ++it )
+  {
+    kitty::swap_inplace( res, it->first, it->second );
+  }
+
+  return res;
+}
+
+/* maps a single-output chain for the representative of an NPN class into a
+   normal chain for the function; if `y[i] = x[perm[i]] ^ phase[perm[i]]`,
+   then the function is the chain applied to `y`, complemented if the phase
+   bit of the output is set */
+inline percy::chain apply_npn_to_chain( percy::chain const& c, uint32_t phase, std::vector<uint8_t> const& perm )
+{
+  const auto nr_in = c.get_nr_inputs();
+
+  percy::chain res;
+  res.reset( nr_in, 1, 0, c.get_fanin() );
+
+  std::vector<bool> inverted( c.get_nr_steps(), false );
+  for ( auto i = 0; i < c.get_nr_steps(); ++i )
+  {
+    auto op = c.get_operator( i );
+    auto fanins = c.get_step( i );
+    for ( auto j = 0u; j < fanins.size(); ++j )
+    {
+      if ( fanins[j] < nr_in )
+      {
+        fanins[j] = perm[fanins[j]];
+        if ( ( phase >> fanins[j] ) & 1 )
+        {
+          kitty::flip_inplace( op, j );
+        }
+      }
+      else if ( inverted[fanins[j] - nr_in] )
+      {
+        kitty::flip_inplace( op, j );
+      }
+    }
+
+    if ( kitty::get_bit( op, 0 ) )
+    {
+      op = ~op;
+      inverted[i] = true;
+    }
+    res.add_step( fanins, op );
+  }
+
+  auto var = c.get_outputs()[0] >> 1;
+  auto inv = ( ( c.get_outputs()[0] & 1 ) ^ ( phase >> nr_in ) ) & 1;
+  if ( var >= 1 && var <= nr_in )
+  {
+    var = perm[var - 1] + 1;
+    inv ^= ( phase >> ( var - 1 ) ) & 1;
+  }
+  else if ( var > nr_in )
+  {
+    inv ^= inverted[var - nr_in - 1] ? 1 : 0;
+  }
+  res.set_output( 0, ( var << 1 ) | inv );
+
+  return res;
+}
+
+} // namespace detail
+
+/*! \brief Persistent cache for exact synthesis results.
+ *
+ * The cache stores optimum chains in an append-only file, such that they can
+ * be reused across runs and by several processes at the same time.  Each
+ * entry is keyed by a domain, which distinguishes the kind of chains (e.g.,
+ * the LUT size or the gate basis), a function, and a care set.  Functions
+ * are stored NPN canonized, and the care set is transformed together with
+ * the function, such that all functions of one NPN class with equally
+ * transformed care sets share the same entry.
+ *
+ * The file starts with a 16-byte header, followed by records.  Each record
+ * consists of its payload size and a checksum, and the payload contains the
+ * key followed by the chain.  The file is mapped into memory and an index
+ * from key hashes to record offsets is built by scanning the records.  Writes
+ * are serialized among processes with an exclusive file lock, and an
+ * incomplete record that is left at the end of the file by an aborted
+ * process is removed before the next record is written.  Records with a
+ * wrong checksum are skipped.  If new entries are not found in the index, the index is
+ * updated with the records that were written by other processes in the
+ * meantime.  On Windows, the file is read into memory instead and the file
+ * is not locked.
+ *
+ * The cache can be used by several threads concurrently.  If the file cannot
+ * be opened, or is not a cache file, all queries are computed and nothing is
+ * stored.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      exact_resynthesis_params ps;
+      ps.persistent_cache = std::make_shared<exact_synthesis_cache>( "exact.cache" );
+      exact_resynthesis<klut_network> resyn( 3, ps );
+      cut_rewriting( klut, resyn );
+   \endverbatim
+ */
+class exact_synthesis_cache
+{
+public:
+  explicit exact_synthesis_cache( std::string const& filename )
+      : _filename( filename )
+  {
+    open();
+  }
+
+  ~exact_synthesis_cache()
+  {
+#ifndef _WIN32
+    if ( _map != nullptr )
+    {
+      munmap( const_cast<char*>( _map ), _map_size );
+    }
+    if ( _fd >= 0 )
+    {
+      ::close( _fd );
+    }
+#endif
+  }
+
+  exact_synthesis_cache( exact_synthesis_cache const& ) = delete;
+  exact_synthesis_cache& operator=( exact_synthesis_cache const& ) = delete;
+
+  /*! \brief Whether the cache file could be opened. */
+  bool is_open() const
+  {
+    return _is_open;
+  }
+
+  /*! \brief Number of entries in the cache. */
+  uint64_t num_entries() const
+  {
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _index.size();
+  }
+
+  /*! \brief Number of queries that were answered from the cache. */
+  uint64_t num_hits() const
+  {
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _hits;
+  }
+
+  /*! \brief Number of queries that required synthesis. */
+  uint64_t num_misses() const
+  {
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _misses;
+  }
+
+  /*! \brief Returns a chain for a function, synthesizing it on a miss.
+   *
+   * The returned chain is normal, i.e., all operators map the all-zero input
+   * to 0, and its output may be complemented; it computes `function` for all
+   * input assignments in `care`.  On a miss, `synthesize` is called with the
+   * canonized function and care set, and must return an
+   * ``std::optional<percy::chain>`` for them.  It is not called while the
+   * cache is locked.
+   */
+  template<class Fn>
+  std::optional<percy::chain> lookup_or_synthesize( uint32_t domain, kitty::dynamic_truth_table const& function, kitty::dynamic_truth_table const& care, Fn&& synthesize )
+  {
+    const auto num_vars = function.num_vars();
+    const auto config = num_vars <= 6 ? kitty::exact_npn_canonization( function & care ) : kitty::sifting_npn_canonization( function & care );
+    const auto phase = std::get<1>( config );
+    auto const& perm = std::get<2>( config );
+
+    const auto canon_care = detail::inverse_npn_inputs( care, phase, perm );
+    const auto canon_function = std::get<0>( config ) & canon_care;
+
+    std::vector<char> record;
+    write_key( record, domain, canon_function, canon_care );
+
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+      auto c = find( record );
+      if ( !c && refresh() )
+      {
+        c = find( record );
+      }
+
+      if ( c )
+      {
+        ++_hits;
+        return detail::apply_npn_to_chain( *c, phase, perm );
+      }
+      ++_misses;
+    }
+
+    const std::optional<percy::chain> c = synthesize( canon_function, canon_care );
+    if ( !c )
+    {
+      return std::nullopt;
+    }
+
+    write_chain( record, *c );
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+      append( record );
+    }
+
+    return detail::apply_npn_to_chain( *c, phase, perm );
+  }
+
+private:
+  static constexpr char magic[8] = {'m', 't', 'e', 'x', 'a', 'c', 't', '1'};
+  static constexpr uint32_t version = 1u;
+  static constexpr uint64_t header_size = 16u;
+  static constexpr uint64_t record_header_size = 8u;
+
+  /* payload layout: domain, number of variables, function words, care words
+     (the key), then number of inputs, fanin size, number of steps, number of
+     outputs, for each step its fanins and operator words, and the outputs */
+  static void write_u32( std::vector<char>& buffer, uint32_t value )
+  {
+    const auto* p = reinterpret_cast<char const*>( &value );
+    buffer.insert( buffer.end(), p, p + sizeof( value ) );
+  }
+
+  static void write_u64( std::vector<char>& buffer, uint64_t value )
+  {
+    const auto* p = reinterpret_cast<char const*>( &value );
+    buffer.insert( buffer.end(), p, p + sizeof( value ) );
+  }
+
+  static uint32_t read_u32( char const*& p )
+  {
+    uint32_t value;
+    std::memcpy( &value, p, sizeof( value ) );
+    p += sizeof( value );
+    return value;
+  }
+
+  static uint64_t read_u64( char const*& p )
+  {
+    uint64_t value;
+    std::memcpy( &value, p, sizeof( value ) );
+    p += sizeof( value );
+    return value;
+  }
+
+  static uint64_t key_size( char const* payload )
+  {
+    uint32_t num_vars;
+    std::memcpy( &num_vars, payload + 4, sizeof( num_vars ) );
+    return 8u + 16u * ( num_vars <= 6u ? 1u : ( 1u << ( num_vars - 6u ) ) );
+  }
+
+  static void write_key( std::vector<char>& buffer, uint32_t domain, kitty::dynamic_truth_table const& function, kitty::dynamic_truth_table const& care )
+  {
+    write_u32( buffer, domain );
+    write_u32( buffer, function.num_vars() );
+    for ( auto const& word : function )
+    {
+      write_u64( buffer, word );
+    }
+    for ( auto const& word : care )
+    {
+      write_u64( buffer, word );
+    }
+  }
+
+  static void write_chain( std::vector<char>& buffer, percy::chain const& c )
+  {
+    write_u32( buffer, c.get_nr_inputs() );
+    write_u32( buffer, c.get_fanin() );
+    write_u32( buffer, c.get_nr_steps() );
+    write_u32( buffer, c.get_nr_outputs() );
+    for ( auto i = 0; i < c.get_nr_steps(); ++i )
+    {
+      for ( auto const& fanin : c.get_step( i ) )
+      {
+        write_u32( buffer, fanin );
+      }
+      for ( auto const& word : c.get_operator( i ) )
+      {
+        write_u64( buffer, word );
+      }
+    }
+    for ( auto const& output : c.get_outputs() )
+    {
+      write_u32( buffer, output );
+    }
+  }
+
+  static percy::chain read_chain( char const* p )
+  {
+    const auto nr_in = read_u32( p );
+    const auto fanin = read_u32( p );
+    const auto nr_steps = read_u32( p );
+    const auto nr_out = read_u32( p );
+
+    percy::chain c;
+    c.reset( nr_in, nr_out, 0, fanin );
+
+    std::vector<int> fanins( fanin );
+    kitty::dynamic_truth_table op( fanin );
+    for ( auto i = 0u; i < nr_steps; ++i )
+    {
+      for ( auto& f : fanins )
+      {
+        f = read_u32( p );
+      }
+      for ( auto& word : op )
+      {
+        word = read_u64( p );
+      }
+      c.add_step( fanins, op );
+    }
+    for ( auto i = 0u; i < nr_out; ++i )
+    {
+      c.set_output( i, read_u32( p ) );
+    }
+
+    return c;
+  }
+
+  static uint64_t hash( char const* data, uint64_t size )
+  {
+    uint64_t h = 0xcbf29ce484222325;
+    for ( auto i = 0u; i < size; ++i )
+    {
+      h = ( h ^ static_cast<uint8_t>( data[i] ) ) * 0x100000001b3;
+    }
+    return h;
+  }
+
+  static uint32_t checksum( char const* data, uint64_t size )
+  {
+    uint32_t h = 0x811c9dc5;
+    for ( auto i = 0u; i < size; ++i )
+    {
+      h = ( h ^ static_cast<uint8_t>( data[i] ) ) * 0x01000193;
+    }
+    return h;
+  }
+
+  /* looks up the key at the beginning of `record` */
+  std::optional<percy::chain> find( std::vector<char> const& record ) const
+  {
+    const auto size = key_size( record.data() );
+    const auto range = _index.equal_range( hash( record.data(), size ) );
+    for ( auto it = range.first; it != range.second; ++it )
+    {
+      const auto* payload = data() + it->second;
+      if ( key_size( payload ) == size && std::memcmp( payload, record.data(), size ) == 0 )
+      {
+        return read_chain( payload + size );
+      }
+    }
+    return std::nullopt;
+  }
+
+  /* indexes all complete records up to `size`, returns true if new records
+     were found; records with a wrong checksum are skipped, and an
+     incomplete record stops the scan */
+  bool scan( uint64_t size )
+  {
+    if ( _end == 0u )
+    {
+      char const* p = data() + sizeof( magic );
+      if ( size < header_size || std::memcmp( data(), magic, sizeof( magic ) ) != 0 || read_u32( p ) != version )
+      {
+        _is_open = false;
+        return false;
+      }
+      _end = header_size;
+    }
+
+    const auto entries = _index.size();
+    while ( _end + record_header_size <= size )
+    {
+      char const* p = data() + _end;
+      const auto payload_size = read_u32( p );
+      const auto sum = read_u32( p );
+      if ( _end + record_header_size + payload_size > size )
+      {
+        break;
+      }
+
+      if ( checksum( p, payload_size ) == sum )
+      {
+        _index.emplace( hash( p, key_size( p ) ), _end + record_header_size );
+      }
+      _end += record_header_size + payload_size;
+    }
+    return _index.size() != entries;
+  }
+
+#ifndef _WIN32
+  char const* data() const
+  {
+    return _map;
+  }
+
+  void open()
+  {
+    _fd = ::open( _filename.c_str(), O_RDWR | O_CREAT, 0644 );
+    if ( _fd < 0 )
+    {
+      return;
+    }
+
+    flock( _fd, LOCK_EX );
+    struct stat st;
+    if ( fstat( _fd, &st ) == 0 && st.st_size == 0 )
+    {
+      std::vector<char> header( magic, magic + sizeof( magic ) );
+      write_u32( header, version );
+      write_u32( header, 0u );
+      _is_open = pwrite( _fd, header.data(), header.size(), 0 ) == static_cast<ssize_t>( header.size() );
+    }
+    else
+    {
+      _is_open = true;
+    }
+    flock( _fd, LOCK_UN );
+
+    if ( _is_open )
+    {
+      refresh();
+    }
+  }
+
+  uint64_t file_size() const
+  {
+    struct stat st;
+    return fstat( _fd, &st ) == 0 ? static_cast<uint64_t>( st.st_size ) : 0u;
+  }
+
+  bool map( uint64_t size )
+  {
+    if ( size <= _map_size )
+    {
+      return true;
+    }
+
+    if ( _map != nullptr )
+    {
+      munmap( const_cast<char*>( _map ), _map_size );
+      _map = nullptr;
+      _map_size = 0u;
+    }
+
+    auto* map = mmap( nullptr, size, PROT_READ, MAP_SHARED, _fd, 0 );
+    if ( map == MAP_FAILED )
+    {
+      _is_open = false;
+      return false;
+    }
+    _map = static_cast<char const*>( map );
+    _map_size = size;
+    return true;
+  }
+
+  bool refresh()
+  {
+    if ( !_is_open )
+    {
+      return false;
+    }
+
+    flock( _fd, LOCK_SH );
+    const auto size = file_size();
+    const auto found = size > _end && map( size ) && scan( size );
+    flock( _fd, LOCK_UN );
+    return found;
+  }
+
+  void append( std::vector<char> const& payload )
+  {
+    if ( !_is_open )
+    {
+      return;
+    }
+
+    flock( _fd, LOCK_EX );
+    auto size = file_size();
+    if ( map( size ) && scan( size ) && find( payload ) )
+    {
+      /* another process has written the entry in the meantime */
+      flock( _fd, LOCK_UN );
+      return;
+    }
+
+    if ( _is_open && size > _end )
+    {
+      /* remove an incomplete record */
+      if ( ftruncate( _fd, _end ) != 0 )
+      {
+        flock( _fd, LOCK_UN );
+        return;
+      }
+      size = _end;
+    }
+
+    std::vector<char> record;
+    write_u32( record, static_cast<uint32_t>( payload.size() ) );
+    write_u32( record, checksum( payload.data(), payload.size() ) );
+    record.insert( record.end(), payload.begin(), payload.end() );
+
+    if ( _is_open && pwrite( _fd, record.data(), record.size(), size ) == static_cast<ssize_t>( record.size() ) )
+    {
+      size += record.size();
+      if ( map( size ) )
+      {
+        scan( size );
+      }
+    }
+    flock( _fd, LOCK_UN );
+  }
+#else
+  char const* data() const
+  {
+    return _buffer.data();
+  }
+
+  void open()
+  {
+    std::ifstream in( _filename, std::ios::binary );
+    if ( !in.good() || in.peek() == std::ifstream::traits_type::eof() )
+    {
+      std::ofstream out( _filename, std::ios::binary | std::ios::trunc );
+      std::vector<char> header( magic, magic + sizeof( magic ) );
+      write_u32( header, version );
+      write_u32( header, 0u );
+      out.write( header.data(), header.size() );
+      _is_open = out.good();
+    }
+    else
+    {
+      _is_open = true;
+    }
+
+    if ( _is_open )
+    {
+      refresh();
+    }
+  }
+
+  bool refresh()
+  {
+    if ( !_is_open )
+    {
+      return false;
+    }
+
+    std::ifstream in( _filename, std::ios::binary );
+    _buffer.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+    return _buffer.size() > _end && scan( _buffer.size() );
+  }
+
+  void append( std::vector<char> const& payload )
+  {
+    if ( !_is_open )
+    {
+      return;
+    }
+
+    std::vector<char> record;
+    write_u32( record, static_cast<uint32_t>( payload.size() ) );
+    write_u32( record, checksum( payload.data(), payload.size() ) );
+    record.insert( record.end(), payload.begin(), payload.end() );
+
+    std::ofstream out( _filename, std::ios::binary | std::ios::app );
+    out.write( record.data(), record.size() );
+    out.close();
+    refresh();
+  }
+#endif
+
+private:
+  std::string _filename;
+  bool _is_open{false};
+
+  mutable std::mutex _mutex;
+  std::unordered_multimap<uint64_t, uint64_t> _index;
+  uint64_t _end{0u};
+  uint64_t _hits{0u};
+  uint64_t _misses{0u};
+
+#ifndef _WIN32
+  int _fd{-1};
+  char const* _map{nullptr};
+  uint64_t _map_size{0u};
+#else
+  std::vector<char> _buffer;
+#endif
+};
+
+} // namespace mockturtle
@@ -0,0 +1,512 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file npn6.hpp
+  \brief Resynthesis with a database of structures for up to 6 inputs
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/static_truth_table.hpp>
+
+#include "../../algorithms/detail/npn_database.hpp"
+#include "../../algorithms/simulation.hpp"
+#include "../../networks/xag.hpp"
+#include "../../traits.hpp"
+#include "../../utils/stopwatch.hpp"
+
+namespace mockturtle
+{
+
+struct npn6_resynthesis_params
+{
+  /*! \brief Be verbose. */
+  bool verbose{false};
+};
+
+struct npn6_resynthesis_stats
+{
+  /*! \brief Time to synthesize structures for database misses. */
+  stopwatch<>::duration time_synthesis{0};
+
+  /*! \brief Number of resynthesized functions. */
+  uint32_t num_lookups{0};
+
+  /*! \brief Number of functions whose class was not in the database. */
+  uint32_t num_misses{0};
+
+  /*! \brief Number of misses for which the fall-back function failed. */
+  uint32_t num_failures{0};
+
+  /*! \brief Number of classes in the database. */
+  uint32_t num_classes{0};
+
+  void report() const
+  {
+    std::cout << fmt::format( "[i] lookups = {}, misses = {} ({} failed), classes = {}\n", num_lookups, num_misses, num_failures, num_classes );
+    std::cout << fmt::format( "[i] synthesis time = {:>5.2f} secs\n", to_seconds( time_synthesis ) );
+  }
+};
+
+/*! \brief Resynthesis function based on a database of structures for up to 6 inputs.
+ *
+ * This resynthesis function can be passed to ``cut_rewriting`` and
+ * ``node_resynthesis`` for functions with up to 6 variables.  Functions are
+ * classified with the sifting NPN heuristic on a single 64-bit word, and the
+ * semi-canonical representative is looked up in a hash table of structures.
+ * Since the heuristic is not exact, NPN-equivalent functions may have
+ * different representatives; a function and its complement always share
+ * theirs.
+ *
+ * If a representative is not in the database, its structure is computed once
+ * on its support with the fall-back resynthesis function and stored, such
+ * that the database fills incrementally.  Pre-computed structures can be
+ * added with ``add_structures``, and the structures of the database,
+ * including the ones found for misses, are the primary outputs of
+ * ``database_network``, which can be written to a file and added again in a
+ * later run.  Copies of the resynthesis function share the database, which
+ * may be accessed concurrently.  Misses are synthesized without locking the
+ * database, but one at a time, such that the fall-back function need not be
+ * thread-safe.
+ *
+ * The database network can be an AIG, XAG, MIG, or XMG, and the network
+ * ``Ntk`` must provide the corresponding gate constructors.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      const xag_network xag = ...;
+
+      shannon_resynthesis<xag_network> shannon;
+      dsd_resynthesis<xag_network, decltype( shannon )> fallback( shannon );
+      npn6_resynthesis<xag_network, xag_network, decltype( fallback )> resyn( fallback );
+
+      cut_rewriting_params ps;
+      ps.cut_enumeration_ps.cut_size = 6;
+      cut_rewriting( xag, resyn, ps );
+      xag = cleanup_dangling( xag );
+   \endverbatim
+ */
+template<class Ntk, class DatabaseNtk, class ResynthesisFn>
+class npn6_resynthesis
+{
+public:
+  explicit npn6_resynthesis( ResynthesisFn& fallback, npn6_resynthesis_params const& ps = {}, npn6_resynthesis_stats* pst = nullptr )
+      : _fallback( fallback ),
+        ps( ps ),
+        _state( std::make_shared<state>() ),
+        _stats( std::make_shared<stats_collector>( ps.verbose, pst ) )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
+    static_assert( has_create_not_v<Ntk>, "Ntk does not implement the create_not method" );
+    if constexpr ( DatabaseNtk::max_fanin_size == 3u )
+    {
+      static_assert( has_create_maj_v<Ntk>, "Ntk does not implement the create_maj method" );
+      static_assert( has_create_xor3_v<Ntk>, "Ntk does not implement the create_xor3 method" );
+    }
+    else
+    {
+      static_assert( has_create_and_v<Ntk>, "Ntk does not implement the create_and method" );
+      static_assert( has_create_xor_v<Ntk>, "Ntk does not implement the create_xor method" );
+    }
+
+    static_assert( is_network_type_v<DatabaseNtk>, "DatabaseNtk is not a network type" );
+    static_assert( has_create_pi_v<DatabaseNtk>, "DatabaseNtk does not implement the create_pi method" );
+    static_assert( has_create_po_v<DatabaseNtk>, "DatabaseNtk does not implement the create_po method" );
+    static_assert( has_clone_node_v<DatabaseNtk>, "DatabaseNtk does not implement the clone_node method" );
+    static_assert( has_foreach_fanin_v<DatabaseNtk>, "DatabaseNtk does not implement the foreach_fanin method" );
+    static_assert( has_node_to_index_v<DatabaseNtk>, "DatabaseNtk does not implement the node_to_index method" );
+  }
+
+  /*! \brief Copy constructor.
+   *
+   * The copy shares the database and the statistics, to which it adds its
+   * own counts when it is destroyed.  The statistics are reported after the
+   * last copy is destroyed.
+   */
+  npn6_resynthesis( npn6_resynthesis const& other )
+      : _fallback( other._fallback ),
+        ps( other.ps ),
+        _state( other._state ),
+        _stats( other._stats )
+  {
+  }
+
+  ~npn6_resynthesis()
+  {
+    uint32_t num_classes;
+    {
+      std::shared_lock lock( _state->mutex );
+      num_classes = _state->entries.num_classes();
+    }
+
+    std::lock_guard<std::mutex> lock( _stats->mutex );
+    auto& st = _stats->st;
+    st.time_synthesis += _time_synthesis;
+    st.num_lookups += _num_lookups;
+    st.num_misses += _num_misses;
+    st.num_failures += _num_failures;
+    st.num_classes = num_classes;
+  }
+
+  /*! \brief Adds the primary outputs of `ntk` as pre-computed structures.
+   *
+   * The network must not have more than 6 primary inputs.  Each output is
+   * stored as a candidate structure for the class of its function.
+   */
+  void add_structures( DatabaseNtk const& ntk )
+  {
+    assert( ntk.num_pis() <= 6u );
+
+    default_simulator<kitty::static_truth_table<6>> sim;
+    const auto functions = simulate<kitty::static_truth_table<6>>( ntk, sim );
+
+    std::unique_lock lock( _state->mutex );
+    auto& db = _state->db;
+    std::vector<signal<DatabaseNtk>> copies( ntk.size() );
+    std::vector<uint32_t> visited( ntk.size(), 0u );
+    uint32_t stamp = 0u;
+    const auto copy = [&]( signal<DatabaseNtk> const& po, uint32_t phase, std::vector<uint8_t> const& perm ) {
+      ++stamp;
+
+      /* input perm[j] of ntk is driven by input j of the representative */
+      for ( auto j = 0u; j < 6u; ++j )
+      {
+        if ( perm[j] < ntk.num_pis() )
+        {
+          const auto index = ntk.node_to_index( ntk.pi_at( perm[j] ) );
+          visited[index] = stamp;
+          copies[index] = db.make_signal( db.pi_at( j ) ) ^ ( ( phase >> perm[j] ) & 1 );
+        }
+      }
+
+      const auto f = copy_cone( ntk, ntk.get_node( po ), copies, visited, stamp );
+      return f ^ ntk.is_complemented( po ) ^ ( ( phase >> 6 ) & 1 );
+    };
+
+    ntk.foreach_po( [&]( auto const& po, auto i ) {
+      const auto [repr, phase, perm] = kitty::sifting_npn_canonization( functions[i] );
+      add_candidate( class_index( *repr.cbegin() ), copy( po, phase, perm ) );
+
+      /* the heuristic is not idempotent, therefore a structure is also stored
+         for its own function, which is a representative if the structure
+         comes from database_network */
+      const auto key = *functions[i].cbegin();
+      if ( key != *repr.cbegin() )
+      {
+        add_candidate( class_index( key ), copy( po, 0u, {0, 1, 2, 3, 4, 5} ), false );
+      }
+    } );
+  }
+
+  /*! \brief Returns the network with all structures of the database.
+   *
+   * The network has 6 primary inputs and one primary output for each
+   * structure.  It must not be accessed while the database is updated.
+   */
+  DatabaseNtk const& database_network() const
+  {
+    return _state->db;
+  }
+
+  template<typename LeavesIterator, typename Fn>
+  void operator()( Ntk& ntk, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn )
+  {
+    assert( function.num_vars() <= 6 );
+    ++_num_lookups;
+
+    const auto [repr, phase, perm] = kitty::sifting_npn_canonization( kitty::extend_to<6>( function ) );
+    const auto index = find_or_synthesize( repr );
+
+    std::array<signal<Ntk>, 6> pis;
+    pis.fill( ntk.get_constant( false ) );
+    std::copy( begin, end, pis.begin() );
+
+    std::array<signal<Ntk>, 6> pis_perm;
+    for ( auto i = 0u; i < 6u; ++i )
+    {
+      pis_perm[i] = pis[perm[i]];
+      if ( ( phase >> perm[i] ) & 1 )
+      {
+        pis_perm[i] = ntk.create_not( pis_perm[i] );
+      }
+    }
+
+    /* the database only grows, therefore candidates can be instantiated one
+       at a time without holding the lock while calling fn */
+    std::vector<signal<Ntk>> signals;
+    for ( auto i = 0u;; ++i )
+    {
+      std::shared_lock lock( _state->mutex );
+      auto const& entries = _state->entries;
+      if ( i == entries.num_candidates( index ) )
+      {
+        return;
+      }
+      const auto f = entries.instantiate( index, i, ( phase >> 6 ) & 1, ntk, pis_perm, signals, []( auto& ntk, auto const& fanins, bool is_xor ) {
+        if constexpr ( DatabaseNtk::max_fanin_size == 3u )
+        {
+          return is_xor ? ntk.create_xor3( fanins[0], fanins[1], fanins[2] ) : ntk.create_maj( fanins[0], fanins[1], fanins[2] );
+        }
+        else
+        {
+          return is_xor ? ntk.create_xor( fanins[0], fanins[1] ) : ntk.create_and( fanins[0], fanins[1] );
+        }
+      } );
+      lock.unlock();
+
+      if ( !fn( f ) )
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  std::optional<uint32_t> find_class( uint64_t key ) const
+  {
+    std::shared_lock lock( _state->mutex );
+    if ( const auto it = _state->classes.find( key ); it != _state->classes.end() )
+    {
+      return it->second;
+    }
+    return std::nullopt;
+  }
+
+  uint32_t find_or_synthesize( kitty::static_truth_table<6> const& repr )
+  {
+    const auto key = *repr.cbegin();
+    if ( const auto index = find_class( key ) )
+    {
+      return *index;
+    }
+
+    /* the fall-back function runs on a scratch network, such that lookups
+       are not blocked, but one class at a time, since it need not be
+       thread-safe */
+    std::lock_guard synthesis_lock( _state->synthesis_mutex );
+    if ( const auto index = find_class( key ) )
+    {
+      return *index;
+    }
+
+    DatabaseNtk scratch;
+    std::vector<signal<DatabaseNtk>> structures;
+    {
+      stopwatch t( _time_synthesis );
+
+      /* synthesize the representative on its support */
+      std::vector<signal<DatabaseNtk>> pis;
+      for ( auto i = 0u; i < 6u; ++i )
+      {
+        pis.push_back( scratch.create_pi() );
+      }
+
+      kitty::dynamic_truth_table func( 6u );
+      *func.begin() = key;
+      const auto support = kitty::min_base_inplace( func );
+      if ( support.empty() )
+      {
+        structures.push_back( scratch.get_constant( kitty::get_bit( repr, 0 ) ) );
+      }
+      else
+      {
+        std::vector<signal<DatabaseNtk>> leaves;
+        for ( auto v : support )
+        {
+          leaves.push_back( pis[v] );
+        }
+
+        _fallback( scratch, kitty::shrink_to( func, static_cast<unsigned>( support.size() ) ), leaves.begin(), leaves.end(), [&]( auto const& f ) {
+          structures.push_back( f );
+          return true;
+        } );
+      }
+    }
+
+    std::unique_lock lock( _state->mutex );
+    if ( const auto it = _state->classes.find( key ); it != _state->classes.end() )
+    {
+      /* added by add_structures in the meantime */
+      return it->second;
+    }
+
+    ++_num_misses;
+    const auto index = class_index( key );
+
+    std::vector<signal<DatabaseNtk>> copies( scratch.size() );
+    std::vector<uint32_t> visited( scratch.size(), 0u );
+    scratch.foreach_pi( [&]( auto const& n, auto i ) {
+      visited[scratch.node_to_index( n )] = 1u;
+      copies[scratch.node_to_index( n )] = _state->db.make_signal( _state->db.pi_at( i ) );
+    } );
+    for ( auto const& f : structures )
+    {
+      add_candidate( index, copy_cone( scratch, scratch.get_node( f ), copies, visited, 1u ) ^ scratch.is_complemented( f ) );
+    }
+    if ( structures.empty() )
+    {
+      ++_num_failures;
+    }
+
+    return index;
+  }
+
+  /* must be called with exclusive access */
+  signal<DatabaseNtk> copy_cone( DatabaseNtk const& ntk, node<DatabaseNtk> const& n, std::vector<signal<DatabaseNtk>>& copies, std::vector<uint32_t>& visited, uint32_t stamp )
+  {
+    const auto index = ntk.node_to_index( n );
+    if ( ntk.is_constant( n ) )
+    {
+      return _state->db.get_constant( ntk.constant_value( n ) );
+    }
+    if ( visited[index] == stamp )
+    {
+      return copies[index];
+    }
+
+    std::vector<signal<DatabaseNtk>> children;
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      const auto child = copy_cone( ntk, ntk.get_node( f ), copies, visited, stamp );
+      children.push_back( ntk.is_complemented( f ) ? !child : child );
+    } );
+
+    visited[index] = stamp;
+    return copies[index] = _state->db.clone_node( ntk, n, children );
+  }
+
+  /* must be called with exclusive access */
+  uint32_t class_index( uint64_t key )
+  {
+    if ( const auto it = _state->classes.find( key ); it != _state->classes.end() )
+    {
+      return it->second;
+    }
+    const auto index = _state->entries.add_class();
+    _state->classes.emplace( key, index );
+    return index;
+  }
+
+  /* must be called with exclusive access */
+  void add_candidate( uint32_t index, signal<DatabaseNtk> const& f, bool create_po = true )
+  {
+    auto const& db = _state->db;
+    _state->entries.add( index, db, f, [&]( auto const& n ) {
+      if constexpr ( DatabaseNtk::max_fanin_size == 3u )
+      {
+        return db.is_xor3( n );
+      }
+      else
+      {
+        return db.is_xor( n );
+      }
+    } );
+    if ( create_po )
+    {
+      _state->db.create_po( f );
+    }
+  }
+
+  struct state
+  {
+    state()
+        : entries( 0u, 6u )
+    {
+      for ( auto i = 0u; i < 6u; ++i )
+      {
+        db.create_pi();
+      }
+    }
+
+    DatabaseNtk db;
+    detail::npn_database entries;
+    std::unordered_map<uint64_t, uint32_t> classes;
+    std::shared_mutex mutex;
+    std::mutex synthesis_mutex;
+  };
+
+  /* statistics of all copies, reported when the last copy is destroyed */
+  struct stats_collector
+  {
+    stats_collector( bool verbose, npn6_resynthesis_stats* pst )
+        : verbose( verbose ),
+          pst( pst )
+    {
+    }
+
+    ~stats_collector()
+    {
+      if ( verbose )
+      {
+        st.report();
+      }
+
+      if ( pst )
+      {
+        *pst = st;
+      }
+    }
+
+    bool verbose;
+    npn6_resynthesis_stats* pst;
+    npn6_resynthesis_stats st;
+    std::mutex mutex;
+  };
+
+  ResynthesisFn& _fallback;
+  npn6_resynthesis_params ps;
+
+  std::shared_ptr<state> _state;
+  std::shared_ptr<stats_collector> _stats;
+
+  std::atomic<uint32_t> _num_lookups{0};
+  uint32_t _num_misses{0};
+  uint32_t _num_failures{0};
+  stopwatch<>::duration _time_synthesis{0};
+};
+
+} /* namespace mockturtle */
@@ -32,28 +32,25 @@
 
 #pragma once
 
-#include <array>
-#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <tuple>
-#include <unordered_map>
+#include <thread>
 #include <vector>
 
-#include <kitty/algorithm.hpp>
 #include <kitty/bit_operations.hpp>
 #include <kitty/constructors.hpp>
-#include <kitty/hash.hpp>
 #include <kitty/operations.hpp>
-#include <kitty/print.hpp>
 #include <kitty/spectral.hpp>
 
-#include "../cleanup.hpp"
-#include "../simulation.hpp"
-#include "../../traits.hpp"
 #include "../../networks/xag.hpp"
+#include "../../traits.hpp"
 #include "../../utils/stopwatch.hpp"
-#include "../../views/cut_view.hpp"
+#include "../detail/minmc_database.hpp"
 
 namespace mockturtle
 {
@@ -74,6 +71,9 @@ struct xag_minmc_resynthesis_params
 
   /*! \brief Verify database when parsing. */
   bool verify_database{false};
+
+  /*! \brief Number of slots in the classification cache. */
+  uint32_t classification_cache_size{1u << 16};
 };
 
 /*! \brief Statistics for xag_minmc_resynthesis. */
@@ -103,6 +103,12 @@ struct xag_minmc_resynthesis_stats
   /*! \brief Number of aborts due to unknown function. */
   uint32_t unknown_function_aborts{0};
 
+  /*! \brief Number of functions classified in batches. */
+  uint32_t presynthesized{0};
+
+  /*! \brief Number of functions in batches rejected by their spectral signature. */
+  uint32_t signature_rejects{0};
+
   /*! \brief Total number of don't cares considered. */
   uint32_t dont_cares{0};
 
@@ -117,6 +123,8 @@ struct xag_minmc_resynthesis_stats
     std::cout << fmt::format( "[i] cache hits     = {:>5}\n", cache_hits );
     std::cout << fmt::format( "[i] cache misses   = {:>5}\n", cache_misses );
     std::cout << fmt::format( "[i] unknown func.  = {:>5}\n", unknown_function_aborts );
+    std::cout << fmt::format( "[i] presynthesized = {:>5}\n", presynthesized );
+    std::cout << fmt::format( "[i] - sig. rejects = {:>5}\n", signature_rejects );
     std::cout << fmt::format( "[i] don't cares    = {:>5}\n", dont_cares );
   }
 };
@@ -126,6 +134,16 @@ struct xag_minmc_resynthesis_stats
  * This resynthesis function can be passed to ``cut_rewriting`` with a cut size
  * of at most 6.  It will produce an XAG based on pre-computed XAGs with a
  * minimum multiplicative complexity.
+ *
+ * The database can be given in text format or in a binary format, which is
+ * mapped into memory and does not need to be parsed; ``write_database``
+ * converts a database into the binary format.  Circuits are only created
+ * when their class is used.  Copies of the resynthesis function share the
+ * database and a lock-free cache of classified functions, and can be used
+ * from different threads.  The statistics of all copies are summed up and
+ * reported when the last copy is destroyed.  ``presynthesize`` classifies
+ * many functions at once and is called by ``cut_rewriting`` with all cut
+ * functions.
  *
    \verbatim embed:rst
 
@@ -149,26 +167,131 @@ public:
    */
   xag_minmc_resynthesis( std::string const& filename, xag_minmc_resynthesis_params const& ps = {}, xag_minmc_resynthesis_stats* pst = nullptr )
       : ps( ps ),
-        pst( pst ),
-        db( std::make_shared<xag_network>() ),
-        db_pis( std::make_shared<decltype( db_pis )::element_type>( 6u ) ),
-        func_mc( std::make_shared<decltype( func_mc )::element_type>() ),
-        classify_cache( std::make_shared<decltype( classify_cache )::element_type>() )
+        db( std::make_shared<detail::minmc_database>() ),
+        classify_cache( std::make_shared<detail::minmc_classification_cache>( ps.classification_cache_size ) ),
+        stats( std::make_shared<stats_collector>( ps.print_stats, pst ) )
   {
     build_db( filename );
   }
 
+  /*! \brief Copy constructor.
+   *
+   * The copy shares the database, the classification cache, and the
+   * statistics collector, but counts its own statistics in `st`, such that
+   * copies can be used from different threads.
+   */
+  xag_minmc_resynthesis( xag_minmc_resynthesis const& other )
+      : ps( other.ps ),
+        db( other.db ),
+        classify_cache( other.classify_cache ),
+        stats( other.stats )
+  {
+  }
+
+  /*! \brief Writes the database in binary format.
+   *
+   * The spectral operations that map each original function into its
+   * representative are computed and stored, such that they are not
+   * recomputed when the binary database is used.
+   */
+  bool write_database( std::string const& filename ) const
+  {
+    return db->write( filename );
+  }
+
+  /*! \brief Number of classes in the database. */
+  uint32_t database_size() const
+  {
+    return db->size();
+  }
+
   virtual ~xag_minmc_resynthesis()
   {
-    if ( ps.print_stats )
+    std::lock_guard<std::mutex> lock( stats->mutex );
+    stats->add( st );
+  }
+
+  /*! \brief Classifies a batch of functions into the classification cache.
+   *
+   * The Walsh spectra of all functions are computed in batches first.
+   * Functions whose spectral signature does not occur in the database are
+   * cached as unknown without classifying them.  The remaining functions are
+   * canonized using `num_threads` threads.
+   */
+  void presynthesize( std::vector<kitty::dynamic_truth_table> const& functions, uint32_t num_threads = 1u )
+  {
+    stopwatch t1( st.time_total );
+    stopwatch t2( st.time_classify );
+
+    std::vector<uint64_t> words;
+    words.reserve( functions.size() );
+    for ( auto const& function : functions )
     {
-      st.report();
+      if ( function.num_vars() <= 6 )
+      {
+        words.push_back( *kitty::extend_to<6>( function ).cbegin() );
+      }
     }
+    std::sort( words.begin(), words.end() );
+    words.erase( std::unique( words.begin(), words.end() ), words.end() );
+
+    const auto signatures = detail::spectral_signatures( words );
+
+    std::vector<uint64_t> pending;
+    for ( auto i = 0u; i < words.size(); ++i )
+    {
+      auto r = std::make_unique<detail::minmc_classification_cache::record>();
+      *r->function.begin() = words[i];
+      if ( classify_cache->find( r->function ) != nullptr )
+      {
+        continue;
+      }
+
+      if ( words[i] == 0u || words[i] == ~uint64_t( 0u ) || db->has_signature( signatures[i] ) )
+      {
+        pending.push_back( words[i] );
+        continue;
+      }
+
+      r->success = true;
+      r->unknown = true;
+      r->repr = r->function;
+      ++st.signature_rejects;
+      classify_cache->insert( r );
+    }
+    st.presynthesized += static_cast<uint32_t>( pending.size() );
+
+    std::atomic<uint32_t> next{0u};
+    std::atomic<uint32_t> aborts{0u};
+    const auto worker = [&]() {
+      for ( auto i = next++; i < pending.size(); i = next++ )
+      {
+        auto r = std::make_unique<detail::minmc_classification_cache::record>();
+        *r->function.begin() = pending[i];
+        const auto spectral = kitty::exact_spectral_canonization_limit( r->function, 100000, [&r]( auto const& ops ) {
+          std::copy( ops.begin(), ops.end(), std::back_inserter( r->operations ) );
+        } );
+        r->repr = spectral.first;
+        r->success = spectral.second;
+        if ( !r->success )
+        {
+          aborts++;
+        }
+        classify_cache->insert( r );
+      }
+    };
 
-    if ( pst )
+    std::vector<std::thread> threads;
+    for ( auto i = 1u; i < std::min<uint32_t>( num_threads, pending.size() ); ++i )
+    {
+      threads.emplace_back( worker );
+    }
+    worker();
+    for ( auto& t : threads )
     {
-      *pst = st;
+      t.join();
     }
+    st.classify_aborts += aborts;
   }
 
   template<typename LeavesIterator, typename Fn>
@@ -225,65 +348,54 @@ public:
     stopwatch t1( st.time_total );
 
     const auto func_ext = kitty::extend_to<6>( function );
-    std::vector<kitty::detail::spectral_operation> trans;
-    kitty::static_truth_table<6> tt_ext;
 
-    const auto cache_it = classify_cache->find( func_ext );
-
-    if ( cache_it != classify_cache->end() )
+    auto const* classification = classify_cache->find( func_ext );
+    std::unique_ptr<detail::minmc_classification_cache::record> uncached;
+    if ( classification != nullptr )
     {
       st.cache_hits++;
-      if ( !std::get<0>( cache_it->second ) )
-      {
-        return; /* quit */
-      }
-      tt_ext = std::get<1>( cache_it->second );
-      trans = std::get<2>( cache_it->second );
     }
     else
     {
       st.cache_misses++;
+      auto r = std::make_unique<detail::minmc_classification_cache::record>();
+      r->function = func_ext;
       const auto spectral = call_with_stopwatch( st.time_classify,
                                                  [&]() { return kitty::exact_spectral_canonization_limit( func_ext, 100000,
-                                                                                                          [&trans]( auto const& ops ) {
+                                                                                                          [&r]( auto const& ops ) {
                                                                                                             std::copy( ops.begin(), ops.end(),
-                                                                                                                       std::back_inserter( trans ) );
+                                                                                                                       std::back_inserter( r->operations ) );
                                                                                                           } ); } );
-      classify_cache->insert( {func_ext, {spectral.second, spectral.first, trans}} );
-      if ( !spectral.second )
+      r->repr = spectral.first;
+      r->success = spectral.second;
+      if ( !r->success )
       {
         st.classify_aborts++;
-        return; /* quit */
       }
-      tt_ext = spectral.first;
-    }
 
-    xag_network::signal circuit;
+      classification = classify_cache->insert( r );
+      if ( classification == nullptr )
+      {
+        /* cache is full */
+        uncached = std::move( r );
+        classification = uncached.get();
+      }
+    }
 
-    auto search = func_mc->find( kitty::to_hex( tt_ext ) );
-    if ( search != func_mc->end() )
+    if ( !classification->success )
     {
-      unsigned int mc{0u};
-      std::string original_f;
-
-      std::tie( original_f, mc, circuit ) = search->second;
-
-      kitty::static_truth_table<6> db_repr;
-      kitty::create_from_hex_string( db_repr, original_f );
-
-      call_with_stopwatch( st.time_classify, [&]() { return kitty::exact_spectral_canonization(
-                                                         db_repr, [&trans]( auto const& ops ) {
-                                                           std::copy( ops.rbegin(), ops.rend(),
-                                                                      std::back_inserter( trans ) );
-                                                         } ); } );
+      return; /* quit */
     }
-    else if ( kitty::is_const0( tt_ext ) )
+
+    if ( classification->unknown )
     {
-      circuit = db->get_constant( false );
+      st.unknown_function_aborts++;
+      return; /* quit */
     }
-    else
+
+    const auto entry = db->find( *classification->repr.cbegin() );
+    if ( !entry && !kitty::is_const0( classification->repr ) )
     {
-      //std::cout << "[w] unknown " << kitty::to_hex( tt_ext ) << " from " << kitty::to_hex( func_ext ) << "\n";
       st.unknown_function_aborts++;
       return; /* quit */
     }
@@ -294,8 +406,7 @@ public:
     std::copy( begin, end, pis.begin() );
 
     stopwatch t2( st.time_construct );
-    for ( auto const& t : trans )
-    {
+    const auto apply = [&]( kitty::detail::spectral_operation const& t ) {
       switch ( t._kind )
       {
       default:
@@ -330,20 +441,16 @@ public:
       }
       break;
       }
-    }
-
-    xag_network::signal output;
+    };
 
-    if ( db->is_constant( db->get_node( circuit ) ) )
+    std::for_each( classification->operations.begin(), classification->operations.end(), apply );
+    if ( entry )
     {
-      output = xag.get_constant( db->is_complemented( circuit ) );
-    }
-    else
-    {
-      cut_view<xag_network> topo{*db, *db_pis, circuit};
-      output = cleanup_dangling( topo, xag, pis.begin(), pis.end() ).front();
+      call_with_stopwatch( st.time_classify, [&]() { db->for_each_operation( *entry, apply ); } );
     }
 
+    auto output = entry ? db->instantiate( *entry, xag, pis ) : xag.get_constant( false );
+
     for ( auto const& g : final_xor )
     {
       output = xag.create_xor( output, g );
@@ -358,112 +465,72 @@ private:
     stopwatch t1( st.time_total );
     stopwatch t2( st.time_parse_db );
 
-    std::generate( db_pis->begin(), db_pis->end(), [&]() { return db->create_pi(); } );
+    if ( !db->load( filename ) )
+    {
+      std::cerr << "[w] could not read database " << filename << "\n";
+      return;
+    }
 
-    std::ifstream file1( filename.c_str(), std::ifstream::in );
-    std::string line;
-    unsigned pos{0u};
+    if ( ps.verify_database )
+    {
+      db->verify();
+    }
+  }
 
-    //std::ofstream db_file( "/tmp/db", std::ofstream::out );
+  /* accumulates the statistics of all copies, which are reported when the
+     last copy is destroyed */
+  struct stats_collector
+  {
+    stats_collector( bool print_stats, xag_minmc_resynthesis_stats* pst )
+        : print_stats( print_stats ),
+          pst( pst )
+    {
+    }
 
-    while ( std::getline( file1, line ) )
+    ~stats_collector()
     {
-      pos = line.find( '\t' );
-      const auto name = line.substr( 0, pos++ );
-      auto original = line.substr( pos, 16u );
-      pos += 17u;
-      const auto token_f = line.substr( pos, 16u );
-      pos += 17u;
-      auto mc = std::stoul( line.substr( pos, 1u ) );
-      pos += 2u;
-      line.erase( 0, pos );
-
-      auto circuit = line;
-      //auto orig_circuit = circuit;
-
-      const std::string delimiter = " ";
-      std::string token = circuit.substr( 0, circuit.find( ' ' ) );
-      circuit.erase( 0, circuit.find( ' ' ) + 1 );
-      const auto inputs = std::stoul( token );
-
-      std::vector<xag_network::signal> hashing_circ( db_pis->begin(), db_pis->begin() + inputs );
-
-      while ( circuit.size() > 4 )
+      if ( print_stats )
       {
-        std::array<unsigned, 2> signals;
-        std::vector<xag_network::signal> ff( 2 );
-        for ( auto j = 0u; j < 2u; j++ )
-        {
-          token = circuit.substr( 0, circuit.find( ' ' ) );
-          circuit.erase( 0, circuit.find( ' ' ) + 1 );
-          signals[j] = std::stoul( token );
-          if ( signals[j] == 0 )
-          {
-            ff[j] = db->get_constant( false );
-          }
-          else if ( signals[j] == 1 )
-          {
-            ff[j] = db->get_constant( true );
-          }
-          else
-          {
-            ff[j] = hashing_circ[signals[j] / 2 - 1] ^ ( signals[j] % 2 != 0 );
-          }
-        }
-        circuit.erase( 0, circuit.find( ' ' ) + 1 );
-
-        if ( signals[0] > signals[1] )
-        {
-          hashing_circ.push_back( db->create_xor( ff[0], ff[1] ) );
-        }
-        else
-        {
-          hashing_circ.push_back( db->create_and( ff[0], ff[1] ) );
-        }
+        st.report();
       }
 
-      const auto output = std::stoul( circuit );
-      const auto f = hashing_circ[output / 2 - 1] ^ ( output % 2 != 0 );
-      db->create_po( f );
-
-      /* verify */
-      if (ps.verify_database)
+      if ( pst )
       {
-        cut_view<xag_network> view{*db, *db_pis, f};
-        kitty::static_truth_table<6> tt, tt_repr;
-        kitty::create_from_hex_string( tt, original );
-        kitty::create_from_hex_string( tt_repr, token_f );
-        auto result = simulate<kitty::static_truth_table<6>>( view )[0];
-        if ( tt != result )
-        {
-          std::cerr << "[w] invalid circuit for " << original << ", got " << kitty::to_hex( result ) << "\n";
-          original = kitty::to_hex( result );
-
-          const auto repr = exact_spectral_canonization(tt);
-          if ( repr != tt_repr )
-          {
-            std::cerr << "[e] representatives do not match\n";
-          }
-        }
-
-        //db_file << name << "\t" << token_f << "\t" << original << "\t" << mc << "\t" << orig_circuit << "\n";
+        *pst = st;
       }
+    }
 
-      func_mc->insert( {token_f, {original, mc, f}} );
+    void add( xag_minmc_resynthesis_stats const& other )
+    {
+      st.time_total += other.time_total;
+      st.time_parse_db += other.time_parse_db;
+      st.time_classify += other.time_classify;
+      st.time_construct += other.time_construct;
+      st.cache_hits += other.cache_hits;
+      st.cache_misses += other.cache_misses;
+      st.classify_aborts += other.classify_aborts;
+      st.unknown_function_aborts += other.unknown_function_aborts;
+      st.presynthesized += other.presynthesized;
+      st.signature_rejects += other.signature_rejects;
+      st.dont_cares += other.dont_cares;
     }
-  }
+
+    std::mutex mutex;
+    xag_minmc_resynthesis_stats st;
+    bool print_stats;
+    xag_minmc_resynthesis_stats* pst;
+  };
 
 public:
   xag_minmc_resynthesis_params ps;
+
+  /*! \brief Statistics of this copy. */
   xag_minmc_resynthesis_stats st;
 
 private:
-  xag_minmc_resynthesis_stats *pst{nullptr};
-
-  std::shared_ptr<xag_network> db;
-  std::shared_ptr<std::vector<xag_network::signal>> db_pis;
-  std::shared_ptr<std::unordered_map<std::string, std::tuple<std::string, unsigned, xag_network::signal>>> func_mc;
-  std::shared_ptr<std::unordered_map<kitty::static_truth_table<6>, std::tuple<bool, kitty::static_truth_table<6>, std::vector<kitty::detail::spectral_operation>>, kitty::hash<kitty::static_truth_table<6>>>> classify_cache;
+  std::shared_ptr<detail::minmc_database> db;
+  std::shared_ptr<detail::minmc_classification_cache> classify_cache;
+  std::shared_ptr<stats_collector> stats;
 };
 
 } // namespace mockturtle
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -43,10 +44,12 @@
 #include <kitty/print.hpp>
 #include <kitty/static_truth_table.hpp>
 
+#include "../../algorithms/detail/npn_database.hpp"
 #include "../../algorithms/simulation.hpp"
 #include "../../io/write_bench.hpp"
 #include "../../networks/xag.hpp"
 #include "../../utils/node_map.hpp"
+#include "../../utils/npn4_table.hpp"
 #include "../../utils/stopwatch.hpp"
 
 namespace mockturtle
@@ -79,6 +82,10 @@ struct xag_npn_resynthesis_stats
  * produce a network based on pre-computed XAGs with up to at most 4 variables.
  * Consequently, the nodes' fan-in sizes in the input network must not exceed
  * 4.
+ *
+ * The database is built once from compiled-in arrays and shared by all
+ * instances with the same database network type, such that constructing the
+ * resynthesis function is cheap.
  *
    \verbatim embed:rst
 
@@ -102,8 +109,7 @@ class xag_npn_resynthesis
 public:
   xag_npn_resynthesis( xag_npn_resynthesis_params const& ps = {}, xag_npn_resynthesis_stats* pst = nullptr )
       : ps( ps ),
-        pst( pst ),
-        _classes( 1 << 16 )
+        pst( pst )
   {
     static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
     static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
@@ -122,8 +128,8 @@ public:
     static_assert( has_foreach_fanin_v<DatabaseNtk>, "DatabaseNtk does not implement the foreach_fanin method" );
     static_assert( has_foreach_node_v<DatabaseNtk>, "DatabaseNtk does not implement the foreach_node method" );
     static_assert( has_make_signal_v<DatabaseNtk>, "DatabaseNtk does not implement the make_signal method" );
+    static_assert( has_node_to_index_v<DatabaseNtk>, "DatabaseNtk does not implement the node_to_index method" );
 
-    _repr.reserve( 222u );
     build_classes();
     build_db();
   }
@@ -145,54 +151,40 @@ public:
   void operator()( Ntk& ntk, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn )
   {
     kitty::static_truth_table<4> tt = kitty::extend_to<4>( function );
-
-    /* get representative of function */
-    const auto repr = _repr[_classes[*tt.cbegin()]];
+    const auto func = static_cast<uint16_t>( *tt.cbegin() );
 
     /* check if representative has circuits */
-    const auto it = _repr_to_signal.find( repr );
-    if ( it == _repr_to_signal.end() )
+    auto const& entries = _database->entries;
+    const auto class_index = _npn->class_index( func );
+    const auto num_candidates = entries.num_candidates( class_index );
+    if ( num_candidates == 0u )
     {
       return;
     }
 
-    const auto config = kitty::exact_npn_canonization( tt );
-
-    assert( repr == std::get<0>( config ) );
-
-    std::vector<signal<Ntk>> pis( 4, ntk.get_constant( false ) );
+    std::array<signal<Ntk>, 4> pis;
+    pis.fill( ntk.get_constant( false ) );
     std::copy( begin, end, pis.begin() );
 
-    std::vector<signal<Ntk>> pis_perm;
-    auto perm = std::get<2>( config );
-    for ( auto i = 0; i < 4; ++i )
-    {
-      pis_perm.push_back( pis[perm[i]] );
-    }
-
-    const auto& phase = std::get<1>( config );
+    const auto phase = _npn->phase( func );
+    auto const& perm = _npn->perm( func );
+    std::array<signal<Ntk>, 4> pis_perm;
     for ( auto i = 0; i < 4; ++i )
     {
+      pis_perm[i] = pis[perm[i]];
       if ( ( phase >> perm[i] ) & 1 )
       {
         pis_perm[i] = ntk.create_not( pis_perm[i] );
       }
     }
 
-    for ( auto const& cand : it->second )
+    std::vector<signal<Ntk>> signals;
+    signals.reserve( 5u + entries.max_gates() );
+    for ( auto i = 0u; i < num_candidates; ++i )
     {
-      std::unordered_map<node<DatabaseNtk>, signal<Ntk>> db_to_ntk;
-
-      db_to_ntk.insert( {0, ntk.get_constant( false )} );
-      for ( auto i = 0; i < 4; ++i )
-      {
-        db_to_ntk.insert( {i + 1, pis_perm[i]} );
-      }
-      auto f = copy_db_entry( ntk, _db.get_node( cand ), db_to_ntk );
-      if ( _db.is_complemented( cand ) != ( ( phase >> 4 ) & 1 ) )
-      {
-        f = ntk.create_not( f );
-      }
+      const auto f = entries.instantiate( class_index, i, ( phase >> 4 ) & 1, ntk, pis_perm, signals, []( auto& ntk, auto const& fanins, bool is_xor ) {
+        return is_xor ? ntk.create_xor( fanins[0], fanins[1] ) : ntk.create_and( fanins[0], fanins[1] );
+      } );
       if ( !fn( f ) )
       {
         return;
@@ -201,62 +193,42 @@ public:
   }
 
 private:
-  signal<Ntk>
-  copy_db_entry( Ntk& ntk, node<DatabaseNtk> const& n, std::unordered_map<node<DatabaseNtk>, signal<Ntk>>& db_to_ntk ) const
+  void build_classes()
   {
-    if ( const auto it = db_to_ntk.find( n ); it != db_to_ntk.end() )
-    {
-      return it->second;
-    }
-
-    std::vector<signal<Ntk>> fanin;
-    //std::array<signal<Ntk>, 2> fanin;
-    _db.foreach_fanin( n, [&]( auto const& f ) {
-      auto ntk_f = copy_db_entry( ntk, _db.get_node( f ), db_to_ntk );
-      if ( _db.is_complemented( f ) )
-      {
-        ntk_f = ntk.create_not( ntk_f );
-      }
-      fanin.push_back( ntk_f );
-    } );
-
-    const auto f = _db.is_xor( n ) ? ntk.create_xor( fanin[0], fanin[1] ) : ntk.create_and( fanin[0], fanin[1] );
-    db_to_ntk.insert( {n, f} );
-    return f;
+    stopwatch t( st.time_classes );
+    _npn = &npn4_transforms();
   }
 
-  void build_classes()
+  void build_db()
   {
-    stopwatch t( st.time_classes );
+    stopwatch t( st.time_db );
+    _database = &database();
 
-    kitty::dynamic_truth_table map( 16u );
-    std::transform( map.cbegin(), map.cend(), map.begin(), []( auto word ) { return ~word; } );
+    st.db_size = _database->db_size;
+    st.covered_classes = _database->entries.num_covered_classes();
+  }
 
-    int64_t index = 0;
-    kitty::static_truth_table<4> tt;
-    while ( index != -1 )
-    {
-      kitty::create_from_words( tt, &index, &index + 1 );
-      const auto res = kitty::exact_npn_canonization( tt, [&]( const auto& tt ) {
-        _classes[*tt.cbegin()] = _repr.size();
-        kitty::clear_bit( map, *tt.cbegin() );
-      } );
-      _repr.push_back( std::get<0>( res ) );
+  struct database_t
+  {
+    detail::npn_database entries;
+    uint32_t db_size;
+  };
 
-      /* find next non-classified truth table */
-      index = find_first_one_bit( map );
-    }
+  static database_t const& database()
+  {
+    static const database_t db = make_database();
+    return db;
   }
 
-  void build_db()
+  static database_t make_database()
   {
-    stopwatch t( st.time_db );
+    DatabaseNtk db;
 
     /* four primary inputs */
-    _db.create_pi();
-    _db.create_pi();
-    _db.create_pi();
-    _db.create_pi();
+    db.create_pi();
+    db.create_pi();
+    db.create_pi();
+    db.create_pi();
 
     auto* p = subgraphs;
     while ( true )
@@ -270,66 +242,49 @@ private:
       auto is_xor = entry0 & 1;
       entry0 >>= 1;
 
-      const auto child0 = _db.make_signal( entry0 >> 1 ) ^ ( entry0 & 1 );
-      const auto child1 = _db.make_signal( entry1 >> 1 ) ^ ( entry1 & 1 );
+      const auto child0 = db.make_signal( entry0 >> 1 ) ^ ( entry0 & 1 );
+      const auto child1 = db.make_signal( entry1 >> 1 ) ^ ( entry1 & 1 );
 
       if ( is_xor )
       {
-        _db.create_xor( child0, child1 );
+        db.create_xor( child0, child1 );
       }
       else
       {
-        _db.create_and( child0, child1 );
+        db.create_and( child0, child1 );
       }
     }
 
-    const auto sim_res = simulate_nodes<kitty::static_truth_table<4>>( _db );
+    const auto sim_res = simulate_nodes<kitty::static_truth_table<4>>( db );
 
-    _db.foreach_node( [&]( auto n ) {
-      if ( _repr[_classes[*sim_res[n].cbegin()]] == sim_res[n] )
+    auto const& npn = npn4_transforms();
+    database_t database{detail::npn_database( npn.num_classes() ), db.size()};
+    const auto is_xor = [&]( auto const& n ) { return db.is_xor( n ); };
+    db.foreach_node( [&]( auto n ) {
+      const auto func = static_cast<uint16_t>( *sim_res[n].cbegin() );
+      const auto index = npn.class_index( func );
+      if ( npn.representative( index ) == func )
       {
-        if ( _repr_to_signal.count( sim_res[n] ) == 0 )
-        {
-          _repr_to_signal.insert( {sim_res[n], {_db.make_signal( n )}} );
-        }
-        else
-        {
-          _repr_to_signal[sim_res[n]].push_back( _db.make_signal( n ) );
-        }
+        database.entries.add( index, db, db.make_signal( n ), is_xor );
       }
-      else
+      else if ( npn.representative( index ) == static_cast<uint16_t>( ~func ) )
       {
-        const auto f = ~sim_res[n];
-        if ( _repr[_classes[*f.cbegin()]] == f )
-        {
-          if ( _repr_to_signal.count( f ) == 0 )
-          {
-            _repr_to_signal.insert( {f, {!_db.make_signal( n )}} );
-          }
-          else
-          {
-            _repr_to_signal[f].push_back( !_db.make_signal( n ) );
-          }
-        }
+        database.entries.add( index, db, !db.make_signal( n ), is_xor );
       }
     } );
 
-    st.db_size = _db.size();
-    st.covered_classes = _repr_to_signal.size();
+    return database;
   }
 
   xag_npn_resynthesis_params ps;
   xag_npn_resynthesis_stats st;
   xag_npn_resynthesis_stats* pst{nullptr};
 
-  std::vector<kitty::static_truth_table<4>> _repr;
-  std::vector<uint8_t> _classes;
-  std::unordered_map<kitty::static_truth_table<4>, std::vector<signal<DatabaseNtk>>, kitty::hash<kitty::static_truth_table<4>>> _repr_to_signal;
-
-  DatabaseNtk _db;
+  npn4_table const* _npn{nullptr};
+  database_t const* _database{nullptr};
 
   // clang-format off
-  inline static const uint16_t subgraphs[]
+  inline static constexpr uint16_t subgraphs[]
   {
     0x0008,0x0002, 0x000a,0x0002, 0x0008,0x0003, 0x000a,0x0003, 0x0009,0x0002,
     0x000c,0x0002, 0x000e,0x0002, 0x000c,0x0003, 0x000e,0x0003, 0x000d,0x0002,
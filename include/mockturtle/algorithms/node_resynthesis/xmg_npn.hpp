@@ -30,23 +30,22 @@
   \author Zhufei Chu
 */
 
+
 #pragma once
 
-#include <iostream>
-#include <sstream>
-#include <stack>
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
 #include <vector>
 
 #include <kitty/dynamic_truth_table.hpp>
-#include <kitty/npn.hpp>
-#include <kitty/print.hpp>
+#include <kitty/operations.hpp>
 
-#include "../../algorithms/cleanup.hpp"
-#include "../../io/write_bench.hpp"
+#include "../../algorithms/detail/npn_database.hpp"
 #include "../../networks/xmg.hpp"
 #include "../../traits.hpp"
-#include "../../views/topo_view.hpp"
+#include "../../utils/npn4_table.hpp"
 
 namespace mockturtle
 {
@@ -58,6 +57,9 @@ namespace mockturtle
  * pre-computed size-optimum XMGs with up to at most 4 variables.
  * Consequently, the nodes' fan-in sizes in the input network must not exceed
  * 4.
+ *
+ * The database is built once from compiled-in arrays and shared by all
+ * instances, such that constructing the resynthesis function is cheap.
  *
    \verbatim embed:rst
 
@@ -77,8 +79,8 @@ public:
    *
    */
   xmg_npn_resynthesis()
+      : _database( &database() )
   {
-    build_db();
   }
 
   template<typename LeavesIterator, typename Fn>
@@ -86,39 +88,37 @@ public:
   {
     assert( function.num_vars() <= 4 );
     const auto fe = kitty::extend_to( function, 4 );
-    const auto config = kitty::exact_npn_canonization( fe );
-
-    auto func_str = "0x" + kitty::to_hex( std::get<0>( config ) );
-    const auto it = class2signal.find( func_str );
-    assert( it != class2signal.end() );
-
-    //const auto it = class2signal.find( static_cast<uint16_t>( std::get<0>( config )._bits[0] ) );
+    const auto func = static_cast<uint16_t>( *fe.cbegin() );
 
-    std::vector<xmg_network::signal> pis( 4, xmg.get_constant( false ) );
+    std::array<xmg_network::signal, 4> pis;
+    pis.fill( xmg.get_constant( false ) );
     std::copy( begin, end, pis.begin() );
 
-    std::vector<xmg_network::signal> pis_perm( 4 );
-    auto perm = std::get<2>( config );
+    auto const& npn = npn4_transforms();
+    const auto phase = npn.phase( func );
+    auto const& perm = npn.perm( func );
+    std::array<xmg_network::signal, 4> pis_perm;
     for ( auto i = 0; i < 4; ++i )
     {
       pis_perm[i] = pis[perm[i]];
-    }
-
-    const auto& phase = std::get<1>( config );
-    for ( auto i = 0; i < 4; ++i )
-    {
       if ( ( phase >> perm[i] ) & 1 )
       {
         pis_perm[i] = !pis_perm[i];
       }
     }
 
-    for ( auto const& po : it->second )
+    auto const& entries = _database->entries;
+    const auto class_index = npn.class_index( func );
+
+    std::vector<xmg_network::signal> signals;
+    signals.reserve( 5u + entries.max_gates() );
+    for ( auto i = 0u; i < entries.num_candidates( class_index ); ++i )
     {
-      topo_view topo{db, po};
-      auto f = cleanup_dangling( topo, xmg, pis_perm.begin(), pis_perm.end() ).front();
+      const auto f = entries.instantiate( class_index, i, ( phase >> 4 ) & 1, xmg, pis_perm, signals, []( auto& ntk, auto const& fanins, bool is_xor ) {
+        return is_xor ? ntk.create_xor3( fanins[0], fanins[1], fanins[2] ) : ntk.create_maj( fanins[0], fanins[1], fanins[2] );
+      } );
 
-      if ( !fn( ( ( phase >> 4 ) & 1 ) ? !f : f ) )
+      if ( !fn( f ) )
       {
         return; /* quit */
       }
@@ -126,164 +126,70 @@ public:
   }
 
 private:
-  std::unordered_map<std::string, std::string> opt_xmgs;
-
-  inline std::vector<std::string> split( const std::string& str, const std::string& sep )
+  struct database_t
   {
-    std::vector<std::string> result;
-
-    size_t last = 0;
-    size_t next = 0;
-    while ( ( next = str.find( sep, last ) ) != std::string::npos )
-    {
-      result.push_back( str.substr( last, next - last ) );
-      last = next + 1;
-    }
-    result.push_back( str.substr( last ) );
-
-    return result;
-  }
+    detail::npn_database entries;
+  };
 
-  void load_optimal_xmgs( const unsigned& strategy )
+  static database_t const& database()
   {
-    std::vector<std::string> result;
-
-    switch ( strategy )
-    {
-    case 1:
-      result = split( npn4_s, "\n" );
-      break;
-
-    case 2:
-      result = split( npn4_sd, "\n" );
-      break;
-
-    case 3:
-      result = split( npn4_ds, "\n" );
-      break;
-
-    default:
-      break;
-    }
-
-    for ( auto record : result )
-    {
-      auto p = split( record, " " );
-      assert( p.size() == 2u );
-      opt_xmgs.insert( std::make_pair( p[0], p[1] ) );
-    }
+    static const database_t db = build_db();
+    return db;
   }
 
-  std::vector<xmg_network::signal> create_xmg_from_str( const std::string& str, const std::vector<xmg_network::signal>& signals )
+  /* nodes: number of inputs, number of outputs, output literals, and then
+     for each gate three fanin literals, in which the first one is shifted
+     by one bit to make space for a flag that is set for XOR gates */
+  static database_t build_db()
   {
-    auto sig = signals;
-    std::vector<xmg_network::signal> result;
-
-    std::stack<int> polar;
-    std::stack<xmg_network::signal> inputs;
+    database_t database{detail::npn_database( npn4_transforms().num_classes() )};
+    xmg_network db;
 
-    for ( auto i = 0ul; i < str.size(); i++ )
-    {
-      // operators polarity
-      if ( str[i] == '[' || str[i] == '<' )
-      {
-        polar.push( i > 0 && str[i - 1] == '!' ? 1 : 0 );
-      }
-
-      //input signals
-      if ( str[i] >= 'a' && str[i] <= 'd' )
-      {
-        inputs.push( sig[str[i] - 'a' + 1] );
-
-        polar.push( i > 0 && str[i - 1] == '!' ? 1 : 0 );
-      }
-      else if ( str[i] == '0' )
-      {
-        inputs.push( sig[0] );
-
-        polar.push( i > 0 && str[i - 1] == '!' ? 1 : 0 );
-      }
-
-      //create signals
-      if ( str[i] == '>' )
-      {
-        assert( inputs.size() >= 3u );
-        auto x1 = inputs.top();
-        inputs.pop();
-        auto x2 = inputs.top();
-        inputs.pop();
-        auto x3 = inputs.top();
-        inputs.pop();
-
-        assert( polar.size() >= 4u );
-        auto p1 = polar.top();
-        polar.pop();
-        auto p2 = polar.top();
-        polar.pop();
-        auto p3 = polar.top();
-        polar.pop();
-
-        auto p4 = polar.top();
-        polar.pop();
-
-        inputs.push( db.create_maj( x1 ^ p1, x2 ^ p2, x3 ^ p3 ) ^ p4 );
-        polar.push( 0 );
-      }
-
-      if ( str[i] == ']' )
-      {
-        assert( inputs.size() >= 2u );
-        auto x1 = inputs.top();
-        inputs.pop();
-        auto x2 = inputs.top();
-        inputs.pop();
-
-        assert( polar.size() >= 3u );
-        auto p1 = polar.top();
-        polar.pop();
-        auto p2 = polar.top();
-        polar.pop();
-
-        auto p3 = polar.top();
-        polar.pop();
-
-        inputs.push( db.create_xor( x1 ^ p1, x2 ^ p2 ) ^ p3 );
-        polar.push( 0 );
-      }
-    }
-
-    assert( !polar.empty() );
-    auto po = polar.top();
-    polar.pop();
-    db.create_po( inputs.top() ^ po );
-    result.push_back( inputs.top() ^ po );
-    return result;
-  }
-
-  void build_db()
-  {
     std::vector<xmg_network::signal> signals;
     signals.push_back( db.get_constant( false ) );
 
-    for ( auto i = 0u; i < 4; ++i )
+    const auto* p = std::begin( nodes );
+    for ( auto i = 0u; i < *p; ++i )
     {
       signals.push_back( db.create_pi() );
     }
 
-    load_optimal_xmgs( 1 ); //size optimization
+    p++;         /* point to number of outputs */
+    p += *p + 1; /* move past number of output */
+
+    /* create nodes */
+    while ( p != std::end( nodes ) )
+    {
+      const auto is_xor = *p & 1;
+      const auto c1 = signals[*p >> 2] ^ ( ( *p >> 1 ) & 1 );
+      ++p;
+      const auto c2 = signals[*p >> 1] ^ ( *p & 1 );
+      ++p;
+      const auto c3 = signals[*p >> 1] ^ ( *p & 1 );
+      ++p;
+
+      signals.push_back( is_xor ? db.create_xor3( c1, c2, c3 ) : db.create_maj( c1, c2, c3 ) );
+    }
 
-    for ( const auto e : opt_xmgs )
+    /* add candidates */
+    p = std::begin( nodes ) + 2;
+    for ( auto i = 0u; i < nodes[1]; ++i )
     {
-      class2signal.insert( std::make_pair( e.first, create_xmg_from_str( e.second, signals ) ) );
+      const auto driver = signals[*p >> 1] ^ ( *p & 1 );
+      ++p;
+
+      database.entries.add( npn4_transforms().class_index( classes[i] ), db, driver, [&]( auto const& n ) { return db.is_xor3( n ); } );
     }
+
+    return database;
   }
 
-  xmg_network db;
-  std::unordered_map<std::string, std::vector<xmg_network::signal>> class2signal;
+  database_t const* _database;
 
-  std::string npn4_s = "0x3cc3 [d[!bc]]\n0x1bd8 [!<ac!d>!<a!bd>]\n0x19e3 [[!<!0a!c><!bc<!0a!c>>]<ad!<!0a!c>>]\n0x19e1 [<ac[!bc]><d[!bc]<a!b!<ac[!bc]>>>]\n0x17e8 [d<abc>]\n0x179a <[!a<!0b!c>][ad]!<abc>>\n0x178e [!d<!a!b[cd]>]\n0x16e9 [![!d<!0ab>]!<!0c<abc>>]\n0x16bc [[!c<0ad>]<a!b<!0!ac>>]\n0x16ad <!d<ad!<0!b!c>>!<ac!<0!bd>>>\n0x16ac [<acd>!<!b!d<!a[!bc]<acd>>>]\n0x16a9 <!<!0!bc>!<d!<!0!bc>![ac]><d<!b!d<!0!bc>>![ac]>>\n0x169e <[bc][a[bc]]<!c!d[a[bc]]>>\n0x169b [<c[!ab]<!b!cd>><a!cd>]\n0x169a <![!bc]<0a[!bc]>[a<cd![!bc]>]>\n0x1699 <<!a!b<0!cd>><ad!<0!cd>>!<!bd<ad!<0!cd>>>>\n0x1687 [!a!<b<!0!b<a!bd>>![c<a!bd>]>]\n0x167e <b!<bd[!ac]>[<bd[!ac]><ac![!ac]>]>\n0x166e [<cd<0ab>>!<!a!b<0ab>>]\n0x03cf <!c!d![bc]>\n0x166b <!c[a<bcd>]<!bc!d>>\n0x01be <!d!<!0b!<!bcd>><b!c![a<!0b!<!bcd>>]>>\n0x07f2 <!d![!cd]<!bd[ab]>>\n0x07e9 [<bc<!0a!b>><!ad<!0a!b>>]\n0x6996 [b[a[cd]]]\n0x01af <a!<0d<abd>>!<!0ac>>\n0x033c <!<!0bd>[c<!0bd>]![!bd]>\n0x07e3 <!c[!c<ab!d>]<!b!d[!c<ab!d>]>>\n0x1681 <<!b!cd>!<!0!a<!b!cd>>![[!ab]<!bc!d>]>\n0x01ae [!d<0<!a!bc>!<acd>>]\n0x07e2 [<!a!bd>!<!cd<0b!<!a!bd>>>]\n0x01ad [<!0c!<a!bd>><!acd>]\n0x07e1 [!<!a!bd>!<0c!<!cd!<!a!bd>>>]\n0x001f <!d<0!a!b><0!c!<0!a!b>>>\n0x01ac [<!0bc><d<!acd><!0bc>>]\n0x07e0 [d<cd<ab!d>>]\n0x07bc [<!0d!<!0a!b>><bc<!0a!b>>]\n0x03dc <b[!d<0!b!c>]!<ab!<0!b!c>>>\n0x06f6 <!d[cd][ab]>\n0x06bd [<c<a!bd>!<a!b!d>><!0d!<a!bd>>]\n0x077e <!<bcd><b![!cd]!<bcd>>[a<bcd>]>\n0x06b9 <!<ad<0!b!c>><a!b!d><0!cd>>\n0x06b7 <!d!<bc![!ac]>![b[!ac]]>\n0x06b6 <!<!0a!b><a!bc>!<0c!<0!d<a!bc>>>>\n0x077a [<bcd>!<0!a<b!c!d>>]\n0x06b5 [<a!d[ac]>!<cd<!b![ac]<a!d[ac]>>>]\n0x0ff0 [cd]\n0x0779 [<cd<ab!c>><!0!<ab!c><abc>>]\n0x06b4 [c<d![!ab]<!abc>>]\n0x0778 <!b<b!d!<!0a!b>>[c<bd<!0a!b>>]>\n0x007f <!d<0!ab>!<bc<0!ab>>>\n0x06b3 <!a<a!b!d><[cd][!bd]<a!b!d>>>\n0x007e <0!d![a<a!b!c>]>\n0x06b2 <a<!a!d[ab]>[d<cd![ab]>]>\n0x0776 <[ab]!<abd>[cd]>\n0x06b1 [!d!<c<!0!bd>![ab]>]\n0x06b0 [d<c[!ab]<ad<!0cd>>>]\n0x037c <d[d<!0bc>]!<ad<bcd>>>\n0x01ef <!c!d[d<!0ab>]>\n0x0696 <b<a!b!<!0!cd>>!<abc>>\n0x035e [!<0!a!d>!<0!c!<bd<0!a!d>>>]\n0x0678 <!<!abd>[c<abd>]!<!0a!b>>\n0x0676 <!<!0!cd>!<abc>[ab]>\n0x0669 [!d!<b<a!b<!0!cd>>!<ab!c>>]\n0x01bc [<0!b!c><!c!d<a!b!d>>]\n0x0663 [!<!acd><0b<b!c!d>>]\n0x07f0 <0[cd]<!b!<0ad>[cd]>>\n0x01bf <!b!d!<!bc![ad]>>\n0x0666 <0[ab]!<0cd>>\n0x0661 [<ab!c><b!d<!0a<a!b!c>>>]\n0x1689 [!<0d![ab]><c[ab]!<abd>>]\n0x0660 <0![!cd][ab]>\n0x0182 [!<!ab!c><!bd!<!0!c<!ab!c>>>]\n0x07b6 [c<d!<0!c[!ab]>!<ac[!ab]>>]\n0x03d7 <!d![bc]!<abc>>\n0x06f1 <c<a!c<!ab!d>><!b<!ab!d>![d<a!c<!ab!d>>]>>\n0x03dd <!<a!bd>!<!0bc>![!d<!0bc>]>\n0x0180 [!<!bc!d>!<!a!b<!bc!d>>]\n0x07b4 [<a!d![bd]>!<0c!<0d<a!d![bd]>>>]\n0x03db <!d<0!b!c>[a<!a!bc>]>\n0x07b0 <!<!0a!d>[cd]<a!b!d>>\n0x03d4 [d<bc<!0!ad>>]\n0x03c7 <[!bc]<0!a!c>!<0bd>>\n0x03c6 <!d!<!0c!d>[b<a!c!<!0c!d>>]>\n0x03c5 [!<bcd>!<!ad!<0c!d>>]\n0x03c3 <!c!<b!cd>![bc]>\n0x03c1 <!a[b<b!cd>]!<c<b!cd>![b<b!cd>]>>\n0x03c0 [d<bcd>]\n0x1798 [<!a!b<ab!c>><0!d<!c!d<ab!c>>>]\n0x036f <!c!d[b<!0ad>]>\n0x03fc [d!<0!b!c>]\n0x1698 <!<abc><0!d<abd>><!0c<abd>>>\n0x177e [!<0!a!c><bd![ac]>]\n0x066f <!c!d[ab]>\n0x035b <!<acd>!<0b!c><0a!c>>\n0x1697 [<!ab<!acd>>[!bc]]\n0x066b <a<!a!b[cd]>!<cd[b<!a!b[cd]>]>>\n0x07f8 [d<ac!<0a!b>>]\n0x035a <!d<0!bd>[c<!0ad>]>\n0x1696 <0<!0!b<b!c!d>>![a[!bc]]>\n0x003f <0!d!<bcd>>\n0x0673 <!d![!b<a!c!d>]!<bc<a!c!d>>>\n0x0359 [!<0b!c><ac![!ad]>]\n0x0672 <<0!b!d>[ab][cd]>\n0x0358 [!<b!d!<0a!d>>!<d<b!d!<0a!d>>![c<0a!d>]>]\n0x003d <0<!b!c<bc!d>><!a!d<bc!d>>>\n0x0357 <!a<!0a!d>!<!0bc>>\n0x003c <0!d[bc]>\n0x0356 [<0!a!d><0!b!c>]\n0x07e6 [<ab!d><!cd<0ab>>]\n0x033f <!b!c!d>\n0x033d [<0!d<a!cd>><!b!c<0!d!<a!cd>>>]\n0x0690 [c<cd![!ab]>]\n0x01e9 [!<bc<!0a!c>><a!<!0a!c>!<0d<bc<!0a!c>>>>]\n0x1686 [!a<!b[!bc]!<ad![!bc]>>]\n0x07f1 <!b[cd]!<a!bd>>\n0x01bd <!d[b<!a!bc>]<0!c<!a!bc>>>\n0x1683 [[!bc]<!ad<0bc>>]\n0x001e <0!d[c<!0ab>]>\n0x01ab <!d!<!0bc>[ad]>\n0x01aa <a![!ad]!<!0a<!0bc>>>\n0x01a9 <!d![a<!0bc>]<0!ad>>\n0x001b <0!<!abd>!<acd>>\n0x01a8 [<0!b!c><a!d<0!b!c>>]\n0x000f <0!c!d>\n0x0199 <!<bcd>[!ab]<0!d[!ab]>>\n0x0198 [b!<a!b[d<!0b!c>]>]\n0x0197 <!d<0!b!c>[!a<0bc>]>\n0x06f9 [d<!0c![ab]>]\n0x0196 <!b!<!0d<a!b!c>>!<!bc![ad]>>\n0x03d8 [d!<!b!c<0!d![!ab]>>]\n0x06f2 <[cd]<!d![!ab][cd]><0a![cd]>>\n0x03de <!d![!bd][!c<!ab[!bd]>]>\n0x018f <!c!d![a<!ab!d>]>\n0x0691 <<!a!bd><ab!c><!d!<ab!c><0c<ab!c>>>>\n0x01ea [!d!<!0a<bcd>>]\n0x07b1 <[cd]<0!a!c>!<!abd>>\n0x0189 <<a!b!c><0b!d>[a<a!b!c>]>\n0x036b <!c[b<!0a!c>]<a!d!<!0a!c>>>\n0x03d5 <!a[b<b!cd>]<!0a!d>>\n0x0186 [<!a!bc><c!d!<0ab>>]\n0x0119 <0[!ab]!<acd>>\n0x0368 [![c<0a!d>]!<!bc!<b!d![c<0a!d>]>>]\n0x0183 <[!bc]<0a!d><0!a!b>>\n0x07b5 <!<bcd>![ac][cd]>\n0x0181 [<b!c<!0!bd>><ab<b!c<!0!bd>>>]\n0x036e <b[b<!0ad>]!<bcd>>\n0x011f <!c!d!<!0ab>>\n0x016f <b<0!b!<!abc>>!<ad<!abc>>>\n0x016e <!d[a[bd]]<0!c[bd]>>\n0x013f <!a<0a!d>!<bcd>>\n0x019f <0<!c!d[!ab]>!<0bd>>\n0x013e [[!bd]!<!bc<a!d![!bd]>>]\n0x019e [d<a!<a!b!c><!0!c<!a!bd>>>]\n0x013d <b!<bcd><0<!0!ac>!<bcd>>>\n0x016b <!d![!a[!bc]]!<bc![!bc]>>\n0x01fe [d!<0!a!<!0bc>>]\n0x166a [<bcd><ab<d!<bcd>!<0b!c>>>]\n0x0019 [<!ab!d><0b<!ac<!ab!d>>>]\n0x006b <!d<a!b!c><0!a<0bc>>>\n0x069f <a<!ab!d>!<abc>>\n0x013c <0!<bcd><b!<0ad>!<!c!d<0ad>>>>\n0x037e [<!0ad><bc<!0!ad>>]\n0x012f <!d<a!b!c><0!a!c>>\n0x0693 [c!<!d<b!cd>![!b<!ac<b!cd>>]>]\n0x012d <0!<bcd><!0b[!ac]>>\n0x01ee <!c<ac!d>[!d<0!a!b>]>\n0x012c [!<0!b!c><cd<!0!ab>>]\n0x017f <!a!d!<bcd>>\n0x1796 <![!ad]<!b!c[!ad]>![!d<bc[!ad]>]>\n0x036d <<!ab!c><ac[bd]>!<bcd>>\n0x011e <d<0!d!<0!c<0!a!b>>>!<c!<0!a!b>!<0!d!<0!c<0!a!b>>>>>\n0x0679 <a<!a!b[cd]>!<ad<!0!bc>>>\n0x035f <!c!d!<ab[bc]>>\n0x067b <!<cd!<!acd>>![b<!acd>]!<!abd>>\n0x0118 <0[!d[a<!ab!c>]]!<b!<!ab!c>[a<!ab!c>]>>\n0x067a [<!0ac><cd<ab!<!0ac>>>]\n0x0117 <0!<abd>!<cd<ab!d>>>\n0x1ee1 [!d![!c<!0ab>]]\n0x016a <d<!d!<!0!ad><bcd>>!<a<bcd>!<!d!<!0!ad><bcd>>>>\n0x0169 <!c<!a!b<abc>><0!d<abc>>>\n0x037d <!a![d<0!b!c>]<a!b!c>>\n0x0697 <<0ac>!<abc>!<d<abc>!<abd>>>\n0x006f <!d<0!c!d>![!ab]>\n0x17ac [<abc><!ad<!0bd>>]\n0x0069 <0!d![a[bc]]>\n0x0667 <0!<0ab>!<cd!<!0ab>>>\n0x0168 <!b!<!0d!<abc>><!ab!<!bc!d>>>\n0x067e <!d[ab][!c<0!b!d>]>\n0x011b <a!<!0ab>!<acd>>\n0x036a [<!0ad><bcd>]\n0x018b <!c!<a!c[bc]><0a!d>>\n0x0001 <0<0!b!d><!ab!c>>\n0x1669 <<!a!c[bd]><ac[bd]>!<[bd]!<!a!c[bd]><bd<!a!c[bd]>>>>\n0x0018 <0!d[a<a!bc>]>\n0x168b [![d<!0bc>]<ab!<!c!d<!0bc>>>]\n0x0662 [<ab<!0!bc>><c!<!0!bc><abd>>]\n0x00ff !d\n0x168e [<!0a!<!0!bc>><c!<!0!bc><a!bd>>]\n0x0007 <0<0!c!d>!<abd>>\n0x19e6 [[ad]<b!c!<!0a!b>>]\n0x0116 <0!<abd>![!c<d[ab]!<abd>>]>\n0x036c [[bd]<0c!<!ab![bd]>>]\n0x01e8 <<!a!bc><a!c[cd]><0b!d>>\n0x06f0 <<0!ab><a!bc>![!cd]>\n0x03d6 [[c<!0!bc>]!<!0d!<!ab<!0!bc>>>]\n0x1be4 [!d!<bc[ab]>]\n0x0187 <a<!a!d[!bc]><0!c<!a!d[!bc]>>>\n0x0003 <0!d<0!b!c>>\n0x017e [[!ad]<a!b<!c[!ad]<!0bd>>>]\n0x01eb <!d[!b<!0ac>]<a!b!<!0ac>>>\n0x0006 <0!d<!cd![!ab]>>\n0x011a [a<a!<b!c!d>[cd]>]\n0x0369 <0[!c<0!d![!ab]>]!<0bd>>\n0x03d9 [!b<b!<!ab[!ad]><!bc!d>>]\n0x0000 0\n0x019b <!d!<!0bc>![ab]>\n0x1668 [<acd><ab<bcd>>]\n0x18e7 [d[!b<!abc>]]\n0x0017 <0!d!<abc>>\n0x019a <!d[a<!bcd>]<0!c<!bcd>>>\n0x0016 <0!<ab<!a!bc>>!<!cd<!a!bc>>>";
-  std::string npn4_sd = "0x3cc3 [b[!cd]]\n0x1bd8 [!<b!cd><a!b!c>]\n0x19e3 [<a!b!c><c[bd]<0a!c>>]\n0x19e1 [<!b!c[bd]><a[bd]!<cd<!b!c[bd]>>>]\n0x17e8 [d<abc>]\n0x179a [<ad!<0ad>><c<0ad>[!bd]>]\n0x178e <!c[ad]![!bd]>\n0x16e9 [d<<a!b!c><abc>!<0a!b>>]\n0x16bc [<0!b!c><!d!<abc>[ad]>]\n0x16ad [!<!b!<!0a!b>[ac]><0d<!0a!b>>]\n0x16ac [!<acd><!b!d<!a[cd]<acd>>>]\n0x16a9 <0<!0a<!b!cd>>[!<0!b!c>[!ad]]>\n0x169e <!d[!a[!bc]]!<c!d[!bc]>>\n0x169b <<a!b!<0!cd>>!<ab!<0!cd>>!<!bcd>>\n0x169a [a<![!bc]<0ac><!0!bd>>]\n0x1699 <b<!a!b<0!cd>>!<b<0!cd><!abd>>>\n0x1687 [[ac]<b!<a!bd>!<0bc>>]\n0x167e <<!b!c<!abc>>[a<!abc>]!<!ad!<!abc>>>\n0x166e [<ab!<0ab>><cd<0ab>>]\n0x03cf <!c!d[bd]>\n0x166b <!c[a<bcd>]<!bc!d>>\n0x01be <c!<bcd><!<!0!bd>[ad]!<bcd>>>\n0x07f2 <[cd]<0a!b>!<0ad>>\n0x07e9 [<ac<!0!ab>><!bd<!0!ab>>]\n0x6996 [[bc][ad]]\n0x01af <[!ac]<0a!d>!<bcd>>\n0x033c <<b!cd><0c!d>!<bcd>>\n0x07e3 [c<d!<abc>!<0b!c>>]\n0x1681 <0[!<b!cd>[ab]]!<!d[ab]<0!ac>>>\n0x01ae <!<bcd>![!ad]<0b!d>>\n0x07e2 [<!a!bd>!<!cd<0b!<!a!bd>>>]\n0x01ad <!<bcd><0b!d>[!ac]>\n0x07e1 [c<d<!0!bc>!<ab!d>>]\n0x001f <!a<a!b!d><0!c!d>>\n0x01ac [d<a<!a!cd>!<0!b!c>>]\n0x07e0 [d<ac<!abd>>]\n0x07bc [<bc<!0a!b>>!<0!d<!0a!b>>]\n0x03dc <b[d<!0bc>]!<ab<!0bc>>>\n0x06f6 <!d[ab][cd]>\n0x06bd <<b!c<0!bd>><a!b!d>!<a!c<0!bd>>>\n0x077e <<!0a![!cd]><0!ab>!<bcd>>\n0x06b9 <!<!0ac><a!b!d><b<a!b!d>![!cd]>>\n0x06b7 <!d[c[ab]]<!b!c[ab]>>\n0x06b6 [!c!<<!abc>!<0c!d>[ab]>]\n0x077a [!<0a!<!bcd>>![cd]]\n0x06b5 <!<a!b!c><a!b!d>![!c<!0!ad>]>\n0x0ff0 [cd]\n0x0779 <<ac!d><b!c!<ac!d>>!<ab![cd]>>\n0x06b4 [!c<!d<a!b!c>![ab]>]\n0x0778 [[cd]<0<b!c!d><0ab>>]\n0x007f <!d<!ab!c><0!b!d>>\n0x06b3 [![!bd]!<d<0bc><a!c!d>>]\n0x007e <0!d![a<a!b!c>]>\n0x06b2 [!<0!c!<a!bd>><bd!<ab!c>>]\n0x0776 <[ab][cd]!<abc>>\n0x06b1 [d<c<!0!bd>[!ab]>]\n0x06b0 [<!a!c<ab!d>><!b<ab!d>!<0cd>>]\n0x037c [[!bd]<d<!0b!c>!<acd>>]\n0x01ef <!c!d![!c<0!a!b>]>\n0x0696 <<ab!c><0c!d>!<abc>>\n0x035e [<!0ad>!<0!c!<bd!<!0ad>>>]\n0x0678 <<!ab!d><0a!b>[c<abd>]>\n0x0676 <!<abc>[ab]<0c!d>>\n0x0669 [<0!c!d><[cd]<0!c!d>[ab]>]\n0x01bc [<bd<!acd>>!<0!b!c>]\n0x0663 <0[b<a!c!d>]!<0cd>>\n0x07f0 <[cd]!<!0!cd>!<0ab>>\n0x01bf <!d<!0a!c><0!a!b>>\n0x0666 <0[ab]!<0cd>>\n0x0661 <<a!c!d>!<ab<a!c!d>>[<a!c!d><b!c!d>]>\n0x1689 [[d<abd>]<0!c<!a!bd>>]\n0x0660 [<b!c!d>!<!acd>]\n0x0182 [<!ab!c><b!d<!0!c<!ab!c>>>]\n0x07b6 [<!0!a<!bcd>>[!c<!0bd>]]\n0x03d7 <!d[!bc]!<abc>>\n0x06f1 [<!ac<!0!bc>><d<!0!bc><0!ad>>]\n0x03dd <[bd]<0!a!d>!<0cd>>\n0x0180 [<acd>!<b!d!<acd>>]\n0x07b4 [<bd<!0!ad>><c<!0!ad><abc>>]\n0x03db <[!bc]<a!b!d>!<acd>>\n0x07b0 <<0ac>[cd]!<abc>>\n0x03d4 [!d<!b!c<0a!d>>]\n0x03c7 <!<0bd><0!a!c>[!bc]>\n0x03c6 <0!<0cd>[!b<!ac!d>]>\n0x03c5 <[bd]<0!a!c>![bc]>\n0x03c3 <!b<0b!d>[!bc]>\n0x03c1 <!<b!cd>[b<b!cd>]<!a!c<b!cd>>>\n0x03c0 [d<bcd>]\n0x1798 [<ab<!a!bc>><d<!a!bc><!0cd>>]\n0x036f <!c!d[!b<0!ac>]>\n0x03fc [d!<0!b!c>]\n0x1698 [b<<!abd>[ac][!ad]>]\n0x177e [<0!b!d>!<ac![bd]>]\n0x066f <!c!d[ab]>\n0x035b <<ac!d><0!b!c>!<0ac>>\n0x1697 <!<abc><ab!c><!bc!d>>\n0x066b [<bc<!a!bd>><a<!a!bd>!<0!cd>>]\n0x07f8 [!d!<ac!<0a!b>>]\n0x035a [!<!0c<0bd>><0!a!d>]\n0x1696 <!a<!d<0!bd><a!bc>><b!c<a!bc>>>\n0x003f <0!d!<bcd>>\n0x0673 <!b![d<ab!c>]<!a!d<ab!c>>>\n0x0359 [<!0!bc><ac[!cd]>]\n0x0672 <[cd]<0!b!d>[ab]>\n0x0358 <<!acd><0a!c>[!d<0!b!c>]>\n0x003d <!<bcd>[bc]<0!a!d>>\n0x0357 <!0!<!0bc><0!a!d>>\n0x003c <0!d![!bc]>\n0x0356 [!<0!a!d>!<0!b!c>]\n0x07e6 [<!cd!<0!a!b>><abc>]\n0x033f <!b!c!d>\n0x033d <!<bcd><bc!d><0!b<!0!ad>>>\n0x0690 [!d<!c!d[ab]>]\n0x01e9 <!d<0!b![ac]>![b<!0ac>]>\n0x1686 [[bc]<a[bc]!<!abd>>]\n0x07f1 <!b<!ab!d>[cd]>\n0x01bd <!d[c<!ab!c>]<0!b<!ab!c>>>\n0x1683 [[bc]!<!ad<0bc>>]\n0x001e <0!d![!c<ab!d>]>\n0x01ab <!d![!ad]<0!b!c>>\n0x01aa <[ad]<0!b!c><0a!d>>\n0x01a9 [a<d<0!b!c><!0a!d>>]\n0x001b <0<a!b!d>!<acd>>\n0x01a8 [a<ad!<!0bc>>]\n0x000f <0!c!d>\n0x0199 <[!ab]<a!b!d><0!a!c>>\n0x0198 [!<!abd><!b!c<0ac>>]\n0x0197 <!d[!a<0bc>]<!b!c<0bc>>>\n0x06f9 [d<!0c![ab]>]\n0x0196 <<0!d!<a!b!c>>[ad]!<bc[ad]>>\n0x03d8 [<!cd!<a!b!c>><!0b!<a!b!c>>]\n0x06f2 <a<0!a[cd]><!d[cd]![!ab]>>\n0x03de <!d![c<!ab!d>][bd]>\n0x018f <!c!d[b<!ab!c>]>\n0x0691 <0<!d<!a!bd><ab!c>><!0c<!a!bd>>>\n0x01ea [d<!0a<bcd>>]\n0x07b1 <<a!b!d><0!a!c>[cd]>\n0x0189 <[!ab]!<!0ac><0a!d>>\n0x036b <!a!<!ad![!bc]>!<!abc>>\n0x03d5 [<bcd>!<!d<bcd><0a!d>>]\n0x0186 [<!cd<0ab>>!<!a!bc>]\n0x0119 <0[!ab]!<acd>>\n0x0368 [<bcd><c<b!cd><!0ad>>]\n0x0183 <[!bc]<0a!d><0!a!b>>\n0x07b5 <!<bcd>[cd]![ac]>\n0x0181 <<!ab!c>[b<!ab!c>]<0!d!<!ab!c>>>\n0x036e <!c<bc!d>[!b<0!a!d>]>\n0x011f <!c!d!<!0ab>>\n0x016f <<!ab!c><0a!d>!<abd>>\n0x016e <!d<0!c[bd]>[a[bd]]>\n0x013f <0!<0ad>!<bcd>>\n0x019f <!d<b!c[ad]><0!a!b>>\n0x013e [[!cd]<!bc!<a!d![!cd]>>]\n0x019e <!d!<!bc[!ad]><0!b<!acd>>>\n0x013d <<bc!d>!<!0ac>!<bcd>>\n0x016b <!d<0!b!c>![!b[!ac]]>\n0x01fe [d<!0c<ab!c>>]\n0x166a <a[a<bcd>]!<ab<!bcd>>>\n0x0019 <!<!abd><0!a!b><0b!c>>\n0x006b <!d<0b<!a!bc>>!<!abc>>\n0x069f <!d<abd>!<abc>>\n0x013c <<0!ad><b!d!<!0b!c>>!<bc<0!ad>>>\n0x037e [<!0ad>!<!b!c<0a!d>>]\n0x012f <!d<a!b!c>!<!0ac>>\n0x0693 [<acd><d<!0c!d>![bd]>]\n0x012d <<0ac><!ab!c>!<bcd>>\n0x01ee [!<!0ab>!<d<0!cd><!0ab>>]\n0x012c [<0!a!b><!d[bc]<0!a!b>>]\n0x017f <!b!d!<acd>>\n0x1796 <!b!<!a!bc><!a<!0cd>!<!0!bd>>>\n0x036d <<abc>!<bcd><!a!c[bd]>>\n0x011e <d!<cd!<0!a!b>>!<d<0!a!b>!<0c!d>>>\n0x0679 <!d<!a<abd><0!b!c>>[c<abd>]>\n0x035f <!c!<0bd>!<!0ad>>\n0x067b <!d<!b!c[ad]>[![ad]<0b!c>]>\n0x0118 <<0!a!b><ac!d><!cd<0b!d>>>\n0x067a [<!0ac><cd<ab!<!0ac>>>]\n0x0117 <!b<!a!d<a!cd>><0!c!<a!cd>>>\n0x1ee1 [[cd]<0!a!b>]\n0x016a <b!<b<!0!ad>!<b!cd>>!<ab<b!cd>>>\n0x0169 <!a<a!b!c><0!d<abc>>>\n0x037d <!a<a!b!c>[!d<0!b!c>]>\n0x0697 <<!a!c<0a!b>>!<!ab!c><!ab!d>>\n0x006f <!d<0!c!d>[ab]>\n0x17ac [<abc><!0d<0!ab>>]\n0x0069 <0!d[a[!bc]]>\n0x0667 <![!ab]<0!b[!ab]>!<cd[!ab]>>\n0x0168 [<bd<!0!bc>><ad<!0bc>>]\n0x067e <!d![c<0!a!d>][ab]>\n0x011b <a!<acd>!<!0ab>>\n0x036a [!<bcd><0!a!d>]\n0x018b <!<0ad><0!b!c><0ab>>\n0x0001 <0<0!a!b><0!c!d>>\n0x1669 <<!cd<!a!bc>><b!d[!ac]>!<bd[!ac]>>\n0x0018 <0!d[a<a!bc>]>\n0x168b [[!a<!ab!d>]<!b!c<0d<!ab!d>>>]\n0x0662 <!<!0bd>[ab][d<abc>]>\n0x00ff !d\n0x168e [!<a!c!<0!b!c>><!0<0!b!c><!ab!d>>]\n0x0007 <0!<!0cd>!<0ab>>\n0x19e6 [[ad]<0b!<0ac>>]\n0x0116 [<!b!d[!ac]><0[!ac]!<!abd>>]\n0x036c [[bd]!<!0!c<!ab![bd]>>]\n0x01e8 <!d<a[bd][cd]><0!ad>>\n0x06f0 <[cd]<a!bc>!<a!bd>>\n0x03d6 [<d!<0!a!d>!<0bc>><bc!<0bc>>]\n0x1be4 [d!<!b!c[ac]>]\n0x0187 <a!<!0ac>!<ad![!bc]>>\n0x0003 <0!d<0!b!c>>\n0x017e [[!bd]<<!ab!c>[!bd]<!0bd>>]\n0x01eb <!d[b<0!a!c>]!<!ab!<0!a!c>>>\n0x0006 <0[ab]<0!c!d>>\n0x011a <0[d[ac]]!<bcd>>\n0x0369 <!b<0!d<abc>><b!c!<0a!d>>>\n0x03d9 [d<<!0!ab><bcd><a!b!d>>]\n0x0000 0\n0x019b <!d<0!b!c>![ab]>\n0x1668 [<bcd><ab<!bcd>>]\n0x18e7 [[!cd]<abc>]\n0x0017 <0!d!<abc>>\n0x019a <!d![a<b!c!d>]!<!0c<b!c!d>>>\n0x0016 <0<a!d<bc!d>>!<abc>>";
-  std::string npn4_ds = "0x3cc3 [b[!cd]]\n0x1bd8 [!<b!cd><a!b!c>]\n0x19e3 [<a!b!c><c[bd]<0a!c>>]\n0x19e1 <![<a!bd>[bc]]<!d<a!bd>![bc]><!a!c[bc]>>\n0x17e8 [d<abc>]\n0x179a [<ad!<0ad>><c<0ad>[!bd]>]\n0x178e <!c[ad]![!bd]>\n0x16e9 [d<<a!b!c><abc>!<0a!b>>]\n0x16bc [<0!b!c><!d!<abc>[ad]>]\n0x16ad [!<!b!<!0a!b>[ac]><0d<!0a!b>>]\n0x16ac [<<!0!cd>[bc]<0ab>><ad!<!0!cd>>]\n0x16a9 <0<!0a<!b!cd>>[!<0!b!c>[!ad]]>\n0x169e <!d[!a[!bc]]!<c!d[!bc]>>\n0x169b <<a!b!<0!cd>>!<ab!<0!cd>>!<!bcd>>\n0x169a [a<![!bc]<0ac><!0!bd>>]\n0x1699 <b<!a!b<0!cd>>!<b<0!cd><!abd>>>\n0x1687 [[ac]<b!<a!bd>!<0bc>>]\n0x167e <<!b!c<!abc>>[a<!abc>]!<!ad!<!abc>>>\n0x166e [<ab!<0ab>><cd<0ab>>]\n0x03cf <!c!d[bd]>\n0x166b <!c[a<bcd>]<!bc!d>>\n0x01be <c!<bcd><!<!0!bd>[ad]!<bcd>>>\n0x07f2 <[cd]<0a!b>!<0ad>>\n0x07e9 [<ac<!0!ab>><!bd<!0!ab>>]\n0x6996 [[bc][ad]]\n0x01af <[!ac]<0a!d>!<bcd>>\n0x033c <<b!cd><0c!d>!<bcd>>\n0x07e3 [c<d!<abc>!<0b!c>>]\n0x1681 <0[!<b!cd>[ab]]!<!d[ab]<0!ac>>>\n0x01ae <!<bcd>![!ad]<0b!d>>\n0x07e2 [<b!cd><b<!0!bc><ab!d>>]\n0x01ad <!<bcd><0b!d>[!ac]>\n0x07e1 [c<d<!0!bc>!<ab!d>>]\n0x001f <!a<a!b!d><0!c!d>>\n0x01ac [d<a<!a!cd>!<0!b!c>>]\n0x07e0 [d<ac<!abd>>]\n0x07bc [<bc<!0a!b>>!<0!d<!0a!b>>]\n0x03dc <b[d<!0bc>]!<ab<!0bc>>>\n0x06f6 <!d[ab][cd]>\n0x06bd <<b!c<0!bd>><a!b!d>!<a!c<0!bd>>>\n0x077e <<!0a![!cd]><0!ab>!<bcd>>\n0x06b9 <!<!0ac><a!b!d><b<a!b!d>![!cd]>>\n0x06b7 <!d[c[ab]]<!b!c[ab]>>\n0x06b6 [!c!<<!abc>!<0c!d>[ab]>]\n0x077a [!<0a!<!bcd>>![cd]]\n0x06b5 <!<a!b!c><a!b!d>![!c<!0!ad>]>\n0x0ff0 [cd]\n0x0779 <<ac!d><b!c!<ac!d>>!<ab![cd]>>\n0x06b4 [!c<!d<a!b!c>![ab]>]\n0x0778 [[cd]<0<b!c!d><0ab>>]\n0x007f <!d<!ab!c><0!b!d>>\n0x06b3 [![!bd]!<d<0bc><a!c!d>>]\n0x007e <!<abd><bc!d><0a!c>>\n0x06b2 [!<0!c!<a!bd>><bd!<ab!c>>]\n0x0776 <[ab][cd]!<abc>>\n0x06b1 [d<c<!0!bd>[!ab]>]\n0x06b0 [<!a!c<ab!d>><!b<ab!d>!<0cd>>]\n0x037c [[!bd]<d<!0b!c>!<acd>>]\n0x01ef <<0b!d><a!b!c>!<0ad>>\n0x0696 <<ab!c><0c!d>!<abc>>\n0x035e <<!0d![!ac]><0b!d>!<bcd>>\n0x0678 <<!ab!d><0a!b>[c<abd>]>\n0x0676 <!<abc>[ab]<0c!d>>\n0x0669 [<0!c!d><[cd]<0!c!d>[ab]>]\n0x01bc [<bd<!acd>>!<0!b!c>]\n0x0663 <0[b<a!c!d>]!<0cd>>\n0x07f0 <[cd]!<!0!cd>!<0ab>>\n0x01bf <!d<!0a!c><0!a!b>>\n0x0666 <0[ab]!<0cd>>\n0x0661 <<a!c!d>!<ab<a!c!d>>[<a!c!d><b!c!d>]>\n0x1689 [[d<abd>]<0!c<!a!bd>>]\n0x0660 [<b!c!d>!<!acd>]\n0x0182 <0<!0a!<!ac!d>>!<ad![!bc]>>\n0x07b6 [<!0!a<!bcd>>[!c<!0bd>]]\n0x03d7 <!d[!bc]!<abc>>\n0x06f1 [<!ac<!0!bc>><d<!0!bc><0!ad>>]\n0x03dd <[bd]<0!a!d>!<0cd>>\n0x0180 [<acd>!<b!d!<acd>>]\n0x07b4 [<bd<!0!ad>><c<!0!ad><abc>>]\n0x03db <[!bc]<a!b!d>!<acd>>\n0x07b0 <<0ac>[cd]!<abc>>\n0x03d4 <[cd]<0!a!d>[bd]>\n0x03c7 <!<0bd><0!a!c>[!bc]>\n0x03c6 <0!<0cd>[!b<!ac!d>]>\n0x03c5 <[bd]<0!a!c>![bc]>\n0x03c3 <!b<0b!d>[!bc]>\n0x03c1 <!<b!cd>[b<b!cd>]<!a!c<b!cd>>>\n0x03c0 [d<bcd>]\n0x1798 [<ab<!a!bc>><d<!a!bc><!0cd>>]\n0x036f <!c!d[!b<0!ac>]>\n0x03fc [d!<0!b!c>]\n0x1698 [b<<!abd>[ac][!ad]>]\n0x177e [<0!b!d>!<ac![bd]>]\n0x066f <!c!d[ab]>\n0x035b <<ac!d><0!b!c>!<0ac>>\n0x1697 <!<abc><ab!c><!bc!d>>\n0x066b [<bc<!a!bd>><a<!a!bd>!<0!cd>>]\n0x07f8 [!d!<ac!<0a!b>>]\n0x035a [!<!0c<0bd>><0!a!d>]\n0x1696 <!a<!d<0!bd><a!bc>><b!c<a!bc>>>\n0x003f <0!d!<bcd>>\n0x0673 <!b![d<ab!c>]<!a!d<ab!c>>>\n0x0359 [<!0!bc><ac[!cd]>]\n0x0672 <[cd]<0!b!d>[ab]>\n0x0358 <<!acd><0a!c>[!d<0!b!c>]>\n0x003d <!<bcd>[bc]<0!a!d>>\n0x0357 <!0!<!0bc><0!a!d>>\n0x003c <0!d![!bc]>\n0x0356 [!<0!a!d>!<0!b!c>]\n0x07e6 [<!cd!<0!a!b>><abc>]\n0x033f <!b!c!d>\n0x033d <!<bcd><bc!d><0!b<!0!ad>>>\n0x0690 <<!a!bd><0c!d><ab!c>>\n0x01e9 <!d<0!b![ac]>![b<!0ac>]>\n0x1686 [[bc]<a[bc]!<!abd>>]\n0x07f1 <!b<!ab!d>[cd]>\n0x01bd <!d[c<!ab!c>]<0!b<!ab!c>>>\n0x1683 [[bc]!<!ad<0bc>>]\n0x001e <0!d![!c<ab!d>]>\n0x01ab <!d![!ad]<0!b!c>>\n0x01aa <[ad]<0!b!c><0a!d>>\n0x01a9 [a<d<0!b!c><!0a!d>>]\n0x001b <0<a!b!d>!<acd>>\n0x01a8 [a<ad!<!0bc>>]\n0x000f <0!c!d>\n0x0199 <[!ab]<a!b!d><0!a!c>>\n0x0198 [!<!abd><!b!c<0ac>>]\n0x0197 <!d[!a<0bc>]<!b!c<0bc>>>\n0x06f9 <<!ab!d><a!b!d>[cd]>\n0x0196 <<0!d!<a!b!c>>[ad]!<bc[ad]>>\n0x03d8 [<!cd!<a!b!c>><!0b!<a!b!c>>]\n0x06f2 <a<0!a[cd]><!d[cd]![!ab]>>\n0x03de <!d![c<!ab!d>][bd]>\n0x018f <!c!d[b<!ab!c>]>\n0x0691 <0<!d<!a!bd><ab!c>><!0c<!a!bd>>>\n0x01ea [d<!0a<bcd>>]\n0x07b1 <<a!b!d><0!a!c>[cd]>\n0x0189 <[!ab]!<!0ac><0a!d>>\n0x036b <!a!<!ad![!bc]>!<!abc>>\n0x03d5 [<bcd>!<!d<bcd><0a!d>>]\n0x0186 [<!cd<0ab>>!<!a!bc>]\n0x0119 <0[!ab]!<acd>>\n0x0368 [<bcd><c<b!cd><!0ad>>]\n0x0183 <[!bc]<0a!d><0!a!b>>\n0x07b5 <!<bcd>[cd]![ac]>\n0x0181 <<!ab!c>[b<!ab!c>]<0!d!<!ab!c>>>\n0x036e <!c<bc!d>[!b<0!a!d>]>\n0x011f <!c!d!<!0ab>>\n0x016f <<!ab!c><0a!d>!<abd>>\n0x016e <!d<0!c[bd]>[a[bd]]>\n0x013f <0!<0ad>!<bcd>>\n0x019f <!d<b!c[ad]><0!a!b>>\n0x013e [!<b<!0ac><!0!cd>>![!d<!0!cd>]]\n0x019e <!d!<!bc[!ad]><0!b<!acd>>>\n0x013d <<bc!d>!<!0ac>!<bcd>>\n0x016b <!d<0!b!c>![!b[!ac]]>\n0x01fe [d<!0c<ab!c>>]\n0x166a <a[a<bcd>]!<ab<!bcd>>>\n0x0019 <!<!abd><0!a!b><0b!c>>\n0x006b <!d<0b<!a!bc>>!<!abc>>\n0x069f <!d<abd>!<abc>>\n0x013c <<0!ad><b!d!<!0b!c>>!<bc<0!ad>>>\n0x037e [<!0ad>!<!b!c<0a!d>>]\n0x012f <!d<a!b!c>!<!0ac>>\n0x0693 [<acd><d<!0c!d>![bd]>]\n0x012d <<0ac><!ab!c>!<bcd>>\n0x01ee [!<!0ab>!<d<0!cd><!0ab>>]\n0x012c [<0!a!b><!d[bc]<0!a!b>>]\n0x017f <!b!d!<acd>>\n0x1796 <!b!<!a!bc><!a<!0cd>!<!0!bd>>>\n0x036d <<abc>!<bcd><!a!c[bd]>>\n0x011e <d!<cd!<0!a!b>>!<d<0!a!b>!<0c!d>>>\n0x0679 <!d<!a<abd><0!b!c>>[c<abd>]>\n0x035f <!c!<0bd>!<!0ad>>\n0x067b <!d<!b!c[ad]>[![ad]<0b!c>]>\n0x0118 <<0!a!b><ac!d><!cd<0b!d>>>\n0x067a <[c<abd>]<0a!b>!<acd>>\n0x0117 <!b<!a!d<a!cd>><0!c!<a!cd>>>\n0x1ee1 [[cd]<0!a!b>]\n0x016a <b!<b<!0!ad>!<b!cd>>!<ab<b!cd>>>\n0x0169 <!a<a!b!c><0!d<abc>>>\n0x037d <!a<a!b!c>[!d<0!b!c>]>\n0x0697 <<!a!c<0a!b>>!<!ab!c><!ab!d>>\n0x006f <!d<0!c!d>[ab]>\n0x17ac [<abc><!0d<0!ab>>]\n0x0069 <0!d[a[!bc]]>\n0x0667 <![!ab]<0!b[!ab]>!<cd[!ab]>>\n0x0168 [<bd<!0!bc>><ad<!0bc>>]\n0x067e <!d![c<0!a!d>][ab]>\n0x011b <a!<acd>!<!0ab>>\n0x036a [!<bcd><0!a!d>]\n0x018b <!<0ad><0!b!c><0ab>>\n0x0001 <0<0!a!b><0!c!d>>\n0x1669 <<!cd<!a!bc>><b!d[!ac]>!<bd[!ac]>>\n0x0018 <!<bcd><0ab>!<!0a!c>>\n0x168b <<0!b!c>!<a<a!bd><0!b!c>>!<!a<0!b!c>!<!b!cd>>>\n0x0662 <!<!0bd>[ab][d<abc>]>\n0x00ff !d\n0x168e [!<a!c!<0!b!c>><!0<0!b!c><!ab!d>>]\n0x0007 <0!<!0cd>!<0ab>>\n0x19e6 [[ad]<0b!<0ac>>]\n0x0116 [<!b!d[!ac]><0[!ac]!<!abd>>]\n0x036c [<!a!d<0a!c>>!<!0b<0cd>>]\n0x01e8 <!d<a[bd][cd]><0!ad>>\n0x06f0 <[cd]<a!bc>!<a!bd>>\n0x03d6 [<d!<0!a!d>!<0bc>><bc!<0bc>>]\n0x1be4 [d!<!b!c[ac]>]\n0x0187 <a!<!0ac>!<ad![!bc]>>\n0x0003 <0!d<0!b!c>>\n0x017e [[!bd]<<!ab!c>[!bd]<!0bd>>]\n0x01eb <!d[b<0!a!c>]!<!ab!<0!a!c>>>\n0x0006 <0[ab]<0!c!d>>\n0x011a <0[d[ac]]!<bcd>>\n0x0369 <!b<0!d<abc>><b!c!<0a!d>>>\n0x03d9 [d<<!0!ab><bcd><a!b!d>>]\n0x0000 0\n0x019b <!d<0!b!c>![ab]>\n0x1668 [<bcd><ab<!bcd>>]\n0x18e7 [[!cd]<abc>]\n0x0017 <0!d!<abc>>\n0x019a <!d![a<b!c!d>]!<!0c<b!c!d>>>\n0x0016 <0<a!d<bc!d>>!<abc>>";
+  // clang-format off
+  inline static constexpr uint16_t classes[] = {0x0016, 0x0017, 0x18e7, 0x1668, 0x0369, 0x0006, 0x0003, 0x03d6, 0x01e8, 0x19e6, 0x0007, 0x00ff, 0x0662, 0x1669, 0x018b, 0x011b, 0x067e, 0x0069, 0x17ac, 0x0697, 0x037d, 0x036a, 0x0169, 0x0118, 0x067b, 0x035f, 0x036d, 0x1796, 0x019a, 0x012c, 0x011a, 0x01ee, 0x012d, 0x0693, 0x0018, 0x037e, 0x069f, 0x006f, 0x006b, 0x0019, 0x01fe, 0x03d9, 0x013d, 0x019f, 0x013f, 0x016f, 0x011f, 0x036e, 0x0181, 0x07b5, 0x0679, 0x0183, 0x0186, 0x0189, 0x0691, 0x018f, 0x016b, 0x03de, 0x06f2, 0x03d8, 0x0196, 0x0197, 0x01ef, 0x01ea, 0x037c, 0x0187, 0x03cf, 0x017e, 0x0678, 0x01a9, 0x0116, 0x06b2, 0x0667, 0x016e, 0x167e, 0x007f, 0x06b4, 0x06b6, 0x3cc3, 0x07e9, 0x06bd, 0x019b, 0x0661, 0x013e, 0x06b0, 0x03dc, 0x1699, 0x0168, 0x07bc, 0x01e9, 0x01ac, 0x1ee1, 0x001f, 0x07e1, 0x06f9, 0x033c, 0x0666, 0x0368, 0x07e2, 0x168e, 0x0ff0, 0x06f1, 0x07e3, 0x01ad, 0x019e, 0x036f, 0x06b1, 0x07f0, 0x16a9, 0x16bc, 0x169a, 0x07b4, 0x01eb, 0x06b5, 0x01be, 0x01ae, 0x03d4, 0x016a, 0x013c, 0x1696, 0x19e3, 0x077a, 0x166b, 0x0779, 0x011e, 0x0696, 0x07b6, 0x0776, 0x177e, 0x07f2, 0x1bd8, 0x166e, 0x1683, 0x067a, 0x19e1, 0x178e, 0x01af, 0x169b, 0x06f6, 0x16ac, 0x1687, 0x169e, 0x01bf, 0x03c1, 0x035e, 0x0676, 0x0119, 0x036b, 0x0669, 0x007e, 0x6996, 0x1798, 0x01bc, 0x0663, 0x1689, 0x03dd, 0x017f, 0x012f, 0x066b, 0x033f, 0x0660, 0x0182, 0x03d7, 0x03d5, 0x179a, 0x0357, 0x0117, 0x03db, 0x0000, 0x06b3, 0x03c7, 0x003d, 0x17e8, 0x03c6, 0x16ad, 0x16e9, 0x03c5, 0x03c3, 0x03c0, 0x06b7, 0x03fc, 0x166a, 0x01ab, 0x01bd, 0x0180, 0x1698, 0x1be4, 0x035b, 0x1697, 0x036c, 0x077e, 0x06b9, 0x07f8, 0x003f, 0x0673, 0x07e0, 0x0778, 0x0672, 0x07b1, 0x07b0, 0x1681, 0x07e6, 0x0358, 0x06f0, 0x066f, 0x1686, 0x0001, 0x003c, 0x0356, 0x0359, 0x001e, 0x035a, 0x033d, 0x0690, 0x07f1, 0x168b, 0x01aa, 0x001b, 0x01a8, 0x0198, 0x000f, 0x0199};
+  inline static constexpr uint16_t nodes[] = {4, 222, 16, 21, 27, 34, 45, 48, 53, 62, 70, 78, 85, 9, 90, 103, 111, 115, 120, 125, 128, 135, 139, 142, 149, 158, 169, 173, 175, 182, 190, 196, 200, 206, 213, 223, 224, 228, 233, 235, 241, 247, 250, 257, 263, 267, 269, 275, 277, 280, 287, 289, 295, 297, 302, 307, 315, 319, 323, 328, 334, 338, 344, 349, 351, 354, 358, 365, 367, 372, 376, 383, 388, 396, 401, 406, 414, 419, 422, 428, 431, 437, 443, 445, 451, 456, 462, 466, 477, 480, 484, 495, 498, 503, 507, 513, 517, 518, 522, 530, 536, 542, 64, 551, 557, 561, 566, 569, 573, 578, 587, 592, 598, 606, 615, 623, 630, 634, 636, 642, 648, 652, 661, 664, 669, 675, 682, 688, 696, 698, 700, 704, 706, 712, 717, 722, 731, 732, 737, 745, 330, 750, 759, 762, 765, 771, 776, 778, 781, 787, 793, 794, 798, 804, 808, 813, 819, 821, 357, 823, 829, 31, 830, 836, 839, 841, 846, 849, 853, 857, 0, 861, 863, 869, 870, 876, 885, 889, 893, 895, 896, 903, 136, 908, 911, 917, 920, 926, 930, 933, 937, 940, 944, 949, 952, 955, 959, 960, 968, 970, 973, 974, 981, 982, 988, 990, 393, 994, 997, 998, 1000, 1005, 1006, 1010, 1019, 1020, 1023, 1029, 1030, 1033, 1036, 1042, 81, 1047, 4, 4, 7, 4, 4, 11, 12, 9, 10, 0, 13, 14, 4, 4, 6, 2, 8, 18, 6, 4, 6, 45, 4, 0, 49, 8, 0, 4, 6, 8, 8, 6, 8, 4, 4, 30, 65, 28, 0, 9, 2, 0, 0, 9, 36, 77, 6, 0, 0, 4, 8, 2, 40, 42, 14, 8, 36, 0, 9, 46, 2, 4, 6, 2, 8, 50, 0, 4, 7, 109, 6, 0, 4, 5, 54, 2, 8, 58, 121, 56, 0, 17, 6, 0, 4, 7, 64, 0, 4, 9, 22, 66, 68, 17, 2, 0, 0, 3, 4, 8, 7, 74, 153, 72, 0, 2, 6, 8, 4, 4, 8, 2, 80, 82, 4, 4, 55, 12, 54, 82, 177, 86, 0, 17, 4, 0, 4, 6, 93, 4, 6, 92, 8, 8, 95, 184, 94, 98, 188, 97, 100, 13, 4, 0, 4, 7, 104, 0, 2, 9, 12, 106, 109, 2, 2, 4, 6, 28, 112, 2, 4, 8, 233, 6, 0, 18, 36, 118, 209, 2, 0, 2, 8, 122, 6, 8, 116, 253, 18, 0, 0, 2, 6, 16, 18, 83, 36, 131, 132, 101, 8, 0, 4, 22, 137, 2, 2, 8, 281, 30, 0, 4, 4, 19, 0, 9, 18, 12, 144, 147, 4, 5, 6, 301, 2, 0, 305, 8, 0, 8, 150, 153, 0, 154, 157, 6, 6, 8, 12, 8, 161, 321, 4, 0, 6, 4, 8, 324, 164, 166, 4, 4, 104, 12, 8, 170, 60, 97, 150, 8, 6, 72, 8, 6, 73, 357, 8, 0, 144, 177, 180, 10, 6, 8, 369, 2, 0, 0, 7, 184, 18, 186, 188, 0, 2, 5, 12, 8, 193, 389, 50, 0, 4, 64, 184, 397, 2, 0, 4, 6, 9, 225, 8, 0, 14, 202, 204, 13, 2, 0, 0, 5, 208, 2, 30, 210, 8, 7, 8, 6, 6, 214, 433, 4, 0, 18, 214, 218, 441, 6, 0, 0, 9, 152, 8, 6, 109, 453, 140, 0, 4, 5, 8, 6, 18, 230, 16, 37, 80, 0, 4, 6, 0, 3, 236, 16, 22, 239, 4, 7, 230, 0, 4, 243, 489, 230, 0, 2, 2, 50, 497, 8, 0, 4, 5, 72, 8, 215, 252, 509, 4, 0, 0, 2, 7, 2, 30, 258, 10, 30, 260, 12, 8, 36, 2, 42, 264, 4, 30, 109, 2, 4, 22, 4, 8, 22, 10, 270, 272, 12, 8, 112, 281, 4, 0, 8, 31, 278, 10, 6, 68, 4, 4, 283, 569, 282, 0, 60, 65, 208, 4, 4, 65, 4, 8, 55, 6, 290, 292, 208, 109, 112, 0, 2, 4, 14, 8, 298, 601, 10, 0, 45, 2, 0, 44, 69, 304, 4, 4, 9, 0, 6, 10, 16, 10, 311, 22, 308, 312, 461, 2, 0, 12, 8, 317, 8, 6, 104, 16, 122, 320, 4, 5, 92, 649, 6, 0, 18, 92, 326, 18, 36, 64, 0, 2, 65, 128, 330, 332, 8, 6, 39, 673, 8, 0, 0, 9, 22, 8, 7, 72, 10, 340, 342, 473, 2, 0, 16, 50, 346, 12, 8, 205, 2, 2, 30, 705, 8, 0, 4, 8, 30, 16, 136, 357, 4, 8, 104, 2, 6, 360, 6, 360, 362, 12, 8, 104, 12, 72, 117, 6, 4, 368, 741, 72, 0, 165, 6, 0, 148, 167, 374, 101, 2, 0, 0, 3, 8, 16, 378, 381, 16, 36, 83, 769, 6, 0, 0, 83, 386, 4, 8, 37, 12, 8, 37, 785, 8, 0, 4, 391, 394, 12, 8, 113, 2, 298, 398, 185, 2, 0, 0, 7, 92, 18, 402, 404, 8, 8, 209, 4, 6, 208, 821, 408, 0, 8, 409, 412, 8, 6, 74, 16, 75, 416, 16, 22, 36, 841, 6, 0, 0, 9, 150, 0, 6, 425, 148, 150, 427, 209, 8, 0, 8, 6, 75, 4, 9, 74, 869, 432, 0, 12, 166, 230, 0, 9, 230, 881, 438, 0, 16, 36, 50, 0, 3, 22, 10, 8, 446, 897, 10, 0, 4, 9, 92, 10, 6, 452, 909, 92, 0, 4, 8, 80, 12, 37, 458, 921, 8, 0, 4, 4, 50, 8, 136, 465, 0, 7, 8, 4, 4, 469, 4, 8, 469, 10, 8, 472, 940, 473, 474, 6, 4, 214, 10, 146, 478, 2, 8, 74, 965, 432, 0, 0, 3, 6, 8, 6, 487, 0, 8, 488, 4, 486, 491, 985, 488, 0, 16, 50, 160, 993, 50, 0, 225, 6, 0, 1001, 8, 0, 0, 7, 112, 16, 112, 505, 14, 8, 308, 0, 6, 509, 1021, 308, 0, 0, 7, 36, 1029, 8, 0, 184, 117, 118, 0, 6, 8, 0, 36, 521, 217, 6, 0, 10, 8, 524, 10, 6, 526, 1057, 524, 0, 0, 4, 308, 14, 8, 532, 1069, 308, 0, 2, 2, 54, 12, 54, 230, 1081, 538, 0, 6, 6, 230, 1089, 8, 0, 8, 230, 547, 14, 544, 548, 617, 6, 0, 8, 8, 552, 12, 552, 554, 0, 7, 230, 1117, 160, 0, 0, 6, 308, 4, 22, 563, 1129, 8, 0, 12, 8, 279, 14, 36, 68, 1141, 8, 0, 0, 2, 8, 8, 65, 574, 0, 64, 577, 16, 54, 209, 8, 8, 54, 18, 208, 582, 110, 580, 584, 1149, 6, 0, 6, 4, 258, 1181, 588, 0, 0, 2, 105, 733, 2, 0, 208, 594, 596, 6, 8, 92, 0, 8, 601, 0, 6, 603, 1209, 600, 0, 2, 2, 6, 1217, 4, 0, 6, 4, 608, 16, 610, 612, 4, 9, 208, 8, 208, 617, 12, 8, 619, 1241, 616, 0, 0, 5, 184, 1249, 2, 0, 8, 7, 626, 18, 624, 628, 2, 10, 28, 1265, 8, 0, 453, 8, 0, 18, 30, 108, 4, 30, 639, 16, 638, 641, 12, 8, 575, 8, 575, 644, 0, 31, 646, 0, 4, 184, 0, 122, 651, 8, 7, 486, 1309, 486, 0, 4, 8, 486, 1317, 656, 0, 2, 2, 184, 1325, 30, 0, 61, 2, 0, 12, 214, 667, 12, 8, 10, 0, 10, 19, 1345, 670, 0, 2, 6, 112, 0, 9, 676, 12, 112, 679, 16, 678, 681, 0, 6, 9, 4, 5, 684, 8, 19, 686, 2, 6, 36, 4, 6, 37, 16, 690, 693, 1389, 6, 0, 72, 64, 83, 1217, 408, 0, 10, 8, 36, 18, 64, 702, 461, 202, 0, 12, 8, 298, 4, 4, 299, 1421, 708, 0, 6, 8, 236, 1429, 104, 0, 4, 4, 609, 12, 8, 718, 1441, 608, 0, 4, 6, 105, 6, 4, 724, 18, 104, 726, 1457, 724, 0, 581, 8, 0, 0, 8, 82, 6, 608, 734, 8, 6, 9, 14, 36, 738, 4, 7, 8, 1485, 740, 0, 4, 29, 104, 8, 8, 746, 1497, 28, 0, 0, 4, 231, 461, 6, 0, 10, 752, 754, 1513, 2, 0, 12, 8, 123, 208, 122, 761, 8, 8, 343, 429, 4, 0, 12, 214, 767, 4, 767, 768, 8, 8, 141, 2, 6, 772, 1549, 140, 0, 38, 36, 684, 2, 28, 36, 973, 4, 0, 4, 9, 486, 12, 782, 785, 6, 4, 684, 10, 10, 788, 1581, 8, 0, 0, 9, 304, 129, 2, 0, 1593, 4, 0, 12, 8, 11, 2, 8, 800, 1605, 12, 0, 12, 8, 166, 1613, 50, 0, 0, 4, 185, 1621, 160, 0, 0, 8, 37, 12, 36, 83, 1633, 814, 0, 100, 137, 230, 16, 22, 608, 581, 4, 0, 12, 8, 825, 6, 290, 826, 0, 36, 64, 0, 6, 150, 10, 8, 832, 1669, 150, 0, 16, 18, 104, 4, 380, 767, 0, 5, 6, 1685, 2, 0, 38, 72, 844, 4, 50, 380, 12, 8, 308, 2, 82, 850, 21, 2, 0, 16, 50, 854, 130, 92, 166, 4, 166, 858, 84, 104, 608, 8, 6, 739, 4, 8, 739, 2, 864, 866, 37, 8, 0, 4, 7, 468, 1745, 4, 0, 18, 468, 874, 4, 8, 50, 0, 5, 8, 4, 6, 881, 16, 879, 882, 2, 6, 18, 1773, 204, 0, 4, 9, 684, 1781, 30, 0, 12, 104, 214, 61, 8, 0, 8, 6, 208, 417, 4, 0, 16, 898, 901, 18, 30, 54, 4, 4, 905, 1813, 30, 0, 16, 50, 73, 21, 4, 0, 2, 6, 10, 16, 912, 914, 4, 4, 214, 1837, 214, 0, 0, 9, 82, 2, 6, 82, 38, 922, 924, 8, 6, 36, 1857, 8, 0, 56, 54, 259, 6, 4, 160, 1869, 104, 0, 0, 6, 324, 1877, 92, 0, 8, 31, 64, 62, 666, 942, 4, 8, 51, 332, 469, 946, 4, 6, 193, 1901, 8, 0, 2, 8, 30, 8, 6, 161, 16, 164, 956, 1701, 8, 0, 8, 9, 74, 8, 8, 75, 1929, 6, 0, 10, 962, 966, 72, 64, 117, 130, 166, 608, 128, 167, 380, 0, 2, 738, 429, 36, 0, 1476, 977, 978, 617, 300, 0, 10, 8, 108, 18, 524, 984, 1973, 984, 0, 128, 74, 150, 8, 104, 360, 1985, 2, 0, 2, 116, 150, 0, 9, 104, 281, 50, 0, 4, 6, 72, 2005, 54, 0, 0, 9, 500, 281, 6, 0, 18, 880, 1008, 0, 9, 742, 2, 8, 742, 8, 6, 1014, 2033, 1012, 0, 529, 6, 0, 8, 65, 230, 12, 8, 51, 4, 4, 1024, 2053, 136, 0, 4, 72, 249, 2, 28, 166, 6, 8, 50, 2069, 50, 0, 1685, 8, 0, 6, 4, 1038, 2081, 4, 0, 2, 8, 36, 60, 36, 1044};
+  // clang-format on
 };
 
 } /* namespace mockturtle */
@@ -0,0 +1,615 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file pass_manager.hpp
+  \brief Runs scripted flows of passes with shared analyses
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "../traits.hpp"
+#include "../utils/stopwatch.hpp"
+#include "../views/depth_view.hpp"
+#include "cleanup.hpp"
+#include "cut_rewriting.hpp"
+#include "mig_algebraic_rewriting.hpp"
+#include "refactoring.hpp"
+#include "resubstitution.hpp"
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace mockturtle
+{
+
+/*! \brief Analyses that are shared between passes.
+ *
+ * Values can be combined with `|` to describe a set of analyses.
+ */
+enum class analysis : uint32_t
+{
+  none = 0u,
+  levels = 1u,
+  all = 1u
+};
+
+inline constexpr analysis operator|( analysis a, analysis b )
+{
+  return static_cast<analysis>( static_cast<uint32_t>( a ) | static_cast<uint32_t>( b ) );
+}
+
+inline constexpr analysis operator&( analysis a, analysis b )
+{
+  return static_cast<analysis>( static_cast<uint32_t>( a ) & static_cast<uint32_t>( b ) );
+}
+
+inline constexpr analysis operator~( analysis a )
+{
+  return static_cast<analysis>( ~static_cast<uint32_t>( a ) & static_cast<uint32_t>( analysis::all ) );
+}
+
+/*! \brief Statistics for analysis_manager. */
+struct analysis_manager_stats
+{
+  /*! \brief Time to compute analyses. */
+  stopwatch<>::duration time_total{0};
+
+  /*! \brief Number of times an analysis was computed. */
+  uint32_t num_computed{0};
+
+  /*! \brief Number of times a valid analysis was reused. */
+  uint32_t num_reused{0};
+};
+
+namespace detail
+{
+
+template<class Ntk, class = void>
+struct has_events : std::false_type
+{
+};
+
+template<class Ntk>
+struct has_events<Ntk, std::void_t<decltype( std::declval<Ntk const&>().events() )>> : std::true_type
+{
+};
+
+template<class Ntk>
+inline constexpr bool has_events_v = has_events<Ntk>::value;
+
+/* resident memory of the process in bytes, or 0 if it cannot be determined */
+inline uint64_t resident_memory()
+{
+#ifdef __linux__
+  std::ifstream in( "/proc/self/statm" );
+  uint64_t size{0}, resident{0};
+  if ( in >> size >> resident )
+  {
+    return resident * static_cast<uint64_t>( sysconf( _SC_PAGESIZE ) );
+  }
+#endif
+  return 0u;
+}
+
+} // namespace detail
+
+/*! \brief Caches analyses of a network between passes.
+ *
+ * Each analysis is computed when it is requested first, and reused until it
+ * is invalidated.  Analyses are snapshots: they are not updated while a pass
+ * modifies the network, and a pass must report which analyses it changed.
+ * Invalidated analyses are released immediately.  If a pass replaces the
+ * network, e.g., by calling `cleanup_dangling`, all analyses are recomputed.
+ *
+ * The levels are a `depth_view` on the network, which can be passed to
+ * algorithms that require levels, such that they do not compute them again.
+ * Fanouts, cuts, and simulation values are not shared, since the algorithms
+ * keep their own copies up-to-date while they modify the network.
+ *
+ * **Required network functions:**
+ * - `size`
+ * - `foreach_node`
+ * - `foreach_fanin`
+ * - `foreach_po`
+ */
+template<class Ntk>
+class analysis_manager
+{
+public:
+  explicit analysis_manager( Ntk& ntk, analysis_manager_stats* pst = nullptr )
+      : _ntk( ntk ),
+        _pst( pst )
+  {
+  }
+
+  ~analysis_manager()
+  {
+    if ( _pst )
+    {
+      *_pst = _st;
+    }
+  }
+
+  analysis_manager( analysis_manager const& ) = delete;
+  analysis_manager& operator=( analysis_manager const& ) = delete;
+
+  /*! \brief Returns the network. */
+  Ntk& network()
+  {
+    return _ntk;
+  }
+
+  /*! \brief Returns a depth view with up-to-date levels. */
+  depth_view<Ntk>& levels()
+  {
+    ensure( analysis::levels, [&]() { _levels.emplace( _ntk ); } );
+    return *_levels;
+  }
+
+  /*! \brief Checks whether all analyses in `a` are valid. */
+  bool is_valid( analysis a ) const
+  {
+    return ( _valid & a ) == a && !replaced();
+  }
+
+  /*! \brief Invalidates and releases all analyses in `a`. */
+  void invalidate( analysis a )
+  {
+    _valid = _valid & ~a;
+
+    if ( ( a & analysis::levels ) != analysis::none )
+    {
+      _levels.reset();
+    }
+
+    /* the views of the analyses share the storage, keep it only while needed */
+    if ( _valid == analysis::none )
+    {
+      _storage.reset();
+    }
+  }
+
+private:
+  /* network was replaced since the analyses were computed */
+  bool replaced() const
+  {
+    return _ntk._storage != _storage;
+  }
+
+  template<class Fn>
+  void ensure( analysis a, Fn&& compute )
+  {
+    if ( replaced() )
+    {
+      invalidate( analysis::all );
+      _storage = _ntk._storage;
+    }
+
+    if ( ( _valid & a ) == a )
+    {
+      ++_st.num_reused;
+      return;
+    }
+
+    stopwatch t( _st.time_total );
+    compute();
+    _valid = _valid | a;
+    ++_st.num_computed;
+  }
+
+private:
+  Ntk& _ntk;
+  analysis_manager_stats _st;
+  analysis_manager_stats* _pst;
+
+  decltype( Ntk::_storage ) _storage;
+  analysis _valid{analysis::none};
+
+  std::optional<depth_view<Ntk>> _levels;
+};
+
+/*! \brief A pass of a flow.
+ *
+ * A pass runs an algorithm on the network, may use the analyses of the
+ * analysis manager, and returns the analyses that are changed by it.  It
+ * returns `analysis::none` if it did not modify the network.
+ */
+template<class Ntk>
+using pass_function = std::function<analysis( Ntk&, analysis_manager<Ntk>& )>;
+
+/*! \brief Parameters for pass_manager. */
+struct pass_manager_params
+{
+  /*! \brief Be verbose. */
+  bool verbose{false};
+};
+
+/*! \brief Statistics of a single pass. */
+struct pass_stats
+{
+  /*! \brief Name of the pass. */
+  std::string name;
+
+  /*! \brief Runtime of the pass. */
+  stopwatch<>::duration time{0};
+
+  /*! \brief Number of gates before the pass. */
+  uint32_t gates_before{0};
+
+  /*! \brief Number of gates after the pass. */
+  uint32_t gates_after{0};
+
+  /*! \brief Resident memory after the pass in bytes. */
+  uint64_t memory{0};
+
+  /*! \brief Change of resident memory during the pass in bytes. */
+  int64_t memory_delta{0};
+
+  /*! \brief Analyses changed by the pass. */
+  analysis changed{analysis::none};
+};
+
+/*! \brief Statistics for pass_manager. */
+struct pass_manager_stats
+{
+  /*! \brief Total runtime. */
+  stopwatch<>::duration time_total{0};
+
+  /*! \brief Statistics of the shared analyses. */
+  analysis_manager_stats analysis_st;
+
+  /*! \brief Statistics of each executed pass. */
+  std::vector<pass_stats> passes;
+
+  void report() const
+  {
+    for ( auto const& p : passes )
+    {
+      std::cout << fmt::format( "[i] {:<12} gates = {:>7} -> {:>7}   time = {:>5.2f} secs   mem = {:>7.2f} MB ({:+.2f} MB)\n",
+                                p.name, p.gates_before, p.gates_after, to_seconds( p.time ),
+                                p.memory / 1048576.0, p.memory_delta / 1048576.0 );
+    }
+    std::cout << fmt::format( "[i] total time     = {:>5.2f} secs\n", to_seconds( time_total ) );
+    std::cout << fmt::format( "[i] analyses time  = {:>5.2f} secs\n", to_seconds( analysis_st.time_total ) );
+    std::cout << fmt::format( "[i] - computed     = {:>5}\n", analysis_st.num_computed );
+    std::cout << fmt::format( "[i] - reused       = {:>5}\n", analysis_st.num_reused );
+  }
+};
+
+/*! \brief Runs scripted flows of passes.
+ *
+ * Passes are registered under a name and a flow is a script of pass names
+ * separated by semicolons, e.g., ``"rs; rw; cleanup; rs"``.  All passes of a
+ * flow share an `analysis_manager`, and analyses are only recomputed if a
+ * pass reports that it changed them.  Network events that a pass registers
+ * are removed after the pass, such that views which were created by the
+ * pass do not remain attached to the network.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      mig_network mig = ...;
+
+      mig_npn_resynthesis resyn;
+      pass_manager<mig_network> pm;
+      pm.add_pass( "rw", cut_rewriting_pass<mig_network>( resyn ) );
+      pm.add_pass( "rs", resubstitution_pass<mig_network>() );
+      pm.add_pass( "b", depth_rewriting_pass<mig_network>() );
+      pm.add_pass( "cleanup", cleanup_pass<mig_network>() );
+      pm.run( mig, "rs; rw; cleanup; b; rs; cleanup" );
+   \endverbatim
+ */
+template<class Ntk>
+class pass_manager
+{
+public:
+  explicit pass_manager( pass_manager_params const& ps = {} )
+      : _ps( ps )
+  {
+  }
+
+  /*! \brief Registers a pass under a name. */
+  void add_pass( std::string const& name, pass_function<Ntk> const& fn )
+  {
+    _passes[name] = fn;
+  }
+
+  /*! \brief Checks whether a pass is registered. */
+  bool has_pass( std::string const& name ) const
+  {
+    return _passes.find( name ) != _passes.end();
+  }
+
+  /*! \brief Runs a flow.
+   *
+   * Returns `false` without running any pass if the script contains a name
+   * that is not registered.
+   */
+  bool run( Ntk& ntk, std::string const& script, pass_manager_stats* pst = nullptr )
+  {
+    const auto names = parse( script );
+    for ( auto const& name : names )
+    {
+      if ( !has_pass( name ) )
+      {
+        std::cerr << "[e] unknown pass " << name << "\n";
+        return false;
+      }
+    }
+
+    pass_manager_stats st;
+    {
+      stopwatch t( st.time_total );
+      analysis_manager<Ntk> am( ntk, &st.analysis_st );
+
+      for ( auto const& name : names )
+      {
+        pass_stats pst_pass;
+        pst_pass.name = name;
+        pst_pass.gates_before = ntk.num_gates();
+        const auto memory = detail::resident_memory();
+
+        const auto storage = ntk._storage;
+        const auto events = event_sizes( ntk );
+        {
+          stopwatch t_pass( pst_pass.time );
+          pst_pass.changed = _passes.at( name )( ntk, am );
+        }
+        if ( ntk._storage == storage )
+        {
+          restore_events( ntk, events );
+        }
+        am.invalidate( pst_pass.changed );
+
+        pst_pass.gates_after = ntk.num_gates();
+        pst_pass.memory = detail::resident_memory();
+        pst_pass.memory_delta = static_cast<int64_t>( pst_pass.memory ) - static_cast<int64_t>( memory );
+        st.passes.push_back( pst_pass );
+      }
+    }
+
+    if ( _ps.verbose )
+    {
+      st.report();
+    }
+
+    if ( pst )
+    {
+      *pst = st;
+    }
+    return true;
+  }
+
+private:
+  static std::vector<std::string> parse( std::string const& script )
+  {
+    std::vector<std::string> names;
+    std::string::size_type pos = 0u;
+    while ( pos <= script.size() )
+    {
+      auto end = script.find( ';', pos );
+      if ( end == std::string::npos )
+      {
+        end = script.size();
+      }
+
+      const auto first = script.find_first_not_of( " \t\n", pos );
+      if ( first != std::string::npos && first < end )
+      {
+        const auto last = script.find_last_not_of( " \t\n", end - 1 );
+        names.push_back( script.substr( first, last - first + 1 ) );
+      }
+      pos = end + 1;
+    }
+    return names;
+  }
+
+  static std::array<std::size_t, 3> event_sizes( Ntk const& ntk )
+  {
+    if constexpr ( detail::has_events_v<Ntk> )
+    {
+      auto const& events = ntk.events();
+      return {events.on_add.size(), events.on_modified.size(), events.on_delete.size()};
+    }
+    else
+    {
+      (void)ntk;
+      return {};
+    }
+  }
+
+  static void restore_events( Ntk const& ntk, std::array<std::size_t, 3> const& sizes )
+  {
+    if constexpr ( detail::has_events_v<Ntk> )
+    {
+      auto& events = ntk.events();
+      events.on_add.resize( std::min( events.on_add.size(), sizes[0] ) );
+      events.on_modified.resize( std::min( events.on_modified.size(), sizes[1] ) );
+      events.on_delete.resize( std::min( events.on_delete.size(), sizes[2] ) );
+    }
+    else
+    {
+      (void)ntk;
+      (void)sizes;
+    }
+  }
+
+private:
+  pass_manager_params _ps;
+  std::unordered_map<std::string, pass_function<Ntk>> _passes;
+};
+
+namespace detail
+{
+
+/* records whether an in-place algorithm modified the network */
+template<class Ntk>
+class modification_tracker
+{
+public:
+  explicit modification_tracker( Ntk const& ntk )
+      : ntk( ntk ),
+        size( ntk.size() ),
+        num_gates( ntk.num_gates() )
+  {
+    if constexpr ( has_events_v<Ntk> )
+    {
+      auto& events = ntk.events();
+      positions = {events.on_add.size(), events.on_modified.size(), events.on_delete.size()};
+      events.on_add.emplace_back( [this]( auto const& ) { modified = true; } );
+      events.on_modified.emplace_back( [this]( auto const&, auto const& ) { modified = true; } );
+      events.on_delete.emplace_back( [this]( auto const& ) { modified = true; } );
+    }
+  }
+
+  ~modification_tracker()
+  {
+    if constexpr ( has_events_v<Ntk> )
+    {
+      auto& events = ntk.events();
+      events.on_add.erase( events.on_add.begin() + positions[0] );
+      events.on_modified.erase( events.on_modified.begin() + positions[1] );
+      events.on_delete.erase( events.on_delete.begin() + positions[2] );
+    }
+  }
+
+  modification_tracker( modification_tracker const& ) = delete;
+  modification_tracker& operator=( modification_tracker const& ) = delete;
+
+  analysis changes() const
+  {
+    if ( modified || ntk.size() != size || ntk.num_gates() != num_gates )
+    {
+      return analysis::all;
+    }
+    return analysis::none;
+  }
+
+private:
+  Ntk const& ntk;
+  uint32_t size;
+  uint32_t num_gates;
+  bool modified{false};
+  std::array<std::size_t, 3> positions{};
+};
+
+} // namespace detail
+
+/*! \brief Pass that removes dangling nodes with `cleanup_dangling`. */
+template<class Ntk>
+pass_function<Ntk> cleanup_pass()
+{
+  return []( Ntk& ntk, analysis_manager<Ntk>& ) {
+    ntk = cleanup_dangling( ntk );
+    return analysis::all;
+  };
+}
+
+/*! \brief Pass for `cut_rewriting` with a rewriting function.
+ *
+ * Does not use the shared levels, since `cut_rewriting` does not take
+ * levels into account.
+ */
+template<class Ntk, class RewritingFn>
+pass_function<Ntk> cut_rewriting_pass( RewritingFn const& rewriting_fn, cut_rewriting_params const& ps = {} )
+{
+  return [fn = rewriting_fn, ps]( Ntk& ntk, analysis_manager<Ntk>& ) mutable {
+    detail::modification_tracker<Ntk> tracker( ntk );
+    cut_rewriting( ntk, fn, ps );
+    return tracker.changes();
+  };
+}
+
+/*! \brief Pass for `refactoring` with a refactoring function.
+ *
+ * Does not use the shared levels, since `refactoring` does not take levels
+ * into account.
+ */
+template<class Ntk, class RefactoringFn>
+pass_function<Ntk> refactoring_pass( RefactoringFn const& refactoring_fn, refactoring_params const& ps = {} )
+{
+  return [fn = refactoring_fn, ps]( Ntk& ntk, analysis_manager<Ntk>& ) mutable {
+    detail::modification_tracker<Ntk> tracker( ntk );
+    refactoring( ntk, fn, ps );
+    return tracker.changes();
+  };
+}
+
+/*! \brief Pass for `resubstitution`.
+ *
+ * Runs on the shared levels unless several threads are used.
+ */
+template<class Ntk>
+pass_function<Ntk> resubstitution_pass( resubstitution_params const& ps = {} )
+{
+  return [ps]( Ntk& ntk, analysis_manager<Ntk>& am ) {
+    detail::modification_tracker<Ntk> tracker( ntk );
+    if ( ps.num_threads > 1u )
+    {
+      resubstitution( ntk, ps );
+    }
+    else
+    {
+      resubstitution( am.levels(), ps );
+    }
+    return tracker.changes();
+  };
+}
+
+/*! \brief Pass for `mig_algebraic_depth_rewriting`.
+ *
+ * Runs on the shared levels, which are kept up-to-date by the algorithm.
+ * Keeps the levels valid.
+ */
+template<class Ntk>
+pass_function<Ntk> depth_rewriting_pass( mig_algebraic_depth_rewriting_params const& ps = {} )
+{
+  return [ps]( Ntk& ntk, analysis_manager<Ntk>& am ) {
+    detail::modification_tracker<Ntk> tracker( ntk );
+    mig_algebraic_depth_rewriting( am.levels(), ps );
+    return tracker.changes() & ~analysis::levels;
+  };
+}
+
+} /* namespace mockturtle */
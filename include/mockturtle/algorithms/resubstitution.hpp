@@ -32,7 +32,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "../traits.hpp"
+#include "../utils/node_map.hpp"
 #include "../utils/progress_bar.hpp"
 #include "../utils/stopwatch.hpp"
 #include "../views/depth_view.hpp"
@@ -78,6 +91,27 @@ struct resubstitution_params
 
   /*! \brief Use don't cares for optimization. */
   bool use_dont_cares{false};
+
+  /*! \brief Parameters for the don't-care computation (with `use_dont_cares`). */
+  windowed_dont_cares_params dont_cares_ps{};
+
+  /*! \brief Number of threads used to compute resubstitution candidates.
+   *
+   * With more than one thread, the roots are processed in rounds of
+   * `batch_size` nodes.  Every thread keeps a private copy of the network,
+   * which is updated with the changes of the previous round, and computes
+   * windows and candidates for a slice of the roots on its copy.  A
+   * sequential commit step then substitutes the candidates in order, but
+   * only if the window (MFFC and divisors) of a candidate was not changed by
+   * previously committed candidates.  The roots of stale candidates are
+   * evaluated again in the next round (at most three times in total).  The
+   * parallel mode requires the network to be a
+   * plain network type (not a view) and is not used with `use_dont_cares`.
+   */
+  uint32_t num_threads{1u};
+
+  /*! \brief Number of roots evaluated per round in parallel mode. */
+  uint32_t batch_size{4096u};
 };
 
 /*! \brief Statistics for resubstitution.
@@ -108,6 +142,9 @@ struct resubstitution_stats
   /*! \brief Accumulated runtime for simulation. */
   stopwatch<>::duration time_simulation{0};
 
+  /*! \brief Statistics of the don't-care computation. */
+  windowed_dont_cares_stats dont_cares_st;
+
   /*! \brief Initial network size (before resubstitution) */
   uint64_t initial_size{0};
 
@@ -120,6 +157,15 @@ struct resubstitution_stats
   /*! \brief Total number of gain  */
   uint64_t estimated_gain{0};
 
+  /*! \brief Total number of simulated divisors  */
+  uint64_t num_simulated_divisors{0};
+
+  /*! \brief Total number of divisors reused from previous windows  */
+  uint64_t num_reused_divisors{0};
+
+  /*! \brief Number of candidates rejected in parallel mode because their window changed  */
+  uint64_t num_stale_candidates{0};
+
   void report() const
   {
     std::cout << fmt::format( "[i] total time                                                  ({:>5.2f} secs)\n", to_seconds( time_total ) );
@@ -128,9 +174,13 @@ struct resubstitution_stats
     std::cout << fmt::format( "[i]   divs time                                                 ({:>5.2f} secs)\n", to_seconds( time_divs ) );
     std::cout << fmt::format( "[i]   simulation time                                           ({:>5.2f} secs)\n", to_seconds( time_simulation ) );
     std::cout << fmt::format( "[i]   evaluation time                                           ({:>5.2f} secs)\n", to_seconds( time_eval ) );
+    std::cout << fmt::format( "[i]   don't cares time                                          ({:>5.2f} secs)\n", to_seconds( dont_cares_st.time_total ) );
     std::cout << fmt::format( "[i]   substitute                                                ({:>5.2f} secs)\n", to_seconds( time_substitute ) );
     std::cout << fmt::format( "[i] total divisors            = {:8d}\n", ( num_total_divisors ) );
     std::cout << fmt::format( "[i] total leaves              = {:8d}\n", ( num_total_leaves ) );
+    std::cout << fmt::format( "[i] simulated divisors        = {:8d}\n", ( num_simulated_divisors ) );
+    std::cout << fmt::format( "[i] reused divisors           = {:8d}\n", ( num_reused_divisors ) );
+    std::cout << fmt::format( "[i] stale candidates          = {:8d}\n", ( num_stale_candidates ) );
     std::cout << fmt::format( "[i] estimated gain            = {:8d} ({:>5.2f}%)\n",
                               estimated_gain, ( ( 100.0 * estimated_gain ) / initial_size ) );
   }
@@ -247,6 +297,27 @@ private:
   Ntk const& ntk;
 };
 
+template<typename TT>
+struct simulator_num_words
+{
+  static constexpr uint32_t value = 0u; /* determined at runtime */
+};
+
+template<uint32_t NumVars>
+struct simulator_num_words<kitty::static_truth_table<NumVars>>
+{
+  static constexpr uint32_t value = NumVars <= 6 ? 1u : ( 1u << ( NumVars - 6 ) );
+};
+
+/* Simulates divisors of a window into a flat arena of truth table words.
+ *
+ * Slot 0 holds the constant, slots 1 to `max_pis` hold the projections, and
+ * the remaining slots hold the (normalized) truth tables of inner divisors.
+ * Leaves keep their variable across windows, and an inner divisor that was
+ * simulated in an earlier window is reused if it only depends on variables of
+ * leaves in the current window.  Arena and variables are reset if the arena
+ * runs full or no variable is left for a new leaf.
+ */
 template<typename Ntk, typename TT>
 class simulator
 {
@@ -256,82 +327,465 @@ public:
   using truthtable_t = TT;
 
   explicit simulator( Ntk const& ntk, uint32_t num_divisors, uint32_t max_pis )
-      : ntk( ntk ), num_divisors( num_divisors ), tts( num_divisors + 1 ), node_to_index( ntk.size(), 0u ), phase( ntk.size(), false )
+      : ntk( ntk ),
+        max_pis( max_pis ),
+        capacity( 1u + max_pis + 4u * num_divisors ),
+        node_to_index( ntk.size(), 0u ),
+        node_epoch( ntk.size(), 0u ),
+        node_support( ntk.size(), 0u ),
+        phase( ntk.size(), false ),
+        signatures( ntk, 0u )
   {
+    assert( max_pis <= 64u );
+
     auto tt = kitty::create<truthtable_t>( max_pis );
-    tts[0] = tt;
+    num_words = static_cast<uint32_t>( tt.num_blocks() );
+    last_word_mask = max_pis < 6u ? ( ( uint64_t( 1 ) << ( 1u << max_pis ) ) - 1u ) : ~uint64_t( 0 );
+    words.resize( capacity * num_words, 0u );
 
-    for ( auto i = 0; i < tt.num_vars(); ++i )
+    for ( auto i = 0u; i < max_pis; ++i )
     {
       kitty::create_nth_var( tt, i );
-      tts[i + 1] = tt;
+      std::copy( tt.cbegin(), tt.cend(), slot_words( i + 1 ) );
     }
+
+    update_signatures();
   }
 
   void resize()
   {
     if ( ntk.size() > node_to_index.size() )
       node_to_index.resize( ntk.size(), 0u );
+    if ( ntk.size() > node_epoch.size() )
+      node_epoch.resize( ntk.size(), 0u );
+    if ( ntk.size() > node_support.size() )
+      node_support.resize( ntk.size(), 0u );
     if ( ntk.size() > phase.size() )
       phase.resize( ntk.size(), false );
+
+    update_signatures();
   }
 
-  void assign( node const& n, uint32_t index )
+  /*! \brief Assigns variables to the leaves of a new window.
+   *
+   * If `reuse` is false, the i-th leaf is assigned the i-th variable and no
+   * truth table is reused from previous windows.
+   */
+  void begin_window( std::vector<node> const& leaves, uint32_t num_divs, bool reuse )
   {
-    assert( n < node_to_index.size() );
-    assert( index < num_divisors + 1 );
-    node_to_index[n] = index;
+    if ( !reuse || next_slot + num_divs > capacity )
+    {
+      new_epoch();
+    }
+
+    uint32_t missing{0u};
+    for ( const auto& l : leaves )
+    {
+      if ( l != 0 && !is_variable( l ) )
+        ++missing;
+    }
+
+    if ( missing > max_pis - num_used_vars )
+    {
+      new_epoch();
+    }
+
+    leaves_support = 0u;
+    for ( const auto& l : leaves )
+    {
+      if ( l == 0 )
+        continue;
+
+      if ( !is_variable( l ) )
+      {
+        auto var = 0u;
+        while ( ( used_vars >> var ) & 1 )
+          ++var;
+        used_vars |= uint64_t( 1 ) << var;
+        ++num_used_vars;
+
+        node_to_index[l] = var + 1;
+        node_epoch[l] = epoch;
+        node_support[l] = uint64_t( 1 ) << var;
+        phase[l] = false;
+      }
+      leaves_support |= node_support[l];
+    }
+  }
+
+  /*! \brief Computes the truth table of an inner divisor, unless it can be reused. */
+  void simulate( node const& n )
+  {
+    if ( node_epoch[n] == epoch && node_to_index[n] > max_pis && ( node_support[n] & ~leaves_support ) == 0u )
+    {
+      ++num_reused;
+      return;
+    }
+
+    std::array<uint64_t const*, 3> fanin_words{};
+    std::array<uint64_t, 3> fanin_masks{};
+    uint64_t support{0u};
+    uint32_t num_fanins{0u};
+    ntk.foreach_fanin( n, [&]( const auto& f ) {
+      const auto c = ntk.get_node( f );
+      assert( c == 0 || node_epoch[c] == epoch );
+      if ( num_fanins < 3u )
+      {
+        fanin_words[num_fanins] = slot_words( node_to_index[c] );
+        fanin_masks[num_fanins] = ( ntk.is_complemented( f ) != phase[c] ) ? ~uint64_t( 0 ) : 0u;
+      }
+      support |= node_support[c];
+      ++num_fanins;
+    } );
+
+    const auto slot = next_slot++;
+    assert( slot < capacity );
+    node_to_index[n] = slot;
+    node_epoch[n] = epoch;
+    node_support[n] = support;
+
+    auto* out = slot_words( slot );
+    if ( !compute_words<simulator_num_words<TT>::value>( n, num_fanins, fanin_words, fanin_masks, out, last_word_mask ) )
+    {
+      /* generic fallback for other gate types */
+      std::vector<truthtable_t> tts;
+      ntk.foreach_fanin( n, [&]( const auto& f ) {
+        const auto c = ntk.get_node( f );
+        const auto tt = get_tt( ntk.make_signal( c ) ); /* ignore sign */
+        tts.emplace_back( phase[c] ? ~tt : tt );
+      } );
+      const auto tt = ntk.compute( n, tts.begin(), tts.end() );
+      std::copy( tt.cbegin(), tt.cend(), out );
+    }
+    ++num_simulated;
+
+    /* normalize truth table */
+    phase[n] = out[0] & 1;
+    if ( phase[n] )
+    {
+      for ( auto i = 0u; i < num_words; ++i )
+      {
+        out[i] = ~out[i];
+      }
+      out[num_words - 1] &= last_word_mask;
+    }
   }
 
   truthtable_t get_tt( signal const& s ) const
   {
-    auto const tt = tts.at( node_to_index.at( ntk.get_node( s ) ) );
+    auto tt = kitty::create<truthtable_t>( max_pis );
+    auto const* w = slot_words( node_to_index.at( ntk.get_node( s ) ) );
+    std::copy( w, w + num_words, tt.begin() );
     return ntk.is_complemented( s ) ? ~tt : tt;
   }
 
-  void set_tt( uint32_t index, truthtable_t const& tt )
+  bool get_phase( node const& n ) const
+  {
+    assert( n < phase.size() );
+    return phase.at( n );
+  }
+
+  /*! \brief Returns the global signature of a simulated signal.
+   *
+   * The signature is the result of simulating the whole network with 64
+   * random patterns, normalized with the same phase as the window truth table.
+   * Every relation between window truth tables of divisors (also under
+   * satisfiability don't cares) holds for their signatures, too, such that
+   * candidates whose signatures do not match can be skipped.  This is not
+   * the case under observability don't cares, see `use_signatures`.
+   */
+  uint64_t get_signature( signal const& s ) const
+  {
+    auto const n = ntk.get_node( s );
+    return ( phase[n] != ntk.is_complemented( s ) ) ? ~signatures[n] : signatures[n];
+  }
+
+  /*! \brief Returns whether signatures can be used to skip candidates.
+   *
+   * Under observability don't cares, a divisor may replace a node although
+   * it differs on reachable patterns, and so do their signatures.
+   */
+  bool use_signatures() const
   {
-    tts[index] = tt;
+    return signatures_enabled;
   }
 
-  void normalize( std::vector<node> const& nodes )
+  void set_use_signatures( bool value )
   {
-    for ( const auto& n : nodes )
+    signatures_enabled = value;
+  }
+
+  uint64_t num_simulated_divisors() const
+  {
+    return num_simulated;
+  }
+
+  uint64_t num_reused_divisors() const
+  {
+    return num_reused;
+  }
+
+  /*! \brief Forgets the nodes from index `size` on, which were removed from the network. */
+  void truncate( uint32_t size )
+  {
+    new_epoch();
+    num_signatures = std::min( num_signatures, size );
+  }
+
+private:
+  bool is_variable( node const& n ) const
+  {
+    return node_epoch[n] == epoch && node_to_index[n] > 0u && node_to_index[n] <= max_pis;
+  }
+
+  /* simulates the nodes added since the last call with random patterns */
+  void update_signatures()
+  {
+    signatures.resize( 0u );
+
+    std::array<uint64_t const*, 3> fanin_words{};
+    std::array<uint64_t, 3> fanin_masks{};
+    for ( ; num_signatures < ntk.size(); ++num_signatures )
     {
-      assert( n < phase.size() );
-      assert( n < node_to_index.size() );
+      auto const n = ntk.index_to_node( num_signatures );
+      if ( ntk.is_constant( n ) )
+      {
+        signatures[n] = ntk.constant_value( n ) ? ~uint64_t( 0 ) : 0u;
+        continue;
+      }
 
-      if ( n == 0 )
-        return;
+      uint32_t num_fanins{0u};
+      ntk.foreach_fanin( n, [&]( const auto& f ) {
+        if ( num_fanins < 3u )
+        {
+          fanin_words[num_fanins] = &signatures[ntk.get_node( f )];
+          fanin_masks[num_fanins] = ntk.is_complemented( f ) ? ~uint64_t( 0 ) : 0u;
+        }
+        ++num_fanins;
+      } );
 
-      auto& tt = tts[node_to_index.at( n )];
-      if ( kitty::get_bit( tt, 0 ) )
+      if ( num_fanins == 0u )
       {
-        tt = ~tt;
-        phase[n] = true;
+        signatures[n] = random_patterns();
       }
-      else
+      else if ( !compute_words<1u>( n, num_fanins, fanin_words, fanin_masks, &signatures[n], ~uint64_t( 0 ) ) )
       {
-        phase[n] = false;
+        std::vector<kitty::static_truth_table<6>> tts;
+        ntk.foreach_fanin( n, [&]( const auto& f ) {
+          tts.emplace_back();
+          tts.back()._bits = ntk.is_complemented( f ) ? ~signatures[ntk.get_node( f )] : signatures[ntk.get_node( f )];
+        } );
+        signatures[n] = ntk.compute( n, tts.begin(), tts.end() )._bits;
       }
     }
   }
 
-  bool get_phase( node const& n ) const
+  void new_epoch()
   {
-    assert( n < phase.size() );
-    return phase.at( n );
+    ++epoch;
+    next_slot = max_pis + 1;
+    used_vars = 0u;
+    num_used_vars = 0u;
+  }
+
+  uint64_t* slot_words( uint32_t slot )
+  {
+    return words.data() + slot * num_words;
+  }
+
+  uint64_t const* slot_words( uint32_t slot ) const
+  {
+    return words.data() + slot * num_words;
+  }
+
+  /* word-level kernels; NumWords is 0 if the number of words is only known at runtime */
+  template<uint32_t NumWords>
+  bool compute_words( node const& n, uint32_t num_fanins, std::array<uint64_t const*, 3> const& in, std::array<uint64_t, 3> const& m, uint64_t* out, uint64_t mask ) const
+  {
+    const auto nw = NumWords == 0u ? num_words : NumWords;
+
+    if constexpr ( has_is_and_v<Ntk> )
+    {
+      if ( num_fanins == 2u && ntk.is_and( n ) )
+      {
+        for ( auto i = 0u; i < nw; ++i )
+          out[i] = ( in[0][i] ^ m[0] ) & ( in[1][i] ^ m[1] );
+        out[nw - 1] &= mask;
+        return true;
+      }
+    }
+    if constexpr ( has_is_xor_v<Ntk> )
+    {
+      if ( num_fanins == 2u && ntk.is_xor( n ) )
+      {
+        for ( auto i = 0u; i < nw; ++i )
+          out[i] = ( in[0][i] ^ m[0] ) ^ ( in[1][i] ^ m[1] );
+        out[nw - 1] &= mask;
+        return true;
+      }
+    }
+    if constexpr ( has_is_maj_v<Ntk> )
+    {
+      if ( num_fanins == 3u && ntk.is_maj( n ) )
+      {
+        for ( auto i = 0u; i < nw; ++i )
+        {
+          const auto a = in[0][i] ^ m[0], b = in[1][i] ^ m[1], c = in[2][i] ^ m[2];
+          out[i] = ( a & b ) | ( a & c ) | ( b & c );
+        }
+        out[nw - 1] &= mask;
+        return true;
+      }
+    }
+    if constexpr ( has_is_xor3_v<Ntk> )
+    {
+      if ( num_fanins == 3u && ntk.is_xor3( n ) )
+      {
+        for ( auto i = 0u; i < nw; ++i )
+          out[i] = ( in[0][i] ^ m[0] ) ^ ( in[1][i] ^ m[1] ) ^ ( in[2][i] ^ m[2] );
+        out[nw - 1] &= mask;
+        return true;
+      }
+    }
+
+    return false;
   }
 
 private:
   Ntk const& ntk;
-  uint32_t num_divisors;
+  uint32_t max_pis;
+  uint32_t capacity;
+  uint32_t num_words{0u};
+  uint64_t last_word_mask{0u};
 
-  std::vector<truthtable_t> tts;
+  std::vector<uint64_t> words;
   std::vector<uint32_t> node_to_index;
+  std::vector<uint32_t> node_epoch;
+  std::vector<uint64_t> node_support;
   std::vector<bool> phase;
+
+  uint32_t epoch{1u};
+  uint32_t next_slot{max_pis + 1};
+  uint64_t used_vars{0u};
+  uint32_t num_used_vars{0u};
+  uint64_t leaves_support{0u};
+
+  uint64_t num_simulated{0u};
+  uint64_t num_reused{0u};
+
+  node_map<uint64_t, Ntk> signatures;
+  uint32_t num_signatures{0u};
+  std::mt19937_64 random_patterns{0xcafeaffe};
+  bool signatures_enabled{true};
 }; /* simulator */
 
+/*! \brief Divisors indexed by their global signatures.
+ *
+ * Entries are numbered in the order in which they are added.  The queries
+ * visit, in increasing order, only the entries whose signatures can take part
+ * in a relation, using a hash table for equal signatures and per-bit lists
+ * for signatures that must contain some bits.
+ */
+class signature_index
+{
+public:
+  void clear()
+  {
+    sigs.clear();
+    buckets.clear();
+    bit_lists_valid = false;
+  }
+
+  void push_back( uint64_t sig )
+  {
+    buckets[sig].emplace_back( uint32_t( sigs.size() ) );
+    sigs.emplace_back( sig );
+    bit_lists_valid = false;
+  }
+
+  uint64_t operator[]( uint32_t i ) const
+  {
+    return sigs[i];
+  }
+
+  uint32_t size() const
+  {
+    return uint32_t( sigs.size() );
+  }
+
+  /*! \brief Calls `fn` for entries `j >= first` with signature `sig` until `fn` returns true. */
+  template<class Fn>
+  bool foreach_equal( uint64_t sig, uint32_t first, Fn&& fn ) const
+  {
+    auto const it = buckets.find( sig );
+    if ( it == buckets.end() )
+      return false;
+
+    for ( auto j = std::lower_bound( it->second.begin(), it->second.end(), first ); j != it->second.end(); ++j )
+    {
+      if ( fn( *j ) )
+        return true;
+    }
+    return false;
+  }
+
+  /*! \brief Calls `fn` for entries `j >= first` whose signature contains `bits` until `fn` returns true. */
+  template<class Fn>
+  bool foreach_superset( uint64_t bits, uint32_t first, Fn&& fn )
+  {
+    if ( bits == 0u )
+    {
+      for ( auto j = first; j < sigs.size(); ++j )
+      {
+        if ( fn( j ) )
+          return true;
+      }
+      return false;
+    }
+
+    if ( !bit_lists_valid )
+      build_bit_lists();
+
+    /* every candidate contains the rarest of the bits */
+    auto best = 64u;
+    for ( auto b = 0u; b < 64u; ++b )
+    {
+      if ( ( ( bits >> b ) & 1 ) && ( best == 64u || bit_lists[b].size() < bit_lists[best].size() ) )
+        best = b;
+    }
+
+    auto const& list = bit_lists[best];
+    for ( auto j = std::lower_bound( list.begin(), list.end(), first ); j != list.end(); ++j )
+    {
+      if ( ( sigs[*j] & bits ) == bits && fn( *j ) )
+        return true;
+    }
+    return false;
+  }
+
+private:
+  void build_bit_lists()
+  {
+    for ( auto& list : bit_lists )
+      list.clear();
+    for ( auto j = 0u; j < sigs.size(); ++j )
+    {
+      for ( auto b = 0u; b < 64u; ++b )
+      {
+        if ( ( sigs[j] >> b ) & 1 )
+          bit_lists[b].emplace_back( j );
+      }
+    }
+    bit_lists_valid = true;
+  }
+
+private:
+  std::vector<uint64_t> sigs;
+  std::unordered_map<uint64_t, std::vector<uint32_t>> buckets;
+  std::array<std::vector<uint32_t>, 64> bit_lists;
+  bool bit_lists_valid{false};
+}; /* signature_index */
+
 struct default_resub_functor_stats
 {
   /*! \brief Accumulated runtime for const-resub */
@@ -421,12 +875,13 @@ private:
   {
     (void)required;
     auto const tt = sim.get_tt( ntk.make_signal( root ) );
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( const auto& d : divs )
     {
       if ( root == d )
         break;
 
-      if ( tt != sim.get_tt( ntk.make_signal( d ) ) )
+      if ( sig != sim.get_signature( ntk.make_signal( d ) ) || tt != sim.get_tt( ntk.make_signal( d ) ) )
         continue; /* next */
 
       return ( sim.get_phase( d ) ^ sim.get_phase( root ) ) ? !ntk.make_signal( d ) : ntk.make_signal( d );
@@ -443,6 +898,30 @@ private:
   stats& st;
 }; /* default_resub_functor */
 
+/* network wrapped by the resubstitution view `fanout_view<depth_view<Ntk>>` */
+template<class Ntk>
+struct resub_view_network
+{
+  using type = void;
+};
+
+template<class Ntk, bool has_depth_interface, bool has_fanout_interface>
+struct resub_view_network<fanout_view<depth_view<Ntk, has_depth_interface>, has_fanout_interface>>
+{
+  using type = Ntk;
+};
+
+/* a network can be copied into a private snapshot if it is not a view and can be constructed from its storage */
+template<class Ntk, class = void>
+struct supports_resub_snapshots : std::false_type
+{
+};
+
+template<class Ntk>
+struct supports_resub_snapshots<Ntk, std::enable_if_t<std::is_same_v<Ntk, typename Ntk::base_type> && std::is_constructible_v<Ntk, typename Ntk::storage>>> : std::true_type
+{
+};
+
 template<class Ntk, class Simulator, class ResubFn, class TT, class Node_mffc>
 class resubstitution_impl
 {
@@ -455,6 +934,12 @@ public:
   {
     st.initial_size = ntk.num_gates();
 
+    if ( ps.use_dont_cares )
+    {
+      dont_cares.emplace( ntk, ps.dont_cares_ps, st.dont_cares_st );
+      sim.set_use_signatures( ps.dont_cares_ps.max_tfo_levels == 0u );
+    }
+
     auto const update_level_of_new_node = [&]( const auto& n ) {
       ntk.resize_levels();
       update_node_level( n );
@@ -479,6 +964,18 @@ public:
 
   void run()
   {
+    /* the MFFC is marked with values when collecting divisors */
+    ntk.clear_values();
+
+    if constexpr ( supports_resub_snapshots<snapshot_network_t>::value )
+    {
+      if ( ps.num_threads > 1u && !ps.use_dont_cares )
+      {
+        run_parallel();
+        return;
+      }
+    }
+
     stopwatch t( st.time_total );
 
     /* start the managers */
@@ -525,9 +1022,385 @@ public:
 
       return true; /* next */
     } );
+
+    st.num_simulated_divisors = sim.num_simulated_divisors();
+    st.num_reused_divisors = sim.num_reused_divisors();
   }
 
 private:
+  using snapshot_network_t = typename resub_view_network<Ntk>::type;
+
+  /* number of times a root is evaluated in parallel mode if its candidates become stale */
+  static constexpr uint32_t max_attempts = 3u;
+
+  struct resub_candidate
+  {
+    uint32_t index; /* position of the root in the batch */
+    signal sig;     /* replacement in the worker's snapshot */
+    uint32_t gain;
+    std::vector<node> leaves;
+    std::vector<node> mffc;
+    std::vector<node> window;
+  };
+
+  /* per-thread state of the parallel mode: a private copy of the network with its own views, simulator, and statistics */
+  struct resub_worker
+  {
+    explicit resub_worker( Ntk const& ntk, resubstitution_params const& ps )
+        : snapshot( std::make_shared<typename snapshot_network_t::storage::element_type>( *ntk._storage ) ),
+          depth( snapshot ),
+          view( depth ),
+          impl( view, ps, st, resub_st ),
+          mgr( ps.max_pis ),
+          ps( ps ),
+          snapshot_size( ntk.size() )
+    {
+    }
+
+    void evaluate( node const& root, uint32_t index )
+    {
+      if ( view.is_dead( root ) || view.fanout_size( root ) > ps.skip_fanout_limit_for_roots )
+        return;
+
+      auto const leaves = call_with_stopwatch( st.time_cuts, [&]() {
+        return reconv_driven_cut( mgr, view, root );
+      } );
+
+      auto const g = call_with_stopwatch( st.time_eval, [&]() {
+        return impl.evaluate( root, leaves );
+      } );
+      if ( !g )
+        return;
+
+      candidates.push_back( {index, *g, impl.last_gain, leaves, impl.temp, impl.divs} );
+    }
+
+    /* Brings the snapshot in line with `ntk` after a commit step.  The nodes
+     * created for candidates are removed, and the nodes in `changed` (all
+     * nodes of `ntk` whose storage changed), the nodes that drive changed
+     * outputs, and the nodes added to `ntk` are copied.  The views of the
+     * snapshot are updated through its events. */
+    void synchronize( Ntk const& ntk, std::vector<uint32_t> const& changed )
+    {
+      auto& dest = *snapshot._storage;
+      auto const& src = *ntk._storage;
+
+      std::vector<uint32_t> dirty( changed );
+      for ( auto n = static_cast<node>( dest.nodes.size() ); n-- > snapshot_size; )
+      {
+        snapshot.foreach_fanin( n, [&]( auto const& f ) {
+          dirty.push_back( snapshot.node_to_index( snapshot.get_node( f ) ) );
+        } );
+        if ( !snapshot.is_dead( n ) )
+        {
+          erase_from_hash( n );
+          for ( auto const& fn : snapshot._events->on_delete )
+            fn( n );
+        }
+      }
+      dest.nodes.resize( snapshot_size );
+      impl.sim.truncate( snapshot_size );
+
+      assert( dest.outputs.size() == src.outputs.size() );
+      for ( auto i = 0u; i < src.outputs.size(); ++i )
+      {
+        if ( dest.outputs[i] == src.outputs[i] )
+          continue;
+        dirty.push_back( static_cast<uint32_t>( dest.outputs[i].index ) );
+        dirty.push_back( static_cast<uint32_t>( src.outputs[i].index ) );
+        dest.outputs[i] = src.outputs[i];
+      }
+
+      /* new nodes first, since changed nodes may point to them */
+      for ( auto n = static_cast<node>( snapshot_size ); n < src.nodes.size(); ++n )
+      {
+        dest.nodes.push_back( src.nodes[n] );
+        snapshot.set_visited( n, 0u );
+        snapshot.set_value( n, 0u );
+        if ( !ntk.is_dead( n ) )
+        {
+          dest.hash[dest.nodes[n]] = n;
+          for ( auto const& fn : snapshot._events->on_add )
+            fn( n );
+        }
+      }
+
+      std::sort( dirty.begin(), dirty.end() );
+      dirty.erase( std::unique( dirty.begin(), dirty.end() ), dirty.end() );
+      for ( auto const index : dirty )
+      {
+        if ( index < snapshot_size )
+          copy_node( ntk, snapshot.index_to_node( index ) );
+      }
+      snapshot_size = ntk.size();
+    }
+
+    void copy_node( Ntk const& ntk, node const& n )
+    {
+      auto& dest = *snapshot._storage;
+      auto const& src = *ntk._storage;
+
+      /* only the fanout size of constants and CIs changes */
+      if ( snapshot.is_constant( n ) || snapshot.is_ci( n ) )
+      {
+        dest.nodes[n].data = src.nodes[n].data;
+        snapshot.set_visited( n, 0u );
+        snapshot.set_value( n, 0u );
+        return;
+      }
+
+      auto const was_dead = snapshot.is_dead( n );
+      auto const is_dead = ntk.is_dead( n );
+
+      std::vector<signal> previous;
+      snapshot.foreach_fanin( n, [&]( auto const& f ) {
+        previous.push_back( f );
+      } );
+      auto const old_node = dest.nodes[n];
+
+      if ( !was_dead )
+      {
+        erase_from_hash( n );
+
+        /* the views still see the previous fanins */
+        if ( is_dead )
+        {
+          for ( auto const& fn : snapshot._events->on_delete )
+            fn( n );
+        }
+      }
+
+      dest.nodes[n] = src.nodes[n];
+      snapshot.set_visited( n, 0u );
+      snapshot.set_value( n, 0u );
+
+      if ( !is_dead )
+      {
+        dest.hash[dest.nodes[n]] = n;
+        if ( was_dead )
+        {
+          for ( auto const& fn : snapshot._events->on_add )
+            fn( n );
+        }
+        else if ( !( old_node == dest.nodes[n] ) )
+        {
+          for ( auto const& fn : snapshot._events->on_modified )
+            fn( n, previous );
+        }
+      }
+    }
+
+    void erase_from_hash( node const& n )
+    {
+      auto& hash = snapshot._storage->hash;
+      if ( auto it = hash.find( snapshot._storage->nodes[n] ); it != hash.end() && it->second == n )
+        hash.erase( it );
+    }
+
+    snapshot_network_t snapshot;
+    depth_view<snapshot_network_t> depth;
+    Ntk view;
+    resubstitution_stats st;
+    typename ResubFn::stats resub_st;
+    resubstitution_impl impl;
+    cut_manager<Ntk> mgr;
+    resubstitution_params const& ps;
+    std::vector<resub_candidate> candidates;
+
+    /* number of nodes the snapshot shares with the network */
+    uint32_t snapshot_size;
+  };
+
+  void run_parallel()
+  {
+    stopwatch t( st.time_total );
+
+    progress_bar pbar{ntk.size(), "resub |{0}| node = {1:>4}   cand = {2:>4}   est. gain = {3:>5}", ps.progress};
+
+    std::vector<node> roots;
+    auto const size = ntk.num_gates();
+    ntk.foreach_gate( [&]( auto const& n, auto i ) {
+      if ( i >= size )
+        return false; /* terminate */
+      roots.emplace_back( n );
+      return true; /* next */
+    } );
+
+    /* nodes whose fanins changed since the snapshots were updated */
+    std::vector<bool> touched;
+    auto const touch = [&]( node const& n ) {
+      auto const index = ntk.node_to_index( n );
+      if ( index < touched.size() )
+        touched[index] = true;
+    };
+
+    /* nodes whose storage changed (also the fanout size) since the snapshots were updated */
+    std::vector<uint32_t> changed;
+    auto const change_fanins = [&]( node const& n ) {
+      changed.push_back( ntk.node_to_index( n ) );
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        changed.push_back( ntk.node_to_index( ntk.get_node( f ) ) );
+      } );
+    };
+
+    ntk._events->on_add.emplace_back( [&]( node const& n ) { change_fanins( n ); } );
+    ntk._events->on_modified.emplace_back( [&]( node const& n, auto const& previous ) {
+      touch( n );
+      change_fanins( n );
+      for ( auto const& f : previous )
+        changed.push_back( ntk.node_to_index( ntk.get_node( f ) ) );
+    } );
+    ntk._events->on_delete.emplace_back( [&]( node const& n ) {
+      touch( n );
+      change_fanins( n );
+    } );
+
+    /* the snapshots are created in the first round and updated in the following ones */
+    std::vector<std::unique_ptr<resub_worker>> workers( ps.num_threads );
+
+    /* roots with the number of times they were evaluated before */
+    std::vector<std::pair<node, uint32_t>> batch;
+    std::vector<std::pair<node, uint32_t>> retries;
+    auto next = 0u;
+    while ( next < roots.size() || !retries.empty() )
+    {
+      pbar( next, next, candidates, st.estimated_gain );
+
+      /* stale roots of the previous round come first, then fresh ones */
+      batch.clear();
+      std::swap( batch, retries );
+      retries.clear();
+      while ( batch.size() < std::max( ps.batch_size, 1u ) && next < roots.size() )
+        batch.emplace_back( roots[next++], 0u );
+
+      auto const snapshot_size = ntk.size();
+      touched.assign( snapshot_size, false );
+
+      /* compute candidates for contiguous slices of the batch in parallel */
+      auto const slice = ( uint32_t( batch.size() ) + ps.num_threads - 1u ) / ps.num_threads;
+      std::vector<std::thread> threads;
+      for ( auto w = 0u; w < ps.num_threads; ++w )
+      {
+        threads.emplace_back( [&, w]() {
+          if ( !workers[w] )
+            workers[w] = std::make_unique<resub_worker>( ntk, ps );
+          else
+            workers[w]->synchronize( ntk, changed );
+
+          auto const end = std::min<uint32_t>( ( w + 1u ) * slice, uint32_t( batch.size() ) );
+          for ( auto i = w * slice; i < end; ++i )
+            workers[w]->evaluate( batch[i].first, i );
+        } );
+      }
+      for ( auto& thread : threads )
+        thread.join();
+      changed.clear();
+
+      /* commit the candidates in the order of their roots */
+      for ( auto const& w : workers )
+      {
+        for ( auto const& c : w->candidates )
+        {
+          auto const root = batch[c.index].first;
+          if ( ntk.is_dead( root ) )
+            continue;
+
+          if ( !is_window_intact( root, c, snapshot_size, touched ) )
+          {
+            ++st.num_stale_candidates;
+            if ( batch[c.index].second + 1u < max_attempts )
+              retries.emplace_back( root, batch[c.index].second + 1u );
+            continue;
+          }
+
+          call_with_stopwatch( st.time_substitute, [&]() {
+            std::unordered_map<node, signal> copied;
+            auto const g = copy_from_snapshot( *w, c.sig, snapshot_size, copied );
+            if ( ntk.get_node( g ) == root )
+              return;
+
+            candidates++;
+            st.estimated_gain += c.gain;
+            ntk.substitute_node( root, g );
+          } );
+        }
+        w->candidates.clear();
+      }
+    }
+
+    for ( auto const& w : workers )
+    {
+      if ( w )
+        merge_worker_stats( *w );
+    }
+
+    ntk._events->on_add.pop_back();
+    ntk._events->on_modified.pop_back();
+    ntk._events->on_delete.pop_back();
+  }
+
+  /* A candidate is valid if no node of its window was modified or deleted
+   * since the snapshot and its MFFC is unchanged.  Since the root then still
+   * depends on all leaves, the divisors cannot depend on the root, and the
+   * substitution cannot create a cycle. */
+  bool is_window_intact( node const& root, resub_candidate const& c, uint32_t snapshot_size, std::vector<bool> const& touched )
+  {
+    for ( auto const& n : c.window )
+    {
+      /* nodes created in the snapshot are copied together with the candidate */
+      if ( ntk.node_to_index( n ) >= snapshot_size )
+        continue;
+      if ( touched[ntk.node_to_index( n )] || ntk.is_dead( n ) )
+        return false;
+    }
+
+    std::vector<node> mffc;
+    call_with_stopwatch( st.time_mffc, [&]() {
+      Node_mffc collector( ntk );
+      collector.run( root, c.leaves, mffc );
+    } );
+    return mffc == c.mffc;
+  }
+
+  signal copy_from_snapshot( resub_worker& w, signal const& s, uint32_t snapshot_size, std::unordered_map<node, signal>& copied )
+  {
+    auto const n = w.view.get_node( s );
+
+    signal g;
+    if ( w.view.node_to_index( n ) < snapshot_size )
+    {
+      g = ntk.make_signal( ntk.index_to_node( w.view.node_to_index( n ) ) );
+    }
+    else if ( auto it = copied.find( n ); it != copied.end() )
+    {
+      g = it->second;
+    }
+    else
+    {
+      std::vector<signal> children;
+      w.view.foreach_fanin( n, [&]( auto const& f ) {
+        children.emplace_back( copy_from_snapshot( w, f, snapshot_size, copied ) );
+      } );
+      g = ntk.clone_node( w.snapshot, n, children );
+      copied.emplace( n, g );
+    }
+
+    return w.view.is_complemented( s ) ? ntk.create_not( g ) : g;
+  }
+
+  void merge_worker_stats( resub_worker const& w )
+  {
+    st.time_cuts += w.st.time_cuts;
+    st.time_eval += w.st.time_eval;
+    st.time_mffc += w.st.time_mffc;
+    st.time_divs += w.st.time_divs;
+    st.time_simulation += w.st.time_simulation;
+    st.num_total_divisors += w.st.num_total_divisors;
+    st.num_total_leaves += w.st.num_total_leaves;
+    st.num_simulated_divisors += w.impl.sim.num_simulated_divisors();
+    st.num_reused_divisors += w.impl.sim.num_reused_divisors();
+  }
+
   void update_node_level( node const& n, bool top_most = true )
   {
     uint32_t curr_level = ntk.level( n );
@@ -560,7 +1433,8 @@ private:
   void simulate( std::vector<node> const& leaves )
   {
     sim.resize();
-    for ( auto i = 0u; i < divs.size(); ++i )
+    sim.begin_window( leaves, uint32_t( divs.size() ), !ps.use_dont_cares );
+    for ( auto i = leaves.size(); i < divs.size(); ++i )
     {
       const auto d = divs.at( i );
 
@@ -568,27 +1442,8 @@ private:
       if ( d == 0 )
         continue;
 
-      /* assign leaves to variables */
-      if ( i < leaves.size() )
-      {
-        sim.assign( d, i + 1 );
-        continue;
-      }
-
-      /* compute truth tables of inner nodes */
-      sim.assign( d, i - uint32_t( leaves.size() ) + ps.max_pis + 1 );
-      std::vector<typename Simulator::truthtable_t> tts;
-      ntk.foreach_fanin( d, [&]( const auto& s, auto i ) {
-        (void)i;
-        tts.emplace_back( sim.get_tt( ntk.make_signal( ntk.get_node( s ) ) ) ); /* ignore sign */
-      } );
-
-      auto const tt = ntk.compute( d, tts.begin(), tts.end() );
-      sim.set_tt( i - uint32_t( leaves.size() ) + ps.max_pis + 1, tt );
+      sim.simulate( d );
     }
-
-    /* normalize truth tables */
-    sim.normalize( divs );
   }
 
   std::optional<signal> evaluate( node const& root, std::vector<node> const& leaves )
@@ -623,7 +1478,7 @@ private:
 
     auto care = kitty::create<TT>( leaves.size() );
     if ( ps.use_dont_cares )
-      care = ~satisfiability_dont_cares( ntk, leaves, 12u );
+      care = dont_cares->care( root, leaves );
     else
       care = ~care;
 
@@ -762,6 +1617,8 @@ private:
   resubstitution_stats& st;
   typename ResubFn::stats& resub_st;
 
+  std::optional<windowed_dont_cares<Ntk>> dont_cares;
+
   /* temporary statistics for progress bar */
   uint32_t candidates{0};
   uint32_t last_gain{0};
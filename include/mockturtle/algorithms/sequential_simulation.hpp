@@ -0,0 +1,484 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file sequential_simulation.hpp
+  \brief Bit-parallel cycle-based simulation of sequential networks
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+
+#include "../traits.hpp"
+#include "../views/topo_view.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Parameters for sequential_simulator.
+ *
+ * The data structure `sequential_simulation_params` holds configurable
+ * parameters with default arguments for `sequential_simulator`.
+ */
+struct sequential_simulation_params
+{
+  /*! \brief Number of 64-bit words per signal, each bit is one trace. */
+  uint32_t num_words{1u};
+
+  /*! \brief Seed for random input values and unknown reset values. */
+  uint64_t seed{0xcafeaffe};
+
+  /*! \brief Draw unknown register reset values at random (otherwise 0). */
+  bool random_unknown_reset{true};
+};
+
+namespace detail
+{
+
+enum class sequential_gate_kind : uint8_t
+{
+  and2,
+  xor2,
+  maj3,
+  xor3,
+  function
+};
+
+} // namespace detail
+
+/*! \brief Bit-parallel cycle-based simulator for sequential networks.
+ *
+ * The simulator runs `64 * num_words` input traces at once: each signal of
+ * the network holds `num_words` 64-bit words per frame, and bit `j` of word
+ * `w` belongs to trace `64 * w + j`.  Registers are initialized from
+ * `latch_reset`, where reset values 0 and 1 are constant in all traces and
+ * unknown reset values (2 and 3) are drawn at random per trace.
+ *
+ * The gates in the transitive fan-in of all combinational outputs are
+ * compiled once into a flat program in topological order.  Gates of AIGs,
+ * XAGs, MIGs, and XMGs are evaluated with word operations; all other gates
+ * are evaluated from their node function.
+ *
+ * Each call to `step` simulates one frame: the combinational logic is
+ * evaluated with the given primary input values and the current register
+ * state, the values of all combinational outputs are recorded, and the
+ * register inputs become the register state of the next frame.
+ *
+ * **Required network functions:**
+ * - `get_node`
+ * - `is_complemented`
+ * - `is_constant`
+ * - `constant_value`
+ * - `is_ci`
+ * - `fanin_size`
+ * - `node_to_index`
+ * - `foreach_pi`
+ * - `foreach_po`
+ * - `foreach_ro`
+ * - `foreach_ri`
+ * - `foreach_fanin`
+ * - `latch_reset`
+ * - `node_function`
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      aig_network aig = ...;
+
+      sequential_simulation_params ps;
+      ps.num_words = 4u; // 256 traces
+      sequential_simulator sim( aig, ps );
+      sim.run( 100u, [&]( uint32_t frame ) {
+        for ( auto w = 0u; w < sim.num_words(); ++w )
+        {
+          if ( sim.po_word( 0u, w ) != 0u )
+          {
+            std::cout << "property fails in frame " << frame << "\n";
+          }
+        }
+      } );
+   \endverbatim
+ */
+template<class Ntk>
+class sequential_simulator
+{
+public:
+  using node = typename Ntk::node;
+  using signal = typename Ntk::signal;
+
+  explicit sequential_simulator( Ntk const& ntk, sequential_simulation_params const& ps = {} )
+      : _ntk( ntk ),
+        _ps( ps ),
+        _rng( ps.seed )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+    static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+    static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+    static_assert( has_constant_value_v<Ntk>, "Ntk does not implement the constant_value method" );
+    static_assert( has_is_ci_v<Ntk>, "Ntk does not implement the is_ci method" );
+    static_assert( has_fanin_size_v<Ntk>, "Ntk does not implement the fanin_size method" );
+    static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+    static_assert( has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi method" );
+    static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
+    static_assert( has_foreach_ro_v<Ntk>, "Ntk does not implement the foreach_ro method" );
+    static_assert( has_foreach_ri_v<Ntk>, "Ntk does not implement the foreach_ri method" );
+    static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+    static_assert( has_node_function_v<Ntk>, "Ntk does not implement the node_function method" );
+
+    assert( _ps.num_words > 0u );
+
+    compile();
+    reset();
+  }
+
+  /*! \brief Number of 64-bit words per signal. */
+  uint32_t num_words() const
+  {
+    return _ps.num_words;
+  }
+
+  /*! \brief Number of frames simulated since the last reset. */
+  uint32_t frame() const
+  {
+    return _frame;
+  }
+
+  /*! \brief Sets all registers to their reset values. */
+  void reset()
+  {
+    std::fill( _values.begin(), _values.end(), 0u );
+    std::fill( _co_values.begin(), _co_values.end(), 0u );
+
+    /* constants */
+    _ntk.foreach_node( [&]( auto const& n ) {
+      if ( _ntk.is_constant( n ) && _ntk.constant_value( n ) )
+      {
+        std::fill_n( word_ptr( _ntk.node_to_index( n ) ), _ps.num_words, ~uint64_t( 0 ) );
+      }
+    } );
+
+    _ntk.foreach_ro( [&]( auto const& n, auto i ) {
+      auto* words = word_ptr( _ntk.node_to_index( n ) );
+      switch ( _ntk.latch_reset( i ) )
+      {
+      case 0:
+        std::fill_n( words, _ps.num_words, uint64_t( 0 ) );
+        break;
+      case 1:
+        std::fill_n( words, _ps.num_words, ~uint64_t( 0 ) );
+        break;
+      default:
+        for ( auto w = 0u; w < _ps.num_words; ++w )
+        {
+          words[w] = _ps.random_unknown_reset ? _rng() : uint64_t( 0 );
+        }
+        break;
+      }
+    } );
+
+    _frame = 0u;
+  }
+
+  /*! \brief Simulates one frame.
+   *
+   * `pi_words` contains `num_words()` words for each primary input, stored
+   * consecutively in the order of `foreach_pi`.
+   */
+  void step( std::vector<uint64_t> const& pi_words )
+  {
+    assert( pi_words.size() == _pis.size() * _ps.num_words );
+
+    for ( auto i = 0u; i < _pis.size(); ++i )
+    {
+      std::copy_n( pi_words.begin() + i * _ps.num_words, _ps.num_words, word_ptr( _pis[i] ) );
+    }
+    evaluate();
+  }
+
+  /*! \brief Simulates one frame with random primary input values. */
+  void step_random()
+  {
+    for ( auto const& pi : _pis )
+    {
+      auto* words = word_ptr( pi );
+      for ( auto w = 0u; w < _ps.num_words; ++w )
+      {
+        words[w] = _rng();
+      }
+    }
+    evaluate();
+  }
+
+  /*! \brief Simulates `num_frames` frames with random primary input values.
+   *
+   * If given, `fn` is called with the frame index after each frame.
+   */
+  template<typename Fn>
+  void run( uint32_t num_frames, Fn&& fn )
+  {
+    for ( auto i = 0u; i < num_frames; ++i )
+    {
+      step_random();
+      fn( _frame - 1u );
+    }
+  }
+
+  void run( uint32_t num_frames )
+  {
+    run( num_frames, []( uint32_t ) {} );
+  }
+
+  /*! \brief Word `w` of primary output `index` in the last simulated frame. */
+  uint64_t po_word( uint32_t index, uint32_t w ) const
+  {
+    assert( index < _num_pos && w < _ps.num_words );
+    return _co_values[index * _ps.num_words + w];
+  }
+
+  /*! \brief Word `w` of primary input `index` in the last simulated frame. */
+  uint64_t pi_word( uint32_t index, uint32_t w ) const
+  {
+    assert( index < _pis.size() && w < _ps.num_words );
+    return _values[_pis[index] * _ps.num_words + w];
+  }
+
+  /*! \brief Word `w` of the current state of register `index`. */
+  uint64_t register_word( uint32_t index, uint32_t w ) const
+  {
+    assert( index < _ros.size() && w < _ps.num_words );
+    return _values[_ros[index] * _ps.num_words + w];
+  }
+
+  /*! \brief Value of primary output `index` for trace `trace`. */
+  bool po_value( uint32_t index, uint32_t trace ) const
+  {
+    return ( po_word( index, trace >> 6 ) >> ( trace & 63 ) ) & 1;
+  }
+
+  /*! \brief Current value of register `index` for trace `trace`. */
+  bool register_value( uint32_t index, uint32_t trace ) const
+  {
+    return ( register_word( index, trace >> 6 ) >> ( trace & 63 ) ) & 1;
+  }
+
+private:
+  uint64_t* word_ptr( uint32_t index )
+  {
+    return _values.data() + static_cast<std::size_t>( index ) * _ps.num_words;
+  }
+
+  void compile()
+  {
+    _values.resize( static_cast<std::size_t>( _ntk.size() ) * _ps.num_words );
+
+    _ntk.foreach_pi( [&]( auto const& n ) {
+      _pis.push_back( _ntk.node_to_index( n ) );
+    } );
+    _ntk.foreach_ro( [&]( auto const& n ) {
+      _ros.push_back( _ntk.node_to_index( n ) );
+    } );
+    _ntk.foreach_po( [&]( auto const& f ) {
+      _cos.push_back( literal( f ) );
+    } );
+    _num_pos = static_cast<uint32_t>( _cos.size() );
+    _ntk.foreach_ri( [&]( auto const& f ) {
+      _cos.push_back( literal( f ) );
+    } );
+    assert( _cos.size() - _num_pos == _ros.size() );
+    _co_values.resize( _cos.size() * _ps.num_words );
+
+    topo_view topo{_ntk};
+    topo.foreach_node( [&]( auto const& n ) {
+      if ( _ntk.is_constant( n ) || _ntk.is_ci( n ) )
+      {
+        return;
+      }
+
+      _gates.push_back( _ntk.node_to_index( n ) );
+      _kinds.push_back( gate_kind( n ) );
+      _fanin_offsets.push_back( static_cast<uint32_t>( _fanins.size() ) );
+      _ntk.foreach_fanin( n, [&]( auto const& f ) {
+        _fanins.push_back( literal( f ) );
+      } );
+
+      if ( _kinds.back() == detail::sequential_gate_kind::function )
+      {
+        _functions.emplace_back( _ntk.node_function( n ) );
+      }
+    } );
+    _fanin_offsets.push_back( static_cast<uint32_t>( _fanins.size() ) );
+  }
+
+  uint32_t literal( signal const& f ) const
+  {
+    return ( _ntk.node_to_index( _ntk.get_node( f ) ) << 1 ) | ( _ntk.is_complemented( f ) ? 1u : 0u );
+  }
+
+  uint64_t word( uint32_t lit, uint32_t w ) const
+  {
+    return _values[( lit >> 1 ) * _ps.num_words + w] ^ ( uint64_t( 0 ) - ( lit & 1u ) );
+  }
+
+  detail::sequential_gate_kind gate_kind( node const& n ) const
+  {
+    const auto num_fanins = _ntk.fanin_size( n );
+    if constexpr ( has_is_and_v<Ntk> )
+    {
+      if ( num_fanins == 2u && _ntk.is_and( n ) )
+        return detail::sequential_gate_kind::and2;
+    }
+    if constexpr ( has_is_xor_v<Ntk> )
+    {
+      if ( num_fanins == 2u && _ntk.is_xor( n ) )
+        return detail::sequential_gate_kind::xor2;
+    }
+    if constexpr ( has_is_maj_v<Ntk> )
+    {
+      if ( num_fanins == 3u && _ntk.is_maj( n ) )
+        return detail::sequential_gate_kind::maj3;
+    }
+    if constexpr ( has_is_xor3_v<Ntk> )
+    {
+      if ( num_fanins == 3u && _ntk.is_xor3( n ) )
+        return detail::sequential_gate_kind::xor3;
+    }
+    return detail::sequential_gate_kind::function;
+  }
+
+  void evaluate()
+  {
+    const auto num_words = _ps.num_words;
+    auto function_index = 0u;
+
+    for ( auto g = 0u; g < _gates.size(); ++g )
+    {
+      auto* out = word_ptr( _gates[g] );
+      const auto* fanins = _fanins.data() + _fanin_offsets[g];
+
+      switch ( _kinds[g] )
+      {
+      case detail::sequential_gate_kind::and2:
+        for ( auto w = 0u; w < num_words; ++w )
+        {
+          out[w] = word( fanins[0], w ) & word( fanins[1], w );
+        }
+        break;
+      case detail::sequential_gate_kind::xor2:
+        for ( auto w = 0u; w < num_words; ++w )
+        {
+          out[w] = word( fanins[0], w ) ^ word( fanins[1], w );
+        }
+        break;
+      case detail::sequential_gate_kind::maj3:
+        for ( auto w = 0u; w < num_words; ++w )
+        {
+          const auto a = word( fanins[0], w ), b = word( fanins[1], w ), c = word( fanins[2], w );
+          out[w] = ( a & b ) | ( a & c ) | ( b & c );
+        }
+        break;
+      case detail::sequential_gate_kind::xor3:
+        for ( auto w = 0u; w < num_words; ++w )
+        {
+          out[w] = word( fanins[0], w ) ^ word( fanins[1], w ) ^ word( fanins[2], w );
+        }
+        break;
+      case detail::sequential_gate_kind::function:
+      {
+        /* sum of minterms of the node function */
+        const auto& tt = _functions[function_index++];
+        const auto num_fanins = _fanin_offsets[g + 1] - _fanin_offsets[g];
+        for ( auto w = 0u; w < num_words; ++w )
+        {
+          uint64_t result = 0u;
+          for ( uint64_t m = 0u; m < tt.num_bits(); ++m )
+          {
+            if ( !kitty::get_bit( tt, m ) )
+              continue;
+
+            auto term = ~uint64_t( 0 );
+            for ( auto j = 0u; j < num_fanins && term; ++j )
+            {
+              const auto v = word( fanins[j], w );
+              term &= ( ( m >> j ) & 1 ) ? v : ~v;
+            }
+            result |= term;
+          }
+          out[w] = result;
+        }
+        break;
+      }
+      }
+    }
+
+    /* record combinational outputs, then latch the next state */
+    for ( auto i = 0u; i < _cos.size(); ++i )
+    {
+      for ( auto w = 0u; w < num_words; ++w )
+      {
+        _co_values[i * num_words + w] = word( _cos[i], w );
+      }
+    }
+    for ( auto i = 0u; i < _ros.size(); ++i )
+    {
+      std::copy_n( _co_values.begin() + ( _num_pos + i ) * num_words, num_words, word_ptr( _ros[i] ) );
+    }
+
+    ++_frame;
+  }
+
+private:
+  Ntk const& _ntk;
+  sequential_simulation_params _ps;
+  std::mt19937_64 _rng;
+
+  std::vector<uint32_t> _pis;
+  std::vector<uint32_t> _ros;
+  std::vector<uint32_t> _cos; /* literals of POs followed by RIs */
+  uint32_t _num_pos{0u};
+
+  std::vector<uint32_t> _gates;
+  std::vector<detail::sequential_gate_kind> _kinds;
+  std::vector<uint32_t> _fanin_offsets;
+  std::vector<uint32_t> _fanins;
+  std::vector<kitty::dynamic_truth_table> _functions;
+
+  std::vector<uint64_t> _values;
+  std::vector<uint64_t> _co_values;
+  uint32_t _frame{0u};
+};
+
+} // namespace mockturtle
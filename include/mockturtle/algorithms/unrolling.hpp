@@ -0,0 +1,192 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file unrolling.hpp
+  \brief Unroll sequential networks into combinational networks
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../traits.hpp"
+#include "../utils/node_map.hpp"
+#include "../views/topo_view.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Parameters for unroll.
+ *
+ * The data structure `unrolling_params` holds configurable parameters with
+ * default arguments for `unroll`.
+ */
+struct unrolling_params
+{
+  /*! \brief Create a primary input for each register with unknown reset
+   *         value (otherwise such registers are reset to 0). */
+  bool unknown_reset_as_pis{true};
+
+  /*! \brief Create primary outputs for the register state after the last
+   *         frame. */
+  bool final_state_as_pos{false};
+};
+
+/*! \brief Unrolls a sequential network for a number of frames.
+ *
+ * Returns a combinational network of the same type which computes the
+ * primary outputs of `ntk` for the first `num_frames` frames after reset.
+ * This is the starting point for bounded checks, e.g., with a miter and
+ * `equivalence_checking`.
+ *
+ * Registers with reset value 0 or 1 start from constants.  If
+ * `ps.unknown_reset_as_pis` is set, registers with unknown reset value start
+ * from new primary inputs, which are created first in the order of the
+ * registers.  They are followed by the primary inputs of each frame, such
+ * that primary input `i` of frame `f` has index `offset + f * num_pis + i`.
+ * Primary output `i` of frame `f` has index `f * num_pos + i`.  If
+ * `ps.final_state_as_pos` is set, the register inputs of the last frame are
+ * appended as primary outputs.
+ *
+ * **Required network functions:**
+ * - `get_node`
+ * - `get_constant`
+ * - `is_complemented`
+ * - `is_constant`
+ * - `is_ci`
+ * - `foreach_pi`
+ * - `foreach_po`
+ * - `foreach_ro`
+ * - `foreach_ri`
+ * - `foreach_fanin`
+ * - `latch_reset`
+ * - `create_pi`
+ * - `create_po`
+ * - `create_not`
+ * - `clone_node`
+ */
+template<class Ntk>
+Ntk unroll( Ntk const& ntk, uint32_t num_frames, unrolling_params const& ps = {} )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
+  static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+  static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+  static_assert( has_is_ci_v<Ntk>, "Ntk does not implement the is_ci method" );
+  static_assert( has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi method" );
+  static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
+  static_assert( has_foreach_ro_v<Ntk>, "Ntk does not implement the foreach_ro method" );
+  static_assert( has_foreach_ri_v<Ntk>, "Ntk does not implement the foreach_ri method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_create_pi_v<Ntk>, "Ntk does not implement the create_pi method" );
+  static_assert( has_create_po_v<Ntk>, "Ntk does not implement the create_po method" );
+  static_assert( has_create_not_v<Ntk>, "Ntk does not implement the create_not method" );
+  static_assert( has_clone_node_v<Ntk>, "Ntk does not implement the clone_node method" );
+
+  using signal = typename Ntk::signal;
+
+  Ntk dest;
+  node_map<signal, Ntk> old_to_new( ntk );
+
+  old_to_new[ntk.get_constant( false )] = dest.get_constant( false );
+  if ( ntk.get_node( ntk.get_constant( true ) ) != ntk.get_node( ntk.get_constant( false ) ) )
+  {
+    old_to_new[ntk.get_constant( true )] = dest.get_constant( true );
+  }
+
+  const auto map_signal = [&]( signal const& f ) {
+    const auto g = old_to_new[f];
+    return ntk.is_complemented( f ) ? dest.create_not( g ) : g;
+  };
+
+  /* initial state */
+  std::vector<signal> state;
+  ntk.foreach_ro( [&]( auto const&, auto i ) {
+    switch ( ntk.latch_reset( i ) )
+    {
+    case 0:
+      state.push_back( dest.get_constant( false ) );
+      break;
+    case 1:
+      state.push_back( dest.get_constant( true ) );
+      break;
+    default:
+      state.push_back( ps.unknown_reset_as_pis ? dest.create_pi() : dest.get_constant( false ) );
+      break;
+    }
+  } );
+
+  /* gates in topological order, computed once for all frames */
+  std::vector<typename Ntk::node> gates;
+  topo_view topo{ntk};
+  topo.foreach_node( [&]( auto const& n ) {
+    if ( !ntk.is_constant( n ) && !ntk.is_ci( n ) )
+    {
+      gates.push_back( n );
+    }
+  } );
+
+  std::vector<signal> children;
+  for ( auto f = 0u; f < num_frames; ++f )
+  {
+    ntk.foreach_pi( [&]( auto const& n ) {
+      old_to_new[n] = dest.create_pi();
+    } );
+    ntk.foreach_ro( [&]( auto const& n, auto i ) {
+      old_to_new[n] = state[i];
+    } );
+
+    for ( auto const& n : gates )
+    {
+      children.clear();
+      ntk.foreach_fanin( n, [&]( auto const& child ) {
+        children.push_back( map_signal( child ) );
+      } );
+      old_to_new[n] = dest.clone_node( ntk, n, children );
+    }
+
+    ntk.foreach_po( [&]( auto const& po ) {
+      dest.create_po( map_signal( po ) );
+    } );
+    ntk.foreach_ri( [&]( auto const& ri, auto i ) {
+      state[i] = map_signal( ri );
+    } );
+  }
+
+  if ( ps.final_state_as_pos )
+  {
+    for ( auto const& s : state )
+    {
+      dest.create_po( s );
+    }
+  }
+
+  return dest;
+}
+
+} // namespace mockturtle
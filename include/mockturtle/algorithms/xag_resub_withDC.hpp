@@ -451,10 +451,17 @@ public:
       care = kitty::shrink_to( care, tt.num_vars() );
     else
       care = kitty::extend_to( care, tt.num_vars() );
+    /* signatures only contain reachable patterns, so they must agree under
+       satisfiability don't cares, but not under observability don't cares */
+    auto const filter = sim.use_signatures();
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     for ( auto i = 0u; i < num_divs; ++i )
     {
       auto const d = divs.at( i );
 
+      if ( filter && sig != sim.get_signature( ntk.make_signal( d ) ) )
+        continue;
+
       if ( binary_and( tt, care ) != binary_and( sim.get_tt( ntk.make_signal( d ) ), care ) )
         continue;
       return ( sim.get_phase( d ) ^ sim.get_phase( root ) ) ? !ntk.make_signal( d ) : ntk.make_signal( d );
@@ -470,14 +477,21 @@ public:
       care = kitty::shrink_to( care, tt.num_vars() );
     else
       care = kitty::extend_to( care, tt.num_vars() );
+    auto const filter = sim.use_signatures();
+    auto const sig = sim.get_signature( ntk.make_signal( root ) );
     /* check for divisors  */
     for ( auto i = 0u; i < num_divs; ++i )
     {
       auto const& s0 = divs.at( i );
+      auto const sig0 = sim.get_signature( ntk.make_signal( s0 ) );
 
       for ( auto j = i + 1; j < num_divs; ++j )
       {
         auto const& s1 = divs.at( j );
+        auto const sig_xor = sig0 ^ sim.get_signature( ntk.make_signal( s1 ) );
+        if ( filter && sig_xor != sig && sig_xor != ~sig )
+          continue;
+
         auto const& tt_s0 = sim.get_tt( ntk.make_signal( s0 ) );
         auto const& tt_s1 = sim.get_tt( ntk.make_signal( s1 ) );
 
@@ -508,17 +522,25 @@ public:
     else
       care = kitty::extend_to( care, tt.num_vars() );
 
+    auto const filter = sim.use_signatures();
+    auto const sig = sim.get_signature( s );
     for ( auto i = 0u; i < num_divs; ++i )
     {
       auto const s0 = divs.at( i );
+      auto const sig0 = sim.get_signature( ntk.make_signal( s0 ) );
 
       for ( auto j = i + 1; j < num_divs; ++j )
       {
         auto const s1 = divs.at( j );
+        auto const sig01 = sig0 ^ sim.get_signature( ntk.make_signal( s1 ) );
 
         for ( auto k = j + 1; k < num_divs; ++k )
         {
           auto const s2 = divs.at( k );
+          auto const sig_xor = sig01 ^ sim.get_signature( ntk.make_signal( s2 ) );
+          if ( filter && sig_xor != sig && sig_xor != ~sig )
+            continue;
+
           auto const& tt_s0 = sim.get_tt( ntk.make_signal( s0 ) );
           auto const& tt_s1 = sim.get_tt( ntk.make_signal( s1 ) );
           auto const& tt_s2 = sim.get_tt( ntk.make_signal( s2 ) );
@@ -36,11 +36,16 @@
 #include <kitty/kitty.hpp>
 #include <lorina/blif.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "../traits.hpp"
+#include "../utils/mapped_file.hpp"
+#include "detail/name_interner.hpp"
 
 namespace mockturtle
 {
@@ -266,4 +271,567 @@ private:
   mutable std::vector<std::tuple<std::string, int8_t, std::string, std::string, std::string>> latches;
 }; /* blif_reader */
 
+namespace detail
+{
+
+/* sum-of-products cover of a .names statement as a truth table */
+class blif_cover
+{
+public:
+  void reset( uint32_t num_vars )
+  {
+    _tt = kitty::dynamic_truth_table( num_vars );
+    _value = -1;
+  }
+
+  /* adds a cube such as `1-0`, returns false for malformed cubes */
+  bool add_cube( std::string_view cube, char value )
+  {
+    if ( cube.size() != static_cast<std::size_t>( _tt.num_vars() ) || cube.size() > 64u || ( value != '0' && value != '1' ) )
+    {
+      return false;
+    }
+    if ( _value != -1 && _value != value - '0' )
+    {
+      return false; /* mixed on-set and off-set cubes */
+    }
+    _value = value == '1' ? 1 : 0;
+
+    uint64_t mask{0u}, bits{0u};
+    for ( auto i = 0u; i < cube.size(); ++i )
+    {
+      switch ( cube[i] )
+      {
+      case '1':
+        bits |= uint64_t( 1 ) << i;
+        /* fall through */
+      case '0':
+        mask |= uint64_t( 1 ) << i;
+        break;
+      case '-':
+        break;
+      default:
+        return false;
+      }
+    }
+
+    static constexpr uint64_t projections[] = {
+        0xaaaaaaaaaaaaaaaa, 0xcccccccccccccccc, 0xf0f0f0f0f0f0f0f0,
+        0xff00ff00ff00ff00, 0xffff0000ffff0000, 0xffffffff00000000};
+
+    /* cube restricted to the first six variables */
+    uint64_t word = ~uint64_t( 0 );
+    for ( auto i = 0u; i < std::min<uint32_t>( 6u, _tt.num_vars() ); ++i )
+    {
+      if ( ( mask >> i ) & 1u )
+      {
+        word &= ( ( bits >> i ) & 1u ) ? projections[i] : ~projections[i];
+      }
+    }
+
+    /* blocks for which the remaining variables match */
+    const auto high_mask = mask >> 6;
+    const auto high_bits = bits >> 6;
+    auto block = 0u;
+    for ( auto it = _tt.begin(); it != _tt.end(); ++it, ++block )
+    {
+      if ( ( block & high_mask ) == high_bits )
+      {
+        *it |= word;
+      }
+    }
+    return true;
+  }
+
+  /* returns the truth table, the cover is complemented if it lists off-set cubes */
+  kitty::dynamic_truth_table const& function()
+  {
+    _tt.mask_bits();
+    if ( _value == 0 )
+    {
+      _tt = ~_tt;
+    }
+    return _tt;
+  }
+
+  bool empty() const
+  {
+    return _value == -1;
+  }
+
+  bool constant_value() const
+  {
+    return _value == 1;
+  }
+
+private:
+  kitty::dynamic_truth_table _tt;
+  int _value{-1};
+};
+
+template<class Ntk>
+class blif_fast_parser
+{
+public:
+  blif_fast_parser( Ntk& ntk, lorina::diagnostic_engine* diag )
+      : _ntk( ntk ),
+        _diag( diag )
+  {
+  }
+
+  lorina::return_code run( char const* begin, char const* end )
+  {
+    _pos = begin;
+    _end = end;
+
+    std::vector<std::string_view> tokens;
+    bool in_gate = false;
+    while ( next_line( tokens ) )
+    {
+      if ( tokens.empty() )
+      {
+        continue;
+      }
+
+      if ( tokens[0][0] != '.' )
+      {
+        if ( !in_gate )
+        {
+          return error( "unexpected line `" + std::string( tokens[0] ) + "`" );
+        }
+        auto const ok = _num_gate_inputs == 0u
+                            ? tokens.size() == 1u && tokens[0].size() == 1u && _cover.add_cube( {}, tokens[0][0] )
+                            : tokens.size() == 2u && tokens[1].size() == 1u && _cover.add_cube( tokens[0], tokens[1][0] );
+        if ( !ok )
+        {
+          return error( "invalid cover line for `" + std::string( _names.name( _gate_output ) ) + "`" );
+        }
+        continue;
+      }
+
+      if ( in_gate )
+      {
+        if ( !finish_gate() )
+        {
+          return lorina::return_code::parse_error;
+        }
+        in_gate = false;
+      }
+
+      auto const& cmd = tokens[0];
+      if ( cmd == ".names" )
+      {
+        if ( tokens.size() < 2u )
+        {
+          return error( "missing output in .names" );
+        }
+        _gate_output = id( tokens.back() );
+        _gate_inputs.clear();
+        for ( auto i = 1u; i + 1u < tokens.size(); ++i )
+        {
+          _gate_inputs.push_back( id( tokens[i] ) );
+        }
+        _num_gate_inputs = static_cast<uint32_t>( _gate_inputs.size() );
+        _cover.reset( _num_gate_inputs );
+        in_gate = true;
+      }
+      else if ( cmd == ".inputs" )
+      {
+        for ( auto i = 1u; i < tokens.size(); ++i )
+        {
+          const auto name = std::string( tokens[i] );
+          const auto s = _ntk.create_pi( name );
+          if constexpr ( has_set_name_v<Ntk> )
+          {
+            _ntk.set_name( s, name );
+          }
+          define( id( tokens[i] ), s );
+        }
+      }
+      else if ( cmd == ".outputs" )
+      {
+        for ( auto i = 1u; i < tokens.size(); ++i )
+        {
+          if constexpr ( has_set_output_name_v<Ntk> )
+          {
+            _ntk.set_output_name( static_cast<uint32_t>( _outputs.size() ), std::string( tokens[i] ) );
+          }
+          _outputs.push_back( id( tokens[i] ) );
+        }
+      }
+      else if ( cmd == ".latch" )
+      {
+        if ( !on_latch( tokens ) )
+        {
+          return lorina::return_code::parse_error;
+        }
+      }
+      else if ( cmd == ".end" )
+      {
+        break;
+      }
+      else if ( cmd == ".subckt" || cmd == ".gate" || cmd == ".mlatch" || cmd == ".exdc" || cmd == ".search" )
+      {
+        return error( "unsupported command `" + std::string( cmd ) + "`" );
+      }
+      /* other commands such as .model are ignored */
+    }
+
+    if ( in_gate && !finish_gate() )
+    {
+      return lorina::return_code::parse_error;
+    }
+
+    /* create gates whose fanins were defined after them */
+    for ( auto g = 0u; g < _deferred.size(); ++g )
+    {
+      if ( !create_deferred( _deferred[g].output ) )
+      {
+        return lorina::return_code::parse_error;
+      }
+    }
+
+    for ( auto o : _outputs )
+    {
+      if ( !is_defined( o ) )
+      {
+        return error( "output `" + std::string( _names.name( o ) ) + "` is not defined" );
+      }
+    }
+    for ( auto const& l : _latches )
+    {
+      if ( !is_defined( l.first ) )
+      {
+        return error( "latch input `" + std::string( _names.name( l.first ) ) + "` is not defined" );
+      }
+    }
+
+    for ( auto o : _outputs )
+    {
+      _ntk.create_po( _signals[o], std::string( _names.name( o ) ) );
+    }
+    /* register inputs follow all primary outputs, wherever .outputs appears */
+    for ( auto const& [input, reset] : _latches )
+    {
+      if constexpr ( has_set_output_name_v<Ntk> )
+      {
+        _ntk.set_output_name( _ntk.num_cos(), std::string( _names.name( input ) ) );
+      }
+      _ntk.create_ri( _signals[input], reset );
+    }
+
+    return lorina::return_code::success;
+  }
+
+private:
+  enum state : uint8_t
+  {
+    undefined,
+    deferred,
+    visiting,
+    defined
+  };
+
+  struct deferred_gate
+  {
+    uint32_t output;
+    uint32_t first_input;
+    uint32_t num_inputs;
+    kitty::dynamic_truth_table function;
+  };
+
+  /* reads the tokens of the next logical line, joining continued lines and
+     skipping comments */
+  bool next_line( std::vector<std::string_view>& tokens )
+  {
+    tokens.clear();
+    if ( _pos == _end )
+    {
+      return false;
+    }
+
+    while ( _pos != _end )
+    {
+      const auto c = *_pos;
+      if ( c == '\n' )
+      {
+        ++_pos;
+        break;
+      }
+      else if ( c == ' ' || c == '\t' || c == '\r' )
+      {
+        ++_pos;
+      }
+      else if ( c == '#' )
+      {
+        while ( _pos != _end && *_pos != '\n' )
+        {
+          ++_pos;
+        }
+      }
+      else if ( c == '\\' && _pos + 1 != _end && ( _pos[1] == '\n' || ( _pos[1] == '\r' && _pos + 2 != _end && _pos[2] == '\n' ) ) )
+      {
+        _pos += _pos[1] == '\n' ? 2 : 3;
+      }
+      else
+      {
+        const auto* first = _pos;
+        while ( _pos != _end && *_pos != ' ' && *_pos != '\t' && *_pos != '\r' && *_pos != '\n' && *_pos != '#' )
+        {
+          ++_pos;
+        }
+        tokens.emplace_back( first, _pos - first );
+      }
+    }
+    return true;
+  }
+
+  uint32_t id( std::string_view name )
+  {
+    const auto i = _names[name];
+    if ( i >= _state.size() )
+    {
+      _state.resize( i + 1u, undefined );
+      _signals.resize( i + 1u );
+      _deferred_index.resize( i + 1u );
+    }
+    return i;
+  }
+
+  bool is_defined( uint32_t i ) const
+  {
+    return _state[i] == defined;
+  }
+
+  void define( uint32_t i, signal<Ntk> const& s )
+  {
+    _signals[i] = s;
+    _state[i] = defined;
+  }
+
+  bool finish_gate()
+  {
+    if ( _state[_gate_output] != undefined )
+    {
+      error( "signal `" + std::string( _names.name( _gate_output ) ) + "` is defined twice" );
+      return false;
+    }
+
+    if ( _num_gate_inputs == 0u )
+    {
+      define( _gate_output, _ntk.get_constant( !_cover.empty() && _cover.constant_value() ) );
+      return true;
+    }
+    if ( _cover.empty() )
+    {
+      define( _gate_output, _ntk.get_constant( false ) );
+      return true;
+    }
+
+    if ( std::all_of( _gate_inputs.begin(), _gate_inputs.end(), [&]( auto i ) { return is_defined( i ); } ) )
+    {
+      _fanins.clear();
+      for ( auto i : _gate_inputs )
+      {
+        _fanins.push_back( _signals[i] );
+      }
+      define( _gate_output, _ntk.create_node( _fanins, _cover.function() ) );
+      return true;
+    }
+
+    _deferred_index[_gate_output] = static_cast<uint32_t>( _deferred.size() );
+    _deferred.push_back( {_gate_output, static_cast<uint32_t>( _deferred_inputs.size() ), _num_gate_inputs, _cover.function()} );
+    _deferred_inputs.insert( _deferred_inputs.end(), _gate_inputs.begin(), _gate_inputs.end() );
+    _state[_gate_output] = deferred;
+    return true;
+  }
+
+  /* creates a deferred gate after its transitive fanin */
+  bool create_deferred( uint32_t root )
+  {
+    if ( _state[root] != deferred )
+    {
+      return true;
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> stack{{root, 0u}};
+    _state[root] = visiting;
+    while ( !stack.empty() )
+    {
+      auto& [i, next] = stack.back();
+      auto const& g = _deferred[_deferred_index[i]];
+      if ( next < g.num_inputs )
+      {
+        const auto fanin = _deferred_inputs[g.first_input + next++];
+        switch ( _state[fanin] )
+        {
+        case defined:
+          break;
+        case deferred:
+          _state[fanin] = visiting;
+          stack.emplace_back( fanin, 0u );
+          break;
+        case visiting:
+          error( "combinational cycle at `" + std::string( _names.name( fanin ) ) + "`" );
+          return false;
+        default:
+          error( "signal `" + std::string( _names.name( fanin ) ) + "` is not defined" );
+          return false;
+        }
+        continue;
+      }
+
+      _fanins.clear();
+      for ( auto k = 0u; k < g.num_inputs; ++k )
+      {
+        _fanins.push_back( _signals[_deferred_inputs[g.first_input + k]] );
+      }
+      define( i, _ntk.create_node( _fanins, g.function ) );
+      stack.pop_back();
+    }
+    return true;
+  }
+
+  bool on_latch( std::vector<std::string_view> const& tokens )
+  {
+    if ( tokens.size() < 3u || tokens.size() > 6u )
+    {
+      error( "latch format not supported" );
+      return false;
+    }
+
+    const auto input = id( tokens[1] );
+    const auto output = id( tokens[2] );
+    const auto output_name = std::string( tokens[2] );
+
+    const auto s = _ntk.create_ro( output_name );
+    define( output, s );
+    if constexpr ( has_set_name_v<Ntk> && has_set_output_name_v<Ntk> )
+    {
+      _ntk.set_name( s, output_name );
+    }
+
+    /* same encoding as in blif_reader */
+    std::string_view type = "re", init;
+    latch_info info;
+    info.control = "clock";
+    if ( tokens.size() == 4u )
+    {
+      init = tokens[3];
+    }
+    else if ( tokens.size() >= 5u )
+    {
+      type = tokens[3];
+      info.control = std::string( tokens[4] );
+      if ( tokens.size() == 6u )
+      {
+        init = tokens[5];
+      }
+    }
+    info.type = ( type == "fe" || type == "re" || type == "ah" || type == "al" ) ? std::string( type ) : "as";
+    info.init = init == "0" ? 0 : ( init == "1" ? 1 : ( init == "2" ? 2 : 3 ) );
+
+    _ntk._storage->latch_information[_ntk.get_node( s )] = info;
+    _latches.emplace_back( input, static_cast<int8_t>( info.init ) );
+    return true;
+  }
+
+  lorina::return_code error( std::string const& message )
+  {
+    if ( _diag )
+    {
+      _diag->report( lorina::diagnostic_level::fatal, message );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+private:
+  Ntk& _ntk;
+  lorina::diagnostic_engine* _diag;
+
+  char const* _pos{nullptr};
+  char const* _end{nullptr};
+
+  name_interner _names;
+  std::vector<uint8_t> _state;
+  std::vector<signal<Ntk>> _signals;
+  std::vector<uint32_t> _outputs;
+  std::vector<std::pair<uint32_t, int8_t>> _latches;
+
+  uint32_t _gate_output{0u};
+  uint32_t _num_gate_inputs{0u};
+  std::vector<uint32_t> _gate_inputs;
+  blif_cover _cover;
+  std::vector<signal<Ntk>> _fanins;
+
+  std::vector<deferred_gate> _deferred;
+  std::vector<uint32_t> _deferred_inputs;
+  std::vector<uint32_t> _deferred_index;
+};
+
+} // namespace detail
+
+/*! \brief Reads a BLIF file from a memory buffer into a network.
+ *
+ * This is a fast alternative to `lorina::read_blif` with `blif_reader`.
+ * The buffer is tokenized in place, signal names are interned in a flat
+ * hash table as views into the buffer, and covers are converted into truth
+ * tables with word-level operations.  Gates are created as soon as all
+ * their fanins are known, gates that are defined before their fanins are
+ * created after parsing.  Only the first model is read.
+ *
+ * **Required network functions:**
+ * - `create_pi`
+ * - `create_po`
+ * - `create_node`
+ * - `get_constant`
+ *
+ * \param data Pointer to the BLIF contents
+ * \param size Size of the BLIF contents
+ * \param ntk Network
+ * \param diag Optional diagnostic engine for parse errors
+ */
+template<typename Ntk>
+lorina::return_code read_blif_fast( char const* data, std::size_t size, Ntk& ntk, lorina::diagnostic_engine* diag = nullptr )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_create_pi_v<Ntk>, "Ntk does not implement the create_pi function" );
+  static_assert( has_create_po_v<Ntk>, "Ntk does not implement the create_po function" );
+  static_assert( has_create_node_v<Ntk>, "Ntk does not implement the create_node function" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant function" );
+
+  detail::blif_fast_parser<Ntk> parser( ntk, diag );
+  return parser.run( data, data + size );
+}
+
+/*! \brief Reads a BLIF file into a network.
+ *
+ * The file is mapped into memory and parsed with `read_blif_fast`.
+ *
+   \verbatim embed:rst
+   Example
+   .. code-block:: c++
+      klut_network klut;
+      read_blif_fast( "file.blif", klut );
+   \endverbatim
+ *
+ * \param filename Filename
+ * \param ntk Network
+ * \param diag Optional diagnostic engine for parse errors
+ */
+template<typename Ntk>
+lorina::return_code read_blif_fast( std::string const& filename, Ntk& ntk, lorina::diagnostic_engine* diag = nullptr )
+{
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::fatal, "could not open file `" + filename + "`" );
+    }
+    return lorina::return_code::parse_error;
+  }
+  return read_blif_fast( file.data(), file.size(), ntk, diag );
+}
+
 } /* namespace mockturtle */
\ No newline at end of file
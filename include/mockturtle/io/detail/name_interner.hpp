@@ -0,0 +1,133 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file name_interner.hpp
+  \brief Flat hash table for signal names used by the fast readers
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+/* interns names as views into the parsed buffer, names are assigned
+   consecutive ids in order of their first occurrence; the viewed
+   characters must outlive the table */
+class name_interner
+{
+public:
+  name_interner()
+      : _slots( 1u << 10, 0u )
+  {
+  }
+
+  uint32_t operator[]( std::string_view name )
+  {
+    return insert( name, hash( name ) );
+  }
+
+  /* interns `name` whose hash value `h` is already known */
+  uint32_t insert( std::string_view name, uint64_t h )
+  {
+    auto i = h & ( _slots.size() - 1u );
+    while ( _slots[i] != 0u )
+    {
+      const auto id = _slots[i] - 1u;
+      if ( _hashes[id] == h && _names[id] == name )
+      {
+        return id;
+      }
+      i = ( i + 1u ) & ( _slots.size() - 1u );
+    }
+
+    const auto id = static_cast<uint32_t>( _names.size() );
+    _names.push_back( name );
+    _hashes.push_back( h );
+    _slots[i] = id + 1u;
+    if ( 2u * _names.size() > _slots.size() )
+    {
+      grow();
+    }
+    return id;
+  }
+
+  std::string_view name( uint32_t id ) const
+  {
+    return _names[id];
+  }
+
+  uint64_t hash_of( uint32_t id ) const
+  {
+    return _hashes[id];
+  }
+
+  uint32_t size() const
+  {
+    return static_cast<uint32_t>( _names.size() );
+  }
+
+  static uint64_t hash( std::string_view name )
+  {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for ( auto c : name )
+    {
+      h = ( h ^ static_cast<uint8_t>( c ) ) * 0x100000001b3ull;
+    }
+    return h ^ ( h >> 32 );
+  }
+
+private:
+  void grow()
+  {
+    std::vector<uint32_t> slots( 2u * _slots.size(), 0u );
+    for ( auto id = 0u; id < _names.size(); ++id )
+    {
+      auto i = _hashes[id] & ( slots.size() - 1u );
+      while ( slots[i] != 0u )
+      {
+        i = ( i + 1u ) & ( slots.size() - 1u );
+      }
+      slots[i] = id + 1u;
+    }
+    _slots.swap( slots );
+  }
+
+private:
+  std::vector<uint32_t> _slots;
+  std::vector<std::string_view> _names;
+  std::vector<uint64_t> _hashes;
+};
+
+} // namespace detail
+
+} // namespace mockturtle
@@ -0,0 +1,696 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file snapshot.hpp
+  \brief Save and restore networks in a native binary format
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+
+#include "../networks/aig.hpp"
+#include "../networks/klut.hpp"
+#include "../networks/mig.hpp"
+#include "../networks/xag.hpp"
+#include "../networks/xmg.hpp"
+#include "../traits.hpp"
+#include "../utils/mapped_file.hpp"
+#include "../utils/output_buffer.hpp"
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+static constexpr char snapshot_magic[8] = {'m', 't', 's', 'n', 'a', 'p', '\0', '\0'};
+static constexpr uint32_t snapshot_version = 1u;
+static constexpr uint32_t snapshot_byte_order = 0x01020304u;
+
+template<class Ntk>
+constexpr uint32_t snapshot_kind()
+{
+  using base = typename Ntk::base_type;
+  if constexpr ( std::is_same_v<base, aig_network> )
+    return 1u;
+  else if constexpr ( std::is_same_v<base, mig_network> )
+    return 2u;
+  else if constexpr ( std::is_same_v<base, xag_network> )
+    return 3u;
+  else if constexpr ( std::is_same_v<base, xmg_network> )
+    return 4u;
+  else if constexpr ( std::is_same_v<base, klut_network> )
+    return 5u;
+  else
+    return 0u;
+}
+
+class snapshot_sink
+{
+public:
+  explicit snapshot_sink( output_buffer& out ) : _out( out ) {}
+
+  void bytes( void const* data, std::size_t size )
+  {
+    _out << std::string_view( static_cast<char const*>( data ), size );
+  }
+
+  template<typename T>
+  void value( T const& v )
+  {
+    bytes( &v, sizeof( T ) );
+  }
+
+  template<typename T>
+  void array( std::vector<T> const& v )
+  {
+    value( static_cast<uint64_t>( v.size() ) );
+    bytes( v.data(), v.size() * sizeof( T ) );
+  }
+
+  void string( std::string const& s )
+  {
+    value( static_cast<uint64_t>( s.size() ) );
+    bytes( s.data(), s.size() );
+  }
+
+private:
+  output_buffer& _out;
+};
+
+class snapshot_source
+{
+public:
+  snapshot_source( char const* begin, char const* end ) : _pos( begin ), _end( end ) {}
+
+  bool bytes( void* data, std::size_t size )
+  {
+    if ( !fits( size, 1u ) )
+    {
+      return false;
+    }
+    if ( size != 0u )
+    {
+      std::memcpy( data, _pos, size );
+    }
+    _pos += size;
+    return true;
+  }
+
+  template<typename T>
+  bool value( T& v )
+  {
+    return bytes( &v, sizeof( T ) );
+  }
+
+  template<typename T>
+  bool array( std::vector<T>& v )
+  {
+    uint64_t size;
+    if ( !value( size ) || !fits( size, sizeof( T ) ) )
+    {
+      return false;
+    }
+    v.resize( size );
+    return bytes( v.data(), size * sizeof( T ) );
+  }
+
+  bool string( std::string& s )
+  {
+    uint64_t size;
+    if ( !value( size ) || !fits( size, 1u ) )
+    {
+      return false;
+    }
+    s.assign( _pos, size );
+    _pos += size;
+    return true;
+  }
+
+  /* checks whether `count` elements of `size` bytes can be read */
+  bool fits( uint64_t count, std::size_t size ) const
+  {
+    return count <= static_cast<uint64_t>( _end - _pos ) / size;
+  }
+
+private:
+  char const* _pos;
+  char const* _end;
+};
+
+template<class Ntk>
+uint64_t snapshot_signal( Ntk const& ntk, signal<Ntk> const& f )
+{
+  return ( ntk.node_to_index( ntk.get_node( f ) ) << 1 ) | ( ntk.is_complemented( f ) ? 1u : 0u );
+}
+
+template<class Ntk>
+void write_snapshot( Ntk const& ntk, output_buffer& out )
+{
+  using storage_type = typename std::decay_t<decltype( *ntk._storage )>;
+  using node_type = typename storage_type::node_type;
+
+  auto const& st = *ntk._storage;
+  snapshot_sink sink( out );
+
+  /* header */
+  sink.bytes( snapshot_magic, sizeof( snapshot_magic ) );
+  sink.value( snapshot_version );
+  sink.value( snapshot_byte_order );
+  sink.value( snapshot_kind<Ntk>() );
+  sink.value( static_cast<uint32_t>( sizeof( node_type ) ) );
+
+  /* nodes */
+  if constexpr ( std::is_trivially_copyable_v<node_type> )
+  {
+    sink.array( st.nodes );
+  }
+  else
+  {
+    /* nodes with a variable number of fanins are split into fanin sizes,
+       node data, and one array with all fanins */
+    std::vector<uint32_t> fanin_sizes;
+    std::vector<decltype( node_type::data )> data;
+    std::vector<typename node_type::pointer_type> children;
+    fanin_sizes.reserve( st.nodes.size() );
+    data.reserve( st.nodes.size() );
+    for ( auto const& n : st.nodes )
+    {
+      fanin_sizes.push_back( static_cast<uint32_t>( n.children.size() ) );
+      data.push_back( n.data );
+      children.insert( children.end(), n.children.begin(), n.children.end() );
+    }
+    sink.array( fanin_sizes );
+    sink.array( data );
+    sink.array( children );
+  }
+
+  if constexpr ( std::is_same_v<typename Ntk::base_type, klut_network> )
+  {
+    auto const& cache = st.data.cache;
+    sink.value( static_cast<uint64_t>( cache.size() ) );
+    for ( auto i = 0u; i < cache.size(); ++i )
+    {
+      auto const tt = cache[2 * i];
+      sink.value( static_cast<uint32_t>( tt.num_vars() ) );
+      sink.bytes( &*tt.cbegin(), tt.num_blocks() * sizeof( uint64_t ) );
+    }
+  }
+
+  /* inputs, outputs, and registers */
+  sink.array( st.inputs );
+  sink.array( st.outputs );
+  sink.value( st.data.num_pis );
+  sink.value( st.data.num_pos );
+  sink.value( st.data.trav_id );
+  sink.array( st.data.latches );
+
+  std::vector<uint64_t> latch_nodes;
+  for ( auto const& [n, _] : st.latch_information )
+  {
+    latch_nodes.push_back( n );
+  }
+  std::sort( latch_nodes.begin(), latch_nodes.end() );
+  sink.value( static_cast<uint64_t>( latch_nodes.size() ) );
+  for ( auto n : latch_nodes )
+  {
+    auto const& info = st.latch_information.at( n );
+    sink.value( n );
+    sink.value( info.init );
+    sink.string( info.control );
+    sink.string( info.type );
+  }
+
+  /* indexes of structurally hashed nodes */
+  std::vector<uint64_t> hashed;
+  hashed.reserve( st.hash.size() );
+  for ( auto const& entry : st.hash.materialize() )
+  {
+    hashed.push_back( entry.second );
+  }
+  std::sort( hashed.begin(), hashed.end() );
+  sink.array( hashed );
+
+  /* names */
+  std::vector<std::pair<uint64_t, std::string>> names;
+  std::vector<std::pair<uint32_t, std::string>> output_names;
+  if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
+  {
+    ntk.foreach_node( [&]( auto const& n ) {
+      const auto f = ntk.make_signal( n );
+      if ( ntk.has_name( f ) )
+      {
+        names.emplace_back( snapshot_signal( ntk, f ), ntk.get_name( f ) );
+      }
+      if constexpr ( !std::is_same_v<signal<Ntk>, node<Ntk>> )
+      {
+        if ( ntk.has_name( !f ) )
+        {
+          names.emplace_back( snapshot_signal( ntk, !f ), ntk.get_name( !f ) );
+        }
+      }
+    } );
+  }
+  if constexpr ( has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
+  {
+    for ( auto i = 0u; i < ntk.num_pos(); ++i )
+    {
+      if ( ntk.has_output_name( i ) )
+      {
+        output_names.emplace_back( i, ntk.get_output_name( i ) );
+      }
+    }
+  }
+  sink.value( static_cast<uint64_t>( names.size() ) );
+  for ( auto const& [f, name] : names )
+  {
+    sink.value( f );
+    sink.string( name );
+  }
+  sink.value( static_cast<uint64_t>( output_names.size() ) );
+  for ( auto const& [i, name] : output_names )
+  {
+    sink.value( i );
+    sink.string( name );
+  }
+}
+
+/* checks that all indexes in a restored storage are in range, such that the
+   network can access it without bounds checks */
+template<class Ntk, class Storage>
+bool is_valid_snapshot( std::shared_ptr<Storage> const& st, std::vector<uint64_t> const& hashed )
+{
+  constexpr auto is_klut = std::is_same_v<typename Ntk::base_type, klut_network>;
+  constexpr uint64_t num_constants = is_klut ? 2u : 1u;
+  const auto num_nodes = st->nodes.size();
+
+  if ( num_nodes < num_constants ||
+       st->data.num_pis > st->inputs.size() || st->inputs.size() - st->data.num_pis != st->data.latches.size() ||
+       st->data.num_pos > st->outputs.size() || st->outputs.size() - st->data.num_pos != st->data.latches.size() )
+  {
+    return false;
+  }
+
+  std::vector<bool> is_input( num_nodes, false );
+  for ( auto n : st->inputs )
+  {
+    if ( n < num_constants || n >= num_nodes || is_input[n] )
+    {
+      return false;
+    }
+    is_input[n] = true;
+  }
+
+  if constexpr ( !is_klut )
+  {
+    /* the network identifies combinational inputs by the contents of their nodes */
+    typename Ntk::base_type base( st );
+    for ( auto i = 0u; i < st->inputs.size(); ++i )
+    {
+      const auto n = st->inputs[i];
+      if ( !base.is_ci( n ) || base.is_pi( n ) != ( i < st->data.num_pis ) ||
+           ( i >= st->data.num_pis && base.ro_index( n ) != i - st->data.num_pis ) )
+      {
+        return false;
+      }
+    }
+    for ( auto n = num_constants; n < num_nodes; ++n )
+    {
+      if ( !is_input[n] && base.is_ci( n ) )
+      {
+        return false;
+      }
+    }
+  }
+
+  /* number of variables of each function in the truth table cache */
+  std::vector<uint32_t> num_vars;
+  if constexpr ( is_klut )
+  {
+    for ( auto i = 0u; i < st->data.cache.size(); ++i )
+    {
+      num_vars.push_back( st->data.cache[2 * i].num_vars() );
+    }
+  }
+
+  for ( auto n = 0u; n < num_nodes; ++n )
+  {
+    auto const& node = st->nodes[n];
+    if constexpr ( is_klut )
+    {
+      const auto literal = node.data[1].h1;
+      if ( literal >= 2u * num_vars.size() )
+      {
+        return false;
+      }
+      if ( n >= num_constants && !is_input[n] && num_vars[literal >> 1] != node.children.size() )
+      {
+        return false;
+      }
+    }
+
+    if ( n >= num_constants && !is_input[n] &&
+         std::any_of( node.children.begin(), node.children.end(), [&]( auto const& c ) { return c.index >= num_nodes; } ) )
+    {
+      return false;
+    }
+  }
+
+  return std::all_of( st->outputs.begin(), st->outputs.end(), [&]( auto const& f ) { return f.index < num_nodes; } ) &&
+         std::all_of( st->latch_information.begin(), st->latch_information.end(), [&]( auto const& entry ) { return entry.first < num_nodes; } ) &&
+         std::all_of( hashed.begin(), hashed.end(), [&]( auto n ) { return n < num_nodes && n >= num_constants && !is_input[n]; } );
+}
+
+template<class Ntk>
+bool read_snapshot( snapshot_source& src, Ntk& ntk )
+{
+  using storage_type = typename std::decay_t<decltype( *ntk._storage )>;
+  using node_type = typename storage_type::node_type;
+
+  /* header */
+  char magic[sizeof( snapshot_magic )];
+  uint32_t version, byte_order, kind, node_size;
+  if ( !src.bytes( magic, sizeof( magic ) ) || std::memcmp( magic, snapshot_magic, sizeof( magic ) ) != 0 ||
+       !src.value( version ) || version != snapshot_version ||
+       !src.value( byte_order ) || byte_order != snapshot_byte_order ||
+       !src.value( kind ) || kind != snapshot_kind<Ntk>() ||
+       !src.value( node_size ) || node_size != sizeof( node_type ) )
+  {
+    return false;
+  }
+
+  auto st = std::make_shared<storage_type>();
+
+  /* nodes */
+  if constexpr ( std::is_trivially_copyable_v<node_type> )
+  {
+    if ( !src.array( st->nodes ) )
+    {
+      return false;
+    }
+  }
+  else
+  {
+    std::vector<uint32_t> fanin_sizes;
+    std::vector<decltype( node_type::data )> data;
+    std::vector<typename node_type::pointer_type> children;
+    if ( !src.array( fanin_sizes ) || !src.array( data ) || !src.array( children ) || data.size() != fanin_sizes.size() )
+    {
+      return false;
+    }
+
+    st->nodes.resize( fanin_sizes.size() );
+    auto it = children.begin();
+    for ( auto i = 0u; i < fanin_sizes.size(); ++i )
+    {
+      if ( static_cast<uint64_t>( children.end() - it ) < fanin_sizes[i] )
+      {
+        return false;
+      }
+      st->nodes[i].children.assign( it, it + fanin_sizes[i] );
+      st->nodes[i].data = data[i];
+      it += fanin_sizes[i];
+    }
+  }
+
+  if constexpr ( std::is_same_v<typename Ntk::base_type, klut_network> )
+  {
+    /* entries are stored normalized, re-inserting them preserves the literals */
+    uint64_t num_entries;
+    if ( !src.value( num_entries ) )
+    {
+      return false;
+    }
+    std::vector<uint64_t> words;
+    for ( auto i = 0u; i < num_entries; ++i )
+    {
+      uint32_t num_vars;
+      if ( !src.value( num_vars ) || num_vars > 32u )
+      {
+        return false;
+      }
+      /* check the size before allocating the truth table */
+      const auto num_blocks = num_vars <= 6u ? uint64_t( 1u ) : uint64_t( 1u ) << ( num_vars - 6u );
+      if ( !src.fits( num_blocks, sizeof( uint64_t ) ) )
+      {
+        return false;
+      }
+      kitty::dynamic_truth_table tt( num_vars );
+      words.resize( tt.num_blocks() );
+      if ( !src.bytes( words.data(), words.size() * sizeof( uint64_t ) ) )
+      {
+        return false;
+      }
+      kitty::create_from_words( tt, words.begin(), words.end() );
+      st->data.cache.insert( tt );
+    }
+  }
+
+  /* inputs, outputs, and registers */
+  uint64_t num_latch_info;
+  if ( !src.array( st->inputs ) || !src.array( st->outputs ) ||
+       !src.value( st->data.num_pis ) || !src.value( st->data.num_pos ) || !src.value( st->data.trav_id ) ||
+       !src.array( st->data.latches ) || !src.value( num_latch_info ) )
+  {
+    return false;
+  }
+  for ( auto i = 0u; i < num_latch_info; ++i )
+  {
+    uint64_t n;
+    latch_info info;
+    if ( !src.value( n ) || !src.value( info.init ) || !src.string( info.control ) || !src.string( info.type ) )
+    {
+      return false;
+    }
+    st->latch_information[n] = info;
+  }
+
+  /* the structural hash table is only filled when it is accessed */
+  std::vector<uint64_t> hashed;
+  if ( !src.array( hashed ) || !is_valid_snapshot<Ntk>( st, hashed ) )
+  {
+    return false;
+  }
+  const auto num_hashed = hashed.size();
+  st->hash.defer( [nodes = &st->nodes, hashed = std::move( hashed )]( auto& map ) {
+    map.reserve( hashed.size() );
+    for ( auto n : hashed )
+    {
+      map[( *nodes )[n]] = n;
+    }
+  },
+                  num_hashed );
+
+  /* names */
+  uint64_t num_names, num_output_names;
+  std::vector<std::pair<uint64_t, std::string>> names;
+  std::vector<std::pair<uint32_t, std::string>> output_names;
+  if ( !src.value( num_names ) )
+  {
+    return false;
+  }
+  for ( auto i = 0u; i < num_names; ++i )
+  {
+    auto& [f, name] = names.emplace_back();
+    if ( !src.value( f ) || !src.string( name ) || ( f >> 1 ) >= st->nodes.size() )
+    {
+      return false;
+    }
+  }
+  if ( !src.value( num_output_names ) )
+  {
+    return false;
+  }
+  for ( auto i = 0u; i < num_output_names; ++i )
+  {
+    auto& [index, name] = output_names.emplace_back();
+    if ( !src.value( index ) || !src.string( name ) || index >= st->data.num_pos )
+    {
+      return false;
+    }
+  }
+
+  ntk._storage = st;
+
+  if constexpr ( has_set_name_v<Ntk> )
+  {
+    for ( auto const& [f, name] : names )
+    {
+      auto s = ntk.make_signal( ntk.index_to_node( f >> 1 ) );
+      if constexpr ( !std::is_same_v<signal<Ntk>, node<Ntk>> )
+      {
+        if ( f & 1 )
+        {
+          s = !s;
+        }
+      }
+      ntk.set_name( s, name );
+    }
+  }
+  if constexpr ( has_set_output_name_v<Ntk> )
+  {
+    for ( auto const& [index, name] : output_names )
+    {
+      ntk.set_output_name( index, name );
+    }
+  }
+
+  return true;
+}
+
+} // namespace detail
+
+/*! \brief Writes a snapshot of a network into an output stream
+ *
+ * A snapshot contains the storage of a network as it is in memory: the node
+ * array, primary inputs and outputs, register information, the indexes of
+ * the structurally hashed nodes, and, if the network provides them (e.g.,
+ * via `names_view`), signal and output names.  Node arrays of fixed-fanin
+ * networks are written as a single block, so that saving and restoring is
+ * mostly a copy of memory.
+ *
+ * Snapshots are meant as checkpoints of a running flow: they are specific
+ * to the network type, the build, and the byte order of the machine that
+ * wrote them.  Use `write_aiger` or `write_verilog` for exchange.
+ *
+ * Supported networks are `aig_network`, `mig_network`, `xag_network`,
+ * `xmg_network`, and `klut_network` (also wrapped in views).
+ *
+ * An overloaded variant exists that writes the snapshot into a file and
+ * another one that writes the snapshot into a memory buffer.
+ *
+ * \param ntk Network
+ * \param os Output stream
+ */
+template<class Ntk>
+void write_snapshot( Ntk const& ntk, std::ostream& os )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( detail::snapshot_kind<Ntk>() != 0u, "Ntk is not supported by snapshots" );
+
+  output_buffer out( os );
+  detail::write_snapshot( ntk, out );
+  out.flush();
+}
+
+/*! \brief Writes a snapshot of a network into a file
+ *
+ * \param ntk Network
+ * \param filename Filename
+ */
+template<class Ntk>
+void write_snapshot( Ntk const& ntk, std::string const& filename )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  write_snapshot( ntk, os );
+  os.close();
+}
+
+/*! \brief Writes a snapshot of a network into a memory buffer
+ *
+ * The snapshot is appended to `buffer`.
+ *
+ * \param ntk Network
+ * \param buffer Memory buffer
+ */
+template<class Ntk>
+void write_snapshot( Ntk const& ntk, std::vector<char>& buffer )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( detail::snapshot_kind<Ntk>() != 0u, "Ntk is not supported by snapshots" );
+
+  output_buffer out( buffer );
+  detail::write_snapshot( ntk, out );
+}
+
+/*! \brief Restores a network from a snapshot in memory
+ *
+ * The storage of `ntk` is replaced by the contents of the snapshot; event
+ * handlers registered at `ntk` are kept.  The structural hash table is not
+ * built while reading, but when it is accessed for the first time, e.g.,
+ * when a gate is created.  If `ntk` provides names (e.g., via
+ * `names_view`), the names in the snapshot are added to it.
+ *
+ * Returns false, and leaves `ntk` unchanged, if the data is not a valid
+ * snapshot of a network of the same type, e.g., if it is truncated or if a
+ * node, input, output, or function index is out of range.
+ *
+   \verbatim embed:rst
+   Example
+   .. code-block:: c++
+      std::vector<char> buffer;
+      write_snapshot( aig, buffer );
+      ...
+      aig_network restored;
+      read_snapshot( buffer.data(), buffer.size(), restored );
+   \endverbatim
+ *
+ * \param data Pointer to the snapshot
+ * \param size Size of the snapshot
+ * \param ntk Network
+ */
+template<class Ntk>
+bool read_snapshot( char const* data, std::size_t size, Ntk& ntk )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( detail::snapshot_kind<Ntk>() != 0u, "Ntk is not supported by snapshots" );
+
+  detail::snapshot_source src( data, data + size );
+  return detail::read_snapshot( src, ntk );
+}
+
+/*! \brief Restores a network from a snapshot file
+ *
+ * The file is mapped into memory and read with `read_snapshot`.
+ *
+ * \param filename Filename
+ * \param ntk Network
+ */
+template<class Ntk>
+bool read_snapshot( std::string const& filename, Ntk& ntk )
+{
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    return false;
+  }
+  return read_snapshot( file.data(), file.size(), ntk );
+}
+
+} /* namespace mockturtle */
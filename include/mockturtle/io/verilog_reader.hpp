@@ -34,11 +34,17 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <charconv>
+#include <deque>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <regex>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <fmt/format.h>
@@ -47,6 +53,8 @@
 #include "../traits.hpp"
 #include "../generators/arithmetic.hpp"
 #include "../generators/modular_arithmetic.hpp"
+#include "../utils/mapped_file.hpp"
+#include "detail/name_interner.hpp"
 
 namespace mockturtle
 {
@@ -373,4 +381,879 @@ private:
   std::regex hex_string{"(\\d+)'h([0-9a-fA-F]+)"};
 };
 
+namespace detail
+{
+
+/* operators in the expression programs of assignments; operands are encoded
+   as `2 * id + complemented` and are smaller than all operators */
+enum verilog_op : uint32_t
+{
+  verilog_op_not = 0xfffffff0u,
+  verilog_op_and,
+  verilog_op_or,
+  verilog_op_xor,
+  verilog_op_const0,
+  verilog_op_const1
+};
+
+struct verilog_statement
+{
+  enum kind_t : uint8_t
+  {
+    input,
+    output,
+    assign,
+    end_module
+  };
+
+  kind_t kind;
+  uint32_t lhs; /* chunk-local id */
+  uint32_t code_begin;
+  uint32_t code_end;
+};
+
+/* statements of a part of the file, names are interned per chunk and mapped
+   to global ids after all chunks have been parsed */
+struct verilog_chunk
+{
+  char const* begin{nullptr};
+  char const* end{nullptr};
+
+  name_interner names;
+  std::deque<std::string> bit_names; /* names of bits in vector declarations */
+  std::vector<uint32_t> global;      /* chunk-local id to global id */
+
+  std::vector<verilog_statement> statements;
+  std::vector<uint32_t> code;
+  std::string error; /* parsing stopped after the last statement */
+};
+
+/* runs `fn( i )` for all i < num_tasks on up to num_threads threads */
+template<class Fn>
+void verilog_parallel_for( uint32_t num_tasks, uint32_t num_threads, Fn&& fn )
+{
+  if ( num_threads <= 1u || num_tasks <= 1u )
+  {
+    for ( auto i = 0u; i < num_tasks; ++i )
+    {
+      fn( i );
+    }
+    return;
+  }
+
+  std::atomic<uint32_t> next{0u};
+  std::vector<std::thread> threads;
+  for ( auto t = 0u; t < std::min( num_threads, num_tasks ); ++t )
+  {
+    threads.emplace_back( [&]() {
+      for ( auto i = next++; i < num_tasks; i = next++ )
+      {
+        fn( i );
+      }
+    } );
+  }
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+}
+
+/* splits the text into about `num_chunks` parts which end after a `;`
+   outside of comments */
+inline std::vector<char const*> split_verilog( char const* begin, char const* end, uint32_t num_chunks )
+{
+  std::vector<char const*> bounds{begin};
+  const auto size = static_cast<uint64_t>( end - begin );
+  auto p = begin;
+  for ( auto k = 1u; k < num_chunks && p != end; ++k )
+  {
+    const auto target = begin + size * k / num_chunks;
+    while ( p != end )
+    {
+      const auto c = *p;
+      if ( c == '/' && p + 1 != end && p[1] == '/' )
+      {
+        while ( p != end && *p != '\n' )
+          ++p;
+      }
+      else if ( c == '/' && p + 1 != end && p[1] == '*' )
+      {
+        p += 2;
+        while ( p != end && !( *p == '*' && p + 1 != end && p[1] == '/' ) )
+          ++p;
+        p = p == end ? end : p + 2;
+      }
+      else if ( c == '\\' )
+      {
+        while ( p != end && !std::isspace( static_cast<unsigned char>( *p ) ) )
+          ++p;
+      }
+      else if ( c == ';' && p >= target )
+      {
+        ++p;
+        break;
+      }
+      else
+      {
+        ++p;
+      }
+    }
+    if ( p != end )
+    {
+      bounds.push_back( p );
+    }
+  }
+  bounds.push_back( end );
+  return bounds;
+}
+
+/* tokenizes the statements of one chunk into expression programs */
+class verilog_chunk_parser
+{
+public:
+  explicit verilog_chunk_parser( verilog_chunk& chunk )
+      : _chunk( chunk ),
+        _pos( chunk.begin ),
+        _end( chunk.end )
+  {
+  }
+
+  void run()
+  {
+    std::string_view t;
+    while ( next( t ) )
+    {
+      bool ok = true;
+      if ( t == "module" || t == "wire" )
+      {
+        ok = skip_statement();
+      }
+      else if ( t == "input" || t == "output" )
+      {
+        ok = parse_declaration( t == "input" ? verilog_statement::input : verilog_statement::output );
+      }
+      else if ( t == "assign" )
+      {
+        ok = parse_assign();
+      }
+      else if ( t == "endmodule" )
+      {
+        _chunk.statements.push_back( {verilog_statement::end_module, 0u, 0u, 0u} );
+        return;
+      }
+      else if ( t == "and" || t == "nand" || t == "or" || t == "nor" || t == "xor" || t == "xnor" || t == "not" || t == "buf" )
+      {
+        ok = parse_primitive( t );
+      }
+      else
+      {
+        ok = fail( "unsupported statement `" + std::string( t ) + "`" );
+      }
+
+      if ( !ok )
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  static bool is_name_char( char c )
+  {
+    return std::isalnum( static_cast<unsigned char>( c ) ) || c == '_' || c == '$' || c == '\'' || c == '[' || c == ']' || c == ':';
+  }
+
+  bool next( std::string_view& token )
+  {
+    while ( _pos != _end )
+    {
+      const auto c = *_pos;
+      if ( std::isspace( static_cast<unsigned char>( c ) ) )
+      {
+        ++_pos;
+      }
+      else if ( c == '/' && _pos + 1 != _end && _pos[1] == '/' )
+      {
+        while ( _pos != _end && *_pos != '\n' )
+          ++_pos;
+      }
+      else if ( c == '/' && _pos + 1 != _end && _pos[1] == '*' )
+      {
+        _pos += 2;
+        while ( _pos != _end && !( *_pos == '*' && _pos + 1 != _end && _pos[1] == '/' ) )
+          ++_pos;
+        _pos = _pos == _end ? _end : _pos + 2;
+      }
+      else
+      {
+        const auto* first = _pos++;
+        if ( c == '\\' )
+        {
+          while ( _pos != _end && !std::isspace( static_cast<unsigned char>( *_pos ) ) )
+            ++_pos;
+        }
+        else if ( is_name_char( c ) )
+        {
+          while ( _pos != _end && is_name_char( *_pos ) )
+            ++_pos;
+        }
+        token = std::string_view( first, _pos - first );
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool expect( char c )
+  {
+    std::string_view t;
+    if ( !next( t ) || t.size() != 1u || t[0] != c )
+    {
+      return fail( std::string( "expected `" ) + c + "`" );
+    }
+    return true;
+  }
+
+  bool skip_statement()
+  {
+    std::string_view t;
+    while ( next( t ) )
+    {
+      if ( t == ";" )
+      {
+        return true;
+      }
+    }
+    return fail( "missing `;`" );
+  }
+
+  bool parse_declaration( verilog_statement::kind_t kind )
+  {
+    std::string_view t;
+    if ( !next( t ) )
+    {
+      return fail( "incomplete declaration" );
+    }
+
+    /* vector declarations such as [7:0] are split into bits */
+    uint32_t width{0u};
+    if ( t.front() == '[' )
+    {
+      const auto colon = t.find( ':' );
+      if ( t.back() != ']' || colon == std::string_view::npos || t.substr( colon + 1, t.size() - colon - 2 ) != "0" )
+      {
+        return fail( "unsupported range `" + std::string( t ) + "`" );
+      }
+      /* runs in a worker thread, so parse without exceptions */
+      const auto msb = t.substr( 1, colon - 1 );
+      const auto [end, ec] = std::from_chars( msb.data(), msb.data() + msb.size(), width );
+      if ( ec != std::errc() || end != msb.data() + msb.size() || width == std::numeric_limits<uint32_t>::max() )
+      {
+        return fail( "invalid range `" + std::string( t ) + "`" );
+      }
+      ++width;
+      if ( !next( t ) )
+      {
+        return fail( "incomplete declaration" );
+      }
+    }
+
+    while ( true )
+    {
+      if ( width == 0u )
+      {
+        _chunk.statements.push_back( {kind, _chunk.names[t], 0u, 0u} );
+      }
+      for ( auto i = 0u; i < width; ++i )
+      {
+        auto const& name = _chunk.bit_names.emplace_back( std::string( t ) + "[" + std::to_string( i ) + "]" );
+        _chunk.statements.push_back( {kind, _chunk.names[name], 0u, 0u} );
+      }
+
+      if ( !next( t ) || ( t != "," && t != ";" ) )
+      {
+        return fail( "expected `,` or `;` in declaration" );
+      }
+      if ( t == ";" )
+      {
+        return true;
+      }
+      if ( !next( t ) )
+      {
+        return fail( "incomplete declaration" );
+      }
+    }
+  }
+
+  bool parse_assign()
+  {
+    std::string_view lhs, t;
+    if ( !next( lhs ) || !expect( '=' ) )
+    {
+      return fail( "invalid assignment" );
+    }
+
+    const auto begin = static_cast<uint32_t>( _chunk.code.size() );
+    if ( !parse_or( t ) )
+    {
+      return false;
+    }
+    _chunk.statements.push_back( {verilog_statement::assign, _chunk.names[lhs], begin, static_cast<uint32_t>( _chunk.code.size() )} );
+
+    if ( t == "," )
+    {
+      return parse_assign();
+    }
+    return t == ";" || fail( "expected `;` after assignment to `" + std::string( lhs ) + "`" );
+  }
+
+  /* gate primitives such as `and g1 ( y, a, b );` */
+  bool parse_primitive( std::string_view type )
+  {
+    std::string_view t;
+    if ( !next( t ) )
+    {
+      return fail( "incomplete gate" );
+    }
+    if ( t != "(" && !next( t ) )
+    {
+      return fail( "incomplete gate" );
+    }
+    if ( t != "(" )
+    {
+      return fail( "expected `(` in gate" );
+    }
+
+    std::string_view lhs;
+    if ( !next( lhs ) || !expect( ',' ) )
+    {
+      return fail( "invalid gate" );
+    }
+
+    const auto inverted = type == "nand" || type == "nor" || type == "xnor" || type == "not";
+    const auto op = ( type == "and" || type == "nand" ) ? verilog_op_and : ( ( type == "or" || type == "nor" ) ? verilog_op_or : verilog_op_xor );
+    const auto begin = static_cast<uint32_t>( _chunk.code.size() );
+    auto num_inputs = 0u;
+    while ( true )
+    {
+      if ( !parse_or( t ) )
+      {
+        return false;
+      }
+      if ( num_inputs++ > 0u )
+      {
+        _chunk.code.push_back( op );
+      }
+      if ( t != "," && t != ")" )
+      {
+        return fail( "expected `,` or `)` in gate" );
+      }
+      if ( t == ")" )
+      {
+        break;
+      }
+    }
+
+    if ( ( type == "not" || type == "buf" ) != ( num_inputs == 1u ) )
+    {
+      return fail( "wrong number of inputs for `" + std::string( type ) + "`" );
+    }
+    if ( inverted )
+    {
+      complement( begin );
+    }
+    _chunk.statements.push_back( {verilog_statement::assign, _chunk.names[lhs], begin, static_cast<uint32_t>( _chunk.code.size() )} );
+    return expect( ';' );
+  }
+
+  /* expressions with precedence ~, &, ^, |; `t` holds the token after the expression */
+  bool parse_or( std::string_view& t )
+  {
+    if ( !parse_xor( t ) )
+      return false;
+    while ( t == "|" )
+    {
+      if ( !parse_xor( t ) )
+        return false;
+      _chunk.code.push_back( verilog_op_or );
+    }
+    return true;
+  }
+
+  bool parse_xor( std::string_view& t )
+  {
+    if ( !parse_and( t ) )
+      return false;
+    while ( t == "^" )
+    {
+      if ( !parse_and( t ) )
+        return false;
+      _chunk.code.push_back( verilog_op_xor );
+    }
+    return true;
+  }
+
+  bool parse_and( std::string_view& t )
+  {
+    if ( !parse_unary( t ) || !next( t ) )
+      return fail( "incomplete expression" );
+    while ( t == "&" )
+    {
+      if ( !parse_unary( t ) || !next( t ) )
+        return fail( "incomplete expression" );
+      _chunk.code.push_back( verilog_op_and );
+    }
+    return true;
+  }
+
+  bool parse_unary( std::string_view& t )
+  {
+    if ( !next( t ) )
+    {
+      return fail( "incomplete expression" );
+    }
+
+    if ( t == "~" )
+    {
+      const auto begin = static_cast<uint32_t>( _chunk.code.size() );
+      if ( !parse_unary( t ) )
+        return false;
+      complement( begin );
+    }
+    else if ( t == "(" )
+    {
+      if ( !parse_or( t ) )
+        return false;
+      if ( t != ")" )
+        return fail( "expected `)`" );
+    }
+    else if ( t == "1'b0" || t == "0" )
+    {
+      _chunk.code.push_back( verilog_op_const0 );
+    }
+    else if ( t == "1'b1" || t == "1" )
+    {
+      _chunk.code.push_back( verilog_op_const1 );
+    }
+    else if ( t.size() == 1u && !is_name_char( t[0] ) && t[0] != '\\' )
+    {
+      return fail( "unexpected `" + std::string( t ) + "` in expression" );
+    }
+    else
+    {
+      _chunk.code.push_back( 2u * _chunk.names[t] );
+    }
+    return true;
+  }
+
+  /* complements the program starting at `begin` */
+  void complement( uint32_t begin )
+  {
+    auto& last = _chunk.code.back();
+    if ( _chunk.code.size() == begin + 1u && last < verilog_op_not )
+    {
+      last ^= 1u;
+    }
+    else if ( _chunk.code.size() == begin + 1u && ( last == verilog_op_const0 || last == verilog_op_const1 ) )
+    {
+      last = last == verilog_op_const0 ? verilog_op_const1 : verilog_op_const0;
+    }
+    else
+    {
+      _chunk.code.push_back( verilog_op_not );
+    }
+  }
+
+  bool fail( std::string const& message )
+  {
+    if ( _chunk.error.empty() )
+    {
+      _chunk.error = message;
+    }
+    return false;
+  }
+
+private:
+  verilog_chunk& _chunk;
+  char const* _pos;
+  char const* _end;
+};
+
+template<class Ntk>
+class verilog_fast_parser
+{
+public:
+  verilog_fast_parser( Ntk& ntk, lorina::diagnostic_engine* diag, uint32_t num_threads )
+      : _ntk( ntk ),
+        _diag( diag ),
+        _num_threads( num_threads == 0u ? std::max( 1u, std::thread::hardware_concurrency() ) : num_threads )
+  {
+  }
+
+  lorina::return_code run( char const* begin, char const* end )
+  {
+    /* tokenize chunks in parallel */
+    const auto num_chunks = _num_threads == 1u ? 1u : static_cast<uint32_t>( std::clamp<uint64_t>( ( end - begin ) >> 16, 1u, 4u * _num_threads ) );
+    const auto bounds = split_verilog( begin, end, num_chunks );
+    _chunks.resize( bounds.size() - 1u );
+    verilog_parallel_for( static_cast<uint32_t>( _chunks.size() ), _num_threads, [&]( auto i ) {
+      _chunks[i].begin = bounds[i];
+      _chunks[i].end = bounds[i + 1];
+      verilog_chunk_parser( _chunks[i] ).run();
+    } );
+
+    resolve_names();
+
+    /* declare inputs, outputs, and assignments in order */
+    for ( auto& chunk : _chunks )
+    {
+      for ( auto i = 0u; i < chunk.statements.size(); ++i )
+      {
+        auto const& st = chunk.statements[i];
+        const auto g = chunk.global[st.lhs];
+        switch ( st.kind )
+        {
+        case verilog_statement::input:
+          if ( _state[g] != undefined )
+          {
+            return error( "signal `" + std::string( chunk.names.name( st.lhs ) ) + "` is defined twice" );
+          }
+          _signals[g] = _ntk.create_pi( std::string( chunk.names.name( st.lhs ) ) );
+          _state[g] = defined;
+          break;
+        case verilog_statement::output:
+          _outputs.emplace_back( g, std::string( chunk.names.name( st.lhs ) ) );
+          break;
+        case verilog_statement::assign:
+          if ( _state[g] != undefined )
+          {
+            return error( "signal `" + std::string( chunk.names.name( st.lhs ) ) + "` is defined twice" );
+          }
+          _state[g] = deferred;
+          _definition[g] = &st;
+          _code[g] = &chunk.code;
+          _assigns.push_back( g );
+          break;
+        case verilog_statement::end_module:
+          return finish();
+        }
+      }
+      if ( !chunk.error.empty() )
+      {
+        return error( chunk.error );
+      }
+    }
+    return error( "missing `endmodule`" );
+  }
+
+private:
+  enum state : uint8_t
+  {
+    undefined,
+    deferred,
+    visiting,
+    defined
+  };
+
+  /* assigns global ids to the chunk-local names; names are partitioned by
+     their hash value into shards that are processed in parallel, there are
+     no more shards than chunks such that small files are resolved serially */
+  void resolve_names()
+  {
+    const auto num_shards = std::min( _num_threads, static_cast<uint32_t>( _chunks.size() ) );
+    const auto shard_of = [&]( uint64_t h ) { return static_cast<uint32_t>( ( h >> 40 ) % num_shards ); };
+
+    for ( auto& chunk : _chunks )
+    {
+      chunk.global.resize( chunk.names.size() );
+    }
+
+    _shards.resize( num_shards );
+    verilog_parallel_for( num_shards, _num_threads, [&]( auto k ) {
+      for ( auto& chunk : _chunks )
+      {
+        for ( auto i = 0u; i < chunk.names.size(); ++i )
+        {
+          if ( const auto h = chunk.names.hash_of( i ); shard_of( h ) == k )
+          {
+            chunk.global[i] = _shards[k].insert( chunk.names.name( i ), h );
+          }
+        }
+      }
+    } );
+
+    _offsets.assign( num_shards + 1u, 0u );
+    for ( auto k = 0u; k < num_shards; ++k )
+    {
+      _offsets[k + 1] = _offsets[k] + _shards[k].size();
+    }
+
+    verilog_parallel_for( static_cast<uint32_t>( _chunks.size() ), _num_threads, [&]( auto c ) {
+      auto& chunk = _chunks[c];
+      for ( auto i = 0u; i < chunk.names.size(); ++i )
+      {
+        chunk.global[i] += _offsets[shard_of( chunk.names.hash_of( i ) )];
+      }
+      for ( auto& entry : chunk.code )
+      {
+        if ( entry < verilog_op_not )
+        {
+          entry = ( chunk.global[entry >> 1] << 1 ) | ( entry & 1u );
+        }
+      }
+    } );
+
+    const auto num_names = _offsets.back();
+    _state.assign( num_names, undefined );
+    _signals.resize( num_names );
+    _definition.resize( num_names );
+    _code.resize( num_names );
+  }
+
+  std::string_view name( uint32_t g ) const
+  {
+    const auto k = std::upper_bound( _offsets.begin(), _offsets.end(), g ) - _offsets.begin() - 1;
+    return _shards[k].name( g - _offsets[k] );
+  }
+
+  lorina::return_code finish()
+  {
+    for ( auto g : _assigns )
+    {
+      if ( !create_deferred( g ) )
+      {
+        return lorina::return_code::parse_error;
+      }
+    }
+
+    for ( auto const& [g, o] : _outputs )
+    {
+      if ( _state[g] != defined )
+      {
+        return error( "output `" + o + "` is not defined" );
+      }
+    }
+    for ( auto const& [g, o] : _outputs )
+    {
+      _ntk.create_po( _signals[g], o );
+    }
+    return lorina::return_code::success;
+  }
+
+  /* creates a gate after its transitive fanin */
+  bool create_deferred( uint32_t root )
+  {
+    if ( _state[root] != deferred )
+    {
+      return true;
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> stack{{root, _definition[root]->code_begin}};
+    _state[root] = visiting;
+    while ( !stack.empty() )
+    {
+      auto& [g, next] = stack.back();
+      auto const& st = *_definition[g];
+      auto const& code = *_code[g];
+      if ( next < st.code_end )
+      {
+        const auto entry = code[next++];
+        if ( entry >= verilog_op_not )
+        {
+          continue;
+        }
+        const auto fanin = entry >> 1;
+        switch ( _state[fanin] )
+        {
+        case defined:
+          break;
+        case deferred:
+          _state[fanin] = visiting;
+          stack.emplace_back( fanin, _definition[fanin]->code_begin );
+          break;
+        case visiting:
+          error( "combinational cycle at `" + std::string( name( fanin ) ) + "`" );
+          return false;
+        default:
+          error( "signal `" + std::string( name( fanin ) ) + "` is not defined" );
+          return false;
+        }
+        continue;
+      }
+
+      _signals[g] = evaluate( code.data() + st.code_begin, code.data() + st.code_end );
+      _state[g] = defined;
+      stack.pop_back();
+    }
+    return true;
+  }
+
+  signal<Ntk> operand( uint32_t entry )
+  {
+    if ( entry == verilog_op_const0 || entry == verilog_op_const1 )
+    {
+      return _ntk.get_constant( entry == verilog_op_const1 );
+    }
+    const auto& f = _signals[entry >> 1];
+    return ( entry & 1u ) ? _ntk.create_not( f ) : f;
+  }
+
+  signal<Ntk> evaluate( uint32_t const* begin, uint32_t const* end )
+  {
+    const auto size = end - begin;
+    const auto is_operand = [&]( auto i ) { return begin[i] < verilog_op_not; };
+
+    /* ( a & b ) | ( a & c ) | ( b & c ) */
+    if ( size == 11 && begin[2] == verilog_op_and && begin[5] == verilog_op_and && begin[6] == verilog_op_or &&
+         begin[9] == verilog_op_and && begin[10] == verilog_op_or &&
+         is_operand( 0 ) && is_operand( 1 ) && is_operand( 4 ) &&
+         begin[0] == begin[3] && begin[1] == begin[7] && begin[4] == begin[8] )
+    {
+      return _ntk.create_maj( operand( begin[0] ), operand( begin[1] ), operand( begin[4] ) );
+    }
+
+    if constexpr ( has_create_xor3_v<Ntk> )
+    {
+      if ( size == 5 && begin[2] == verilog_op_xor && begin[4] == verilog_op_xor && is_operand( 0 ) && is_operand( 1 ) && is_operand( 3 ) )
+      {
+        return _ntk.create_xor3( operand( begin[0] ), operand( begin[1] ), operand( begin[3] ) );
+      }
+    }
+
+    _stack.clear();
+    for ( auto it = begin; it != end; ++it )
+    {
+      switch ( *it )
+      {
+      case verilog_op_not:
+        _stack.back() = _ntk.create_not( _stack.back() );
+        break;
+      case verilog_op_and:
+      case verilog_op_or:
+      case verilog_op_xor:
+      {
+        const auto b = _stack.back();
+        _stack.pop_back();
+        const auto a = _stack.back();
+        _stack.back() = *it == verilog_op_and ? _ntk.create_and( a, b ) : ( *it == verilog_op_or ? _ntk.create_or( a, b ) : _ntk.create_xor( a, b ) );
+      }
+      break;
+      default:
+        _stack.push_back( operand( *it ) );
+        break;
+      }
+    }
+    return _stack.back();
+  }
+
+  lorina::return_code error( std::string const& message )
+  {
+    if ( _diag )
+    {
+      _diag->report( lorina::diagnostic_level::fatal, message );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+private:
+  Ntk& _ntk;
+  lorina::diagnostic_engine* _diag;
+  uint32_t _num_threads;
+
+  std::vector<verilog_chunk> _chunks;
+  std::vector<name_interner> _shards;
+  std::vector<uint32_t> _offsets;
+
+  std::vector<uint8_t> _state;
+  std::vector<signal<Ntk>> _signals;
+  std::vector<verilog_statement const*> _definition;
+  std::vector<std::vector<uint32_t> const*> _code;
+  std::vector<uint32_t> _assigns;
+  std::vector<std::pair<uint32_t, std::string>> _outputs;
+  std::vector<signal<Ntk>> _stack;
+};
+
+} // namespace detail
+
+/*! \brief Reads a Verilog netlist from a memory buffer into a network.
+ *
+ * This is a fast alternative to `lorina::read_verilog` with
+ * `verilog_reader` for large flattened netlists.  The text is split into
+ * chunks at statement boundaries, which are tokenized in parallel into
+ * small expression programs.  Signal names are then resolved into global
+ * ids in parallel, partitioned by their hash values, and finally the
+ * network is built in one pass in topological order.
+ *
+ * Only the first module is read.  Supported statements are `input` and
+ * `output` declarations (also with ranges `[n:0]`), `wire` declarations,
+ * continuous assignments with expressions over `~`, `&`, `^`, `|`, and
+ * parentheses, and the gate primitives `and`, `nand`, `or`, `nor`, `xor`,
+ * `xnor`, `not`, and `buf`.  Assignments of the form `(a & b) | (a & c) |
+ * (b & c)` are created as majority gates, and three-input XORs are
+ * created with `create_xor3` if the network provides it.
+ *
+ * **Required network functions:**
+ * - `create_pi`
+ * - `create_po`
+ * - `get_constant`
+ * - `create_not`
+ * - `create_and`
+ * - `create_or`
+ * - `create_xor`
+ * - `create_maj`
+ *
+ * \param data Pointer to the Verilog contents
+ * \param size Size of the Verilog contents
+ * \param ntk Network
+ * \param diag Optional diagnostic engine for parse errors
+ * \param num_threads Number of threads, 0 uses all available cores
+ */
+template<typename Ntk>
+lorina::return_code read_verilog_fast( char const* data, std::size_t size, Ntk& ntk, lorina::diagnostic_engine* diag = nullptr, uint32_t num_threads = 0u )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_create_pi_v<Ntk>, "Ntk does not implement the create_pi function" );
+  static_assert( has_create_po_v<Ntk>, "Ntk does not implement the create_po function" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant function" );
+  static_assert( has_create_not_v<Ntk>, "Ntk does not implement the create_not function" );
+  static_assert( has_create_and_v<Ntk>, "Ntk does not implement the create_and function" );
+  static_assert( has_create_or_v<Ntk>, "Ntk does not implement the create_or function" );
+  static_assert( has_create_xor_v<Ntk>, "Ntk does not implement the create_xor function" );
+  static_assert( has_create_maj_v<Ntk>, "Ntk does not implement the create_maj function" );
+
+  detail::verilog_fast_parser<Ntk> parser( ntk, diag, num_threads );
+  return parser.run( data, data + size );
+}
+
+/*! \brief Reads a Verilog file into a network.
+ *
+ * The file is mapped into memory and parsed with `read_verilog_fast`.
+ *
+   \verbatim embed:rst
+   Example
+   .. code-block:: c++
+      aig_network aig;
+      read_verilog_fast( "netlist.v", aig );
+   \endverbatim
+ *
+ * \param filename Filename
+ * \param ntk Network
+ * \param diag Optional diagnostic engine for parse errors
+ * \param num_threads Number of threads, 0 uses all available cores
+ */
+template<typename Ntk>
+lorina::return_code read_verilog_fast( std::string const& filename, Ntk& ntk, lorina::diagnostic_engine* diag = nullptr, uint32_t num_threads = 0u )
+{
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::fatal, "could not open file `" + filename + "`" );
+    }
+    return lorina::return_code::parse_error;
+  }
+  return read_verilog_fast( file.data(), file.size(), ntk, diag, num_threads );
+}
+
 } /* namespace mockturtle */
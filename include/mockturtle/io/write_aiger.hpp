@@ -0,0 +1,290 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file write_aiger.hpp
+  \brief Write networks to binary AIGER format
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../algorithms/cleanup.hpp"
+#include "../networks/aig.hpp"
+#include "../traits.hpp"
+#include "../utils/node_map.hpp"
+#include "../utils/output_buffer.hpp"
+#include "../views/topo_view.hpp"
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+inline void write_aiger_delta( output_buffer& out, uint32_t delta )
+{
+  while ( delta & ~0x7fu )
+  {
+    out << static_cast<char>( ( delta & 0x7fu ) | 0x80u );
+    delta >>= 7;
+  }
+  out << static_cast<char>( delta );
+}
+
+/* writes `aig` whose gates must all be AND gates, names are taken from `ntk`
+   which has the same PIs, POs, and registers */
+template<class Aig, class Ntk>
+void write_aiger_impl( Aig const& aig, Ntk const& ntk, output_buffer& out )
+{
+  topo_view topo{aig};
+
+  /* variable 0 is the constant, then PIs, then register outputs, then AND gates */
+  node_map<uint32_t, Aig> var( aig, 0u );
+  uint32_t num_vars{0u};
+  aig.foreach_ci( [&]( auto const& n ) {
+    var[n] = ++num_vars;
+  } );
+
+  std::vector<node<Aig>> gates;
+  gates.reserve( aig.num_gates() );
+  topo.foreach_gate( [&]( auto const& n ) {
+    assert( aig.is_and( n ) && aig.fanin_size( n ) == 2u );
+    var[n] = ++num_vars;
+    gates.push_back( n );
+  } );
+
+  const auto lit = [&]( signal<Aig> const& f ) {
+    return 2u * var[aig.get_node( f )] + ( aig.is_complemented( f ) ? 1u : 0u );
+  };
+
+  const auto num_latches = aig.num_cis() - aig.num_pis();
+
+  /* header */
+  out << "aig " << num_vars << ' ' << aig.num_pis() << ' ' << num_latches << ' ' << aig.num_pos() << ' ' << gates.size() << '\n';
+
+  /* latches with next state literal and initial value, unknown initial
+     values are written as the latch literal itself */
+  aig.foreach_ri( [&]( auto const& f, auto i ) {
+    out << lit( f ) << ' ';
+    switch ( aig.latch_reset( i ) )
+    {
+    case 0:
+      out << '0';
+      break;
+    case 1:
+      out << '1';
+      break;
+    default:
+      out << 2u * ( aig.num_pis() + i + 1u );
+      break;
+    }
+    out << '\n';
+  } );
+
+  aig.foreach_po( [&]( auto const& f ) {
+    out << lit( f ) << '\n';
+  } );
+
+  /* delta-encoded AND gates */
+  for ( auto const& n : gates )
+  {
+    uint32_t lits[2] = {0u, 0u};
+    aig.foreach_fanin( n, [&]( auto const& f, auto i ) {
+      lits[i] = lit( f );
+    } );
+    if ( lits[0] < lits[1] )
+    {
+      std::swap( lits[0], lits[1] );
+    }
+
+    const auto lhs = 2u * var[n];
+    detail::write_aiger_delta( out, lhs - lits[0] );
+    detail::write_aiger_delta( out, lits[0] - lits[1] );
+  }
+
+  /* symbol table */
+  if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
+  {
+    ntk.foreach_pi( [&]( auto const& n, auto i ) {
+      if ( const auto s = ntk.make_signal( n ); ntk.has_name( s ) )
+      {
+        out << 'i' << i << ' ' << ntk.get_name( s ) << '\n';
+      }
+    } );
+    if constexpr ( has_foreach_ro_v<Ntk> )
+    {
+      ntk.foreach_ro( [&]( auto const& n, auto i ) {
+        if ( const auto s = ntk.make_signal( n ); ntk.has_name( s ) )
+        {
+          out << 'l' << i << ' ' << ntk.get_name( s ) << '\n';
+        }
+      } );
+    }
+  }
+  if constexpr ( has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
+  {
+    for ( auto i = 0u; i < ntk.num_pos(); ++i )
+    {
+      if ( ntk.has_output_name( i ) )
+      {
+        out << 'o' << i << ' ' << ntk.get_output_name( i ) << '\n';
+      }
+    }
+  }
+}
+
+template<class Ntk>
+void write_aiger( Ntk const& ntk, output_buffer& out )
+{
+  if constexpr ( std::is_same_v<typename Ntk::base_type, aig_network> )
+  {
+    write_aiger_impl( ntk, ntk, out );
+  }
+  else
+  {
+    /* convert the network into an AIG, PIs and POs keep their order */
+    assert( ntk.is_combinational() && "only combinational networks of other types can be written" );
+
+    aig_network aig;
+    std::vector<aig_network::signal> pis;
+    ntk.foreach_pi( [&]( auto const& ) {
+      pis.push_back( aig.create_pi() );
+    } );
+    for ( auto const& f : cleanup_dangling( ntk, aig, pis.begin(), pis.end() ) )
+    {
+      aig.create_po( f );
+    }
+    write_aiger_impl( aig, ntk, out );
+  }
+}
+
+} // namespace detail
+
+/*! \brief Writes network in binary AIGER format into output stream
+ *
+ * AND gates are written in topological order with delta-encoded fanin
+ * literals.  Registers are written as latches with their reset values, and
+ * if the network provides names (e.g., via `names_view`) they are written
+ * into the symbol table.
+ *
+ * Networks which are not based on `aig_network` are converted into an AIG
+ * before writing; this is only supported for combinational networks.
+ *
+ * An overloaded variant exists that writes the network into a file and
+ * another one that writes the network into a memory buffer.
+ *
+ * **Required network functions:**
+ * - `foreach_pi`
+ * - `foreach_po`
+ * - `foreach_fanin`
+ * - `get_node`
+ * - `is_complemented`
+ * - `num_pis`
+ * - `num_pos`
+ *
+ * \param ntk Network
+ * \param os Output stream
+ */
+template<class Ntk>
+void write_aiger( Ntk const& ntk, std::ostream& os )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi method" );
+  static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+  static_assert( has_num_pis_v<Ntk>, "Ntk does not implement the num_pis method" );
+  static_assert( has_num_pos_v<Ntk>, "Ntk does not implement the num_pos method" );
+
+  output_buffer out( os );
+  detail::write_aiger( ntk, out );
+  out.flush();
+}
+
+/*! \brief Writes network in binary AIGER format into a file
+ *
+ * **Required network functions:**
+ * - `foreach_pi`
+ * - `foreach_po`
+ * - `foreach_fanin`
+ * - `get_node`
+ * - `is_complemented`
+ * - `num_pis`
+ * - `num_pos`
+ *
+ * \param ntk Network
+ * \param filename Filename
+ */
+template<class Ntk>
+void write_aiger( Ntk const& ntk, std::string const& filename )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  write_aiger( ntk, os );
+  os.close();
+}
+
+/*! \brief Writes network in binary AIGER format into a memory buffer
+ *
+ * The AIGER data is appended to `buffer`, which allows to keep cheap
+ * checkpoints of a network in memory.  It can be read back with
+ * `lorina::read_aiger` from a stream over the buffer.
+ *
+ * **Required network functions:**
+ * - `foreach_pi`
+ * - `foreach_po`
+ * - `foreach_fanin`
+ * - `get_node`
+ * - `is_complemented`
+ * - `num_pis`
+ * - `num_pos`
+ *
+ * \param ntk Network
+ * \param buffer Memory buffer
+ */
+template<class Ntk>
+void write_aiger( Ntk const& ntk, std::vector<char>& buffer )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi method" );
+  static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+  static_assert( has_num_pis_v<Ntk>, "Ntk does not implement the num_pis method" );
+  static_assert( has_num_pos_v<Ntk>, "Ntk does not implement the num_pos method" );
+
+  output_buffer out( buffer );
+  detail::write_aiger( ntk, out );
+}
+
+} /* namespace mockturtle */
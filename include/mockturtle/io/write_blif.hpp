@@ -33,12 +33,12 @@
 #pragma once
 
 #include "../traits.hpp"
+#include "../utils/output_buffer.hpp"
 #include "../views/topo_view.hpp"
 
 #include <kitty/constructors.hpp>
 #include <kitty/isop.hpp>
 #include <kitty/operations.hpp>
-#include <kitty/print.hpp>
 
 #include <fmt/format.h>
 
@@ -91,200 +91,191 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
   static_assert( has_node_function_v<Ntk>, "Ntk does not implement the node_function method" );
 
   topo_view topo_ntk{ntk};
+  output_buffer out( os );
+
+  constexpr auto has_names = has_has_name_v<Ntk> && has_get_name_v<Ntk>;
+
+  /* names are written on demand, default names are derived from node indexes */
+  const auto write_name = [&]( node<Ntk> const& n, char const* prefix ) {
+    if constexpr ( has_names )
+    {
+      auto const s = topo_ntk.make_signal( n );
+      if ( topo_ntk.has_name( s ) )
+      {
+        out << topo_ntk.get_name( s );
+        return;
+      }
+    }
+    out << prefix << topo_ntk.node_to_index( n );
+  };
+  const auto write_fanin_name = [&]( node<Ntk> const& n ) {
+    write_name( n, topo_ntk.is_pi( n ) ? "pi" : "new_n" );
+  };
+  const auto write_output_name = [&]( uint32_t index, char const* prefix, uint64_t default_index ) {
+    if constexpr ( has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
+    {
+      if ( topo_ntk.has_output_name( index ) )
+      {
+        out << topo_ntk.get_output_name( index );
+        return;
+      }
+    }
+    out << prefix << default_index;
+  };
 
   /* write model */
-  os << ".model top\n";
+  out << ".model top\n";
 
   /* write inputs */
   if ( topo_ntk.num_pis() > 0u )
   {
-    os << ".inputs ";
-    topo_ntk.foreach_ci( [&]( auto const& n, auto index ) 
-    {
-      if ( ( ( index + 1 ) <= topo_ntk.num_cis() - topo_ntk.num_latches() ) ) 
+    out << ".inputs ";
+    topo_ntk.foreach_ci( [&]( auto const& n, auto index ) {
+      if ( ( index + 1 ) <= topo_ntk.num_cis() - topo_ntk.num_latches() )
       {
-        if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
-        {
-          signal<Ntk> const s = topo_ntk.make_signal( topo_ntk.node_to_index( n ) );
-          std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "pi{}", topo_ntk.get_node( s ) );
-          os << name << ' ';
-        }
-        else
-        {
-          os << fmt::format( "pi{} ", topo_ntk.node_to_index( n ) );
-        }
+        write_name( n, "pi" );
+        out << ' ';
       }
     } );
-    os << "\n";
+    out << '\n';
   }
 
   /* write outputs */
   if ( topo_ntk.num_pos() > 0u )
   {
-    os << ".outputs ";
-    topo_ntk.foreach_co( [&]( auto const& f, auto index ) 
-    {
+    out << ".outputs ";
+    topo_ntk.foreach_co( [&]( auto const& f, auto index ) {
       (void)f;
-      if( index < topo_ntk.num_cos() - topo_ntk.num_latches() ) 
+      if ( index < topo_ntk.num_cos() - topo_ntk.num_latches() )
       {
-        if constexpr ( has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
-        {
-          std::string const output_name = topo_ntk.has_output_name( index ) ? topo_ntk.get_output_name( index ) : fmt::format( "po{}", index );
-          os << output_name << ' ';
-        }
-        else
-        {
-          os << fmt::format( "po{} ", index );
-        }
+        write_output_name( index, "po", index );
+        out << ' ';
       }
     } );
-    os << "\n";
+    out << '\n';
   }
 
   if ( topo_ntk.num_latches() > 0u )
   {
-    auto latch_idx = 0;
-    topo_ntk.foreach_co( [&]( auto const& f, auto index ) 
-    {
-      if( index >= topo_ntk.num_cos() - topo_ntk.num_latches() ) 
+    auto latch_idx = 0u;
+    topo_ntk.foreach_co( [&]( auto const& f, auto index ) {
+      if ( index >= topo_ntk.num_cos() - topo_ntk.num_latches() )
       {
-        os << ".latch ";
-        auto const ro_sig = topo_ntk.make_signal( topo_ntk.ri_to_ro( f ) );
-        mockturtle::latch_info l_info = topo_ntk._storage->latch_information[topo_ntk.get_node(ro_sig)];
-        if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
+        out << ".latch ";
+        auto const ro = topo_ntk.ri_to_ro( f );
+        auto const& l_info = topo_ntk._storage->latch_information[ro];
+        if constexpr ( has_names )
         {
-          std::string const ri_name = topo_ntk.has_output_name( index ) ? topo_ntk.get_output_name( index ) : fmt::format( "new_n{}", topo_ntk.get_node( f ) );
-          std::string const ro_name = topo_ntk.has_name( ro_sig ) ? topo_ntk.get_name( ro_sig ) : fmt::format( "new_n{}", topo_ntk.get_node( ro_sig ) );
-          os << fmt::format( "{} {} {} {} {}\n", ri_name, ro_name, l_info.type, l_info.control, l_info.init);
+          write_output_name( index, "new_n", topo_ntk.get_node( f ) );
+          out << ' ';
+          write_name( ro, "new_n" );
         }
         else
         {
-          os << fmt::format( "li{} new_n{} {} {} {}\n", latch_idx, topo_ntk.get_node( ro_sig ), l_info.type, l_info.control, l_info.init );
-          latch_idx++;
+          out << "li" << latch_idx++ << " new_n" << ro;
         }
+        out << ' ' << l_info.type << ' ' << l_info.control << ' ' << l_info.init << '\n';
       }
     } );
   }
 
   /* write constants */
-  os << ".names new_n0\n";
-  os << "0\n";
+  out << ".names new_n0\n";
+  out << "0\n";
 
-  if ( topo_ntk.get_constant( false ) != topo_ntk.get_constant( true ) ) 
+  if ( topo_ntk.get_constant( false ) != topo_ntk.get_constant( true ) )
   {
-    os << ".names new_n1\n";
-    os << "1\n";
+    out << ".names new_n1\n";
+    out << "1\n";
   }
 
   /* write nodes */
-  topo_ntk.foreach_node( [&]( auto const& n ) 
-  {
-
+  topo_ntk.foreach_node( [&]( auto const& n ) {
     if ( topo_ntk.is_constant( n ) || topo_ntk.is_ci( n ) )
       return; /* continue */
 
     /* write truth table of node */
-    auto func = topo_ntk.node_function( n );
+    auto const cubes = isop( topo_ntk.node_function( n ) );
 
-    if(isop( func ).size() == 0) 
+    out << ".names ";
+    if ( !cubes.empty() )
     {
-      if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
-      {
-        auto const s = topo_ntk.make_signal( n );
-        std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "new_n{}", topo_ntk.get_node( s ) );
-        os << fmt::format( ".names {}\n", name );
-        os << "0" << '\n';
-      }
-      else
-      {
-        os << fmt::format( ".names new_n{}\n", n );
-        os << "0" << '\n';
-      }
-      return;
+      /* write fanins of node */
+      topo_ntk.foreach_fanin( n, [&]( auto const& f ) {
+        write_fanin_name( topo_ntk.get_node( f ) );
+        out << ' ';
+      } );
     }
 
-    os << fmt::format( ".names " );
-
-    /* write fanins of node */
-    topo_ntk.foreach_fanin( n, [&]( auto const& f ) 
-    {
-      auto f_node = topo_ntk.get_node( f );
-      if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
-      {
-        signal<Ntk> const s = topo_ntk.make_signal( f_node );
-        std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : topo_ntk.is_pi( f_node ) ? fmt::format( "pi{} ", f_node ) : fmt::format( "new_n{} ", f_node );
-        os << name << ' ';
-      }
-      else
-      {
-        std::string const name = topo_ntk.is_pi( f_node ) ? fmt::format( "pi{} ", f_node ) : fmt::format( "new_n{} ", f_node );
-        os << name;
-      }
-    });
-
     /* write fanout of node */
-    if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
-    {
-      auto const s = topo_ntk.make_signal( n );
-      std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "new_n{}", topo_ntk.get_node( s ) );
-      os << name << '\n';
-    }
-    else
+    write_name( n, "new_n" );
+    out << '\n';
+
+    if ( cubes.empty() )
     {
-      os << fmt::format( "new_n{}\n", n );
+      out << "0\n";
+      return;
     }
 
-
-    int count = 0;
-    for ( auto cube : isop( func ) )
+    const auto num_fanins = topo_ntk.fanin_size( n );
+    for ( auto cube : cubes )
     {
-      topo_ntk.foreach_fanin( n, [&]( auto const& f, auto index ) 
-      {
+      topo_ntk.foreach_fanin( n, [&]( auto const& f, auto index ) {
         if ( cube.get_mask( index ) && topo_ntk.is_complemented( f ) )
           cube.flip_bit( index );
-      });
+      } );
 
-      cube.print( topo_ntk.fanin_size( n ), os );
-      os << " 1\n";
-      count++;
+      for ( auto i = 0u; i < num_fanins; ++i )
+      {
+        out << ( cube.get_mask( i ) ? ( cube.get_bit( i ) ? '1' : '0' ) : '-' );
+      }
+      out << " 1\n";
     }
   } );
 
-  auto latch_idx = 0;
-  topo_ntk.foreach_co( [&]( auto const& f, auto index )
-  {
-    auto f_node = topo_ntk.get_node( f );
-    auto const minterm_string = topo_ntk.is_complemented( f ) ? "0" : "1";
-    if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> && has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
+  auto latch_idx = 0u;
+  topo_ntk.foreach_co( [&]( auto const& f, auto index ) {
+    auto const f_node = topo_ntk.get_node( f );
+    auto const minterm = topo_ntk.is_complemented( f ) ? "0 1\n" : "1 1\n";
+    if constexpr ( has_names && has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
     {
-      signal<Ntk> const s = topo_ntk.make_signal( topo_ntk.get_node( f ) );
-      std::string const node_name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "new_n{}", topo_ntk.get_node( s ) );
-      std::string const output_name = topo_ntk.has_output_name( index ) ? topo_ntk.get_output_name( index ) : fmt::format( "po{}", index );
-      if(!ps.skip_feedthrough || ( node_name != output_name ) )
-        os << fmt::format( ".names {} {}\n{} 1\n", node_name, output_name, minterm_string, index );
+      if ( ps.skip_feedthrough )
+      {
+        auto const s = topo_ntk.make_signal( f_node );
+        std::string const node_name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "new_n{}", f_node );
+        std::string const output_name = topo_ntk.has_output_name( index ) ? topo_ntk.get_output_name( index ) : fmt::format( "po{}", index );
+        if ( node_name == output_name )
+          return;
+      }
+      out << ".names ";
+      write_name( f_node, "new_n" );
+      out << ' ';
+      write_output_name( index, "po", index );
+      out << '\n'
+          << minterm;
     }
     else
     {
-      if( index >= topo_ntk.num_cos() - topo_ntk.num_latches() ) 
+      if ( ps.skip_feedthrough && topo_ntk.get_node( f ) == index )
+        return;
+
+      if ( index >= topo_ntk.num_cos() - topo_ntk.num_latches() )
       {
-        auto const ro_sig = topo_ntk.make_signal( topo_ntk.ri_to_ro( f ) );
-        if(!ps.skip_feedthrough || ( topo_ntk.get_node( f ) != index)){
-          os << fmt::format( ".names new_n{} li{}\n{} 1\n", f_node, latch_idx, minterm_string );
-          latch_idx++;
-        }
+        out << ".names new_n" << f_node << " li" << latch_idx++ << '\n'
+            << minterm;
       }
       else
       {
-        std::string const node_name = topo_ntk.is_pi( f_node ) ? fmt::format( "pi{}", f_node ) : fmt::format( "new_n{}", f_node );
-        if(!ps.skip_feedthrough ||  ( topo_ntk.get_node( f ) != index ) )
-          os << fmt::format( ".names {} po{}\n{} 1\n", node_name, index, minterm_string );
+        out << ".names ";
+        write_fanin_name( f_node );
+        out << " po" << index << '\n'
+            << minterm;
       }
-      
     }
   } );
 
-  os << ".end\n";
-  os << std::flush;
+  out << ".end\n";
+  out.flush();
 }
 
 /*! \brief Writes network in BLIF format into a file
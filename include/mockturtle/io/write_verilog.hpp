@@ -36,14 +36,12 @@
 #include <fstream>
 #include <iostream>
 #include <string>
-
-#include <lorina/verilog.hpp>
-#include <ez/direct_iterator.hpp>
-#include <fmt/format.h>
+#include <utility>
+#include <vector>
 
 #include "../traits.hpp"
 #include "../utils/node_map.hpp"
-#include "../utils/string_utils.hpp"
+#include "../utils/output_buffer.hpp"
 #include "../views/topo_view.hpp"
 
 namespace mockturtle
@@ -51,22 +49,6 @@ namespace mockturtle
 
 using namespace std::string_literals;
 
-namespace detail
-{
-
-template<class Ntk>
-std::vector<std::pair<bool, std::string>>
-format_fanin( Ntk const& ntk, node<Ntk> const& n, node_map<std::string, Ntk>& node_names )
-{
-  std::vector<std::pair<bool, std::string>> children;
-  ntk.foreach_fanin( n, [&]( auto const& f ) {
-      children.emplace_back( std::make_pair( ntk.is_complemented( f ), node_names[f] ) );
-    });
-  return children;
-}
-
-} // namespace detail
-
 struct write_verilog_params
 {
   std::string module_name = "top";
@@ -120,160 +102,204 @@ void write_verilog( Ntk const& ntk, std::ostream& os, write_verilog_params const
 
   assert( ntk.is_combinational() && "Network has to be combinational" );
 
-  std::vector<std::string> xs, inputs;
-  if ( ps.input_names.empty() )
-  {
-    for ( auto i = 0u; i < ntk.num_pis(); ++i )
-      xs.emplace_back( fmt::format( "x{}", i ) );
-    inputs = xs;
-  }
-  else
-  {
-    uint32_t ctr{0u};
-    for ( auto const& [name, width] : ps.input_names )
+  /* PI and PO names are written from their index, either as `x{i}` and
+     `y{i}`, or as `{name}[{bit}]` for registers */
+  const auto register_bits = []( auto const& registers, uint32_t num ) {
+    std::vector<std::pair<uint32_t, uint32_t>> bits;
+    bits.reserve( num );
+    for ( auto r = 0u; r < registers.size(); ++r )
     {
-      inputs.emplace_back( name );
-      ctr += width;
-      for ( auto i = 0u; i < width; ++i )
+      for ( auto i = 0u; i < registers[r].second; ++i )
       {
-        xs.emplace_back( fmt::format( "{}[{}]", name, i ) );
+        bits.emplace_back( r, i );
       }
     }
-    if ( ctr != ntk.num_pis() )
-    {
-      std::cerr << "[e] input names do not partition all inputs\n";
-    }
-  }
+    return bits;
+  };
 
-  std::vector<std::string> ys, outputs;
-  if ( ps.output_names.empty() )
+  const auto input_bits = register_bits( ps.input_names, ntk.num_pis() );
+  if ( !ps.input_names.empty() && input_bits.size() != ntk.num_pis() )
   {
-    for ( auto i = 0u; i < ntk.num_pos(); ++i )
-      ys.emplace_back( fmt::format( "y{}", i ) );
-    outputs = ys;
+    std::cerr << "[e] input names do not partition all inputs\n";
   }
-  else
+  const auto output_bits = register_bits( ps.output_names, ntk.num_pos() );
+  if ( !ps.output_names.empty() && output_bits.size() != ntk.num_pos() )
   {
-    uint32_t ctr{0u};
-    for ( auto const& [name, width] : ps.output_names )
+    std::cerr << "[e] output names do not partition all outputs\n";
+  }
+
+  output_buffer out( os );
+
+  const auto write_io_name = [&]( auto const& registers, auto const& bits, char prefix, uint32_t index ) {
+    if ( registers.empty() )
+    {
+      out << prefix << index;
+    }
+    else
+    {
+      out << registers[bits[index].first].first << '[' << bits[index].second << ']';
+    }
+  };
+
+  const auto write_io_names = [&]( auto const& registers, char prefix, uint32_t num ) {
+    if ( registers.empty() )
     {
-      outputs.emplace_back( name );
-      ctr += width;
-      for ( auto i = 0u; i < width; ++i )
+      for ( auto i = 0u; i < num; ++i )
       {
-        ys.emplace_back( fmt::format( "{}[{}]", name, i ) );
+        out << ( i == 0u ? "" : " , " ) << prefix << i;
       }
     }
-    if ( ctr != ntk.num_pos() )
+    else
     {
-      std::cerr << "[e] output names do not partition all outputs\n";
+      out.write_joined( registers.begin(), registers.end(), " , ", []( auto& buffer, auto const& r ) { buffer << r.first; } );
     }
-  }
+  };
 
-  std::vector<std::string> ws;
-  ntk.foreach_gate( [&]( auto const& n ) {
-    ws.emplace_back( fmt::format( "n{}", ntk.node_to_index( n ) ) );
-  } );
-
-  lorina::verilog_writer writer( os );
-  writer.on_module_begin( ps.module_name, inputs, outputs );
-  if ( ps.input_names.empty() )
-  {
-    writer.on_input( xs );
-  }
-  else
-  {
-    for ( auto const& [name, width] : ps.input_names )
+  const auto write_declarations = [&]( auto const& registers, char prefix, uint32_t num, char const* kind ) {
+    if ( registers.empty() )
     {
-      writer.on_input( width, name );
+      out << "  " << kind << ' ';
+      write_io_names( registers, prefix, num );
+      out << " ;\n";
     }
-  }
-  if ( ps.output_names.empty() )
-  {
-    writer.on_output( ys );
-  }
-  else
-  {
-    for ( auto const& [name, width] : ps.output_names )
+    else
     {
-      writer.on_output( width, name );
+      for ( auto const& [name, width] : registers )
+      {
+        out << "  " << kind << " [" << ( width - 1 ) << ":0] " << name << " ;\n";
+      }
     }
-  }
-  if ( !ws.empty() )
+  };
+
+  const auto num_inputs = ps.input_names.empty() ? ntk.num_pis() : static_cast<uint32_t>( ps.input_names.size() );
+  const auto num_outputs = ps.output_names.empty() ? ntk.num_pos() : static_cast<uint32_t>( ps.output_names.size() );
+
+  out << "module " << ps.module_name << "( ";
+  write_io_names( ps.input_names, 'x', ntk.num_pis() );
+  if ( num_inputs != 0u && num_outputs != 0u )
   {
-    writer.on_wire( ws );
+    out << " , ";
   }
+  write_io_names( ps.output_names, 'y', ntk.num_pos() );
+  out << " );\n";
 
-  node_map<std::string, Ntk> node_names( ntk );
-  node_names[ntk.get_constant( false )] = "1'b0";
-  if ( ntk.get_node( ntk.get_constant( false ) ) != ntk.get_node( ntk.get_constant( true ) ) )
-    node_names[ntk.get_constant( true )] = "1'b1";
+  write_declarations( ps.input_names, 'x', ntk.num_pis(), "input" );
+  write_declarations( ps.output_names, 'y', ntk.num_pos(), "output" );
+
+  if ( ntk.num_gates() != 0u )
+  {
+    out << "  wire ";
+    auto first = true;
+    ntk.foreach_gate( [&]( auto const& n ) {
+      out << ( first ? "n" : " , n" ) << ntk.node_to_index( n );
+      first = false;
+    } );
+    out << " ;\n";
+  }
 
+  node_map<uint32_t, Ntk> pi_index( ntk );
   ntk.foreach_pi( [&]( auto const& n, auto i ) {
-    node_names[n] = xs[i];
+    pi_index[n] = i;
   } );
 
+  const auto write_signal = [&]( signal<Ntk> const& f ) {
+    const auto n = ntk.get_node( f );
+    if ( ntk.is_complemented( f ) )
+    {
+      out << '~';
+    }
+    if ( ntk.is_constant( n ) )
+    {
+      out << ( n == ntk.get_node( ntk.get_constant( false ) ) ? "1'b0" : "1'b1" );
+    }
+    else if ( ntk.is_pi( n ) )
+    {
+      write_io_name( ps.input_names, input_bits, 'x', pi_index[n] );
+    }
+    else
+    {
+      out << 'n' << ntk.node_to_index( n );
+    }
+  };
+
+  const auto write_assign = [&]( node<Ntk> const& n, char const* op ) {
+    out << "  assign n" << ntk.node_to_index( n ) << " = ";
+    ntk.foreach_fanin( n, [&]( auto const& f, auto i ) {
+      if ( i != 0u )
+      {
+        out << op;
+      }
+      write_signal( f );
+    } );
+    out << " ;\n";
+  };
+
   topo_view ntk_topo{ntk};
 
   ntk_topo.foreach_node( [&]( auto const& n ) {
     if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
       return true;
 
-    /* assign a name */
-    node_names[n] = fmt::format( "n{}", ntk.node_to_index( n ) );
-
     if ( ntk.is_and( n ) )
     {
-      writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "&" );
+      write_assign( n, " & " );
     }
     else if ( ntk.is_or( n ) )
     {
-      writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "|" );
+      write_assign( n, " | " );
     }
     else if ( ntk.is_xor( n ) || ntk.is_xor3( n ) )
     {
-      writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "^" );
+      write_assign( n, " ^ " );
     }
     else if ( ntk.is_maj( n ) )
     {
       std::array<signal<Ntk>, 3> children;
       ntk.foreach_fanin( n, [&]( auto const& f, auto i ) { children[i] = f; } );
 
+      out << "  assign n" << ntk.node_to_index( n ) << " = ";
       if ( ntk.is_constant( ntk.get_node( children[0u] ) ) )
       {
-        std::vector<std::pair<bool, std::string>> vs;
-        vs.emplace_back( std::make_pair( ntk.is_complemented( children[1u] ), node_names[ntk.get_node( children[1u] )] ) );
-        vs.emplace_back( std::make_pair( ntk.is_complemented( children[2u] ), node_names[ntk.get_node( children[2u] )] ) );
-
-        if ( ntk.is_complemented( children[0u] ) )
-        {
-          // or
-          writer.on_assign( node_names[n], {vs[0u], vs[1u]}, "|" );
-        }
-        else
-        {
-          // and
-          writer.on_assign( node_names[n], {vs[0u], vs[1u]}, "&" );
-        }
+        /* OR if the constant is complemented, AND otherwise */
+        write_signal( children[1u] );
+        out << ( ntk.is_complemented( children[0u] ) ? " | " : " & " );
+        write_signal( children[2u] );
       }
       else
       {
-        writer.on_assign_maj3( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ) );
+        const auto write_pair = [&]( auto const& a, auto const& b ) {
+          out << "( ";
+          write_signal( a );
+          out << " & ";
+          write_signal( b );
+          out << " )";
+        };
+        write_pair( children[0u], children[1u] );
+        out << " | ";
+        write_pair( children[0u], children[2u] );
+        out << " | ";
+        write_pair( children[1u], children[2u] );
       }
+      out << " ;\n";
     }
     else
     {
-      writer.on_assign_unknown_gate( node_names[n] );
+      out << "  assign n" << ntk.node_to_index( n ) << " = unknown gate;\n";
     }
 
     return true;
   } );
 
   ntk.foreach_po( [&]( auto const& f, auto i ) {
-    writer.on_assign_po( ys[i], std::make_pair( ntk.is_complemented( f ), node_names[f] ) );
+    out << "  assign ";
+    write_io_name( ps.output_names, output_bits, 'y', i );
+    out << " = ";
+    write_signal( f );
+    out << " ;\n";
   } );
 
-  writer.on_module_end();
+  out << "endmodule\n";
+  out.flush();
 }
 
 /*! \brief Writes network in structural Verilog format into a file
@@ -43,7 +43,11 @@
 #include "mockturtle/io/pla_reader.hpp"
 #include "mockturtle/io/aiger_reader.hpp"
 #include "mockturtle/io/write_dimacs.hpp"
+#include "mockturtle/io/write_aiger.hpp"
+#include "mockturtle/io/snapshot.hpp"
 #include "mockturtle/algorithms/simulation.hpp"
+#include "mockturtle/algorithms/sequential_simulation.hpp"
+#include "mockturtle/algorithms/unrolling.hpp"
 #include "mockturtle/algorithms/dont_cares.hpp"
 #include "mockturtle/algorithms/equivalence_checking.hpp"
 #include "mockturtle/algorithms/lut_mapping.hpp"
@@ -63,6 +67,7 @@
 #include "mockturtle/algorithms/reconv_cut2.hpp"
 #include "mockturtle/algorithms/refactoring.hpp"
 #include "mockturtle/algorithms/node_resynthesis/exact.hpp"
+#include "mockturtle/algorithms/node_resynthesis/exact_cache.hpp"
 #include "mockturtle/algorithms/node_resynthesis/shannon.hpp"
 #include "mockturtle/algorithms/node_resynthesis/mig_npn.hpp"
 #include "mockturtle/algorithms/node_resynthesis/bidecomposition.hpp"
@@ -70,6 +75,7 @@
 #include "mockturtle/algorithms/node_resynthesis/dsd.hpp"
 #include "mockturtle/algorithms/node_resynthesis/xmg_npn.hpp"
 #include "mockturtle/algorithms/node_resynthesis/xag_npn.hpp"
+#include "mockturtle/algorithms/node_resynthesis/npn6.hpp"
 #include "mockturtle/algorithms/node_resynthesis/xag_minmc.hpp"
 #include "mockturtle/algorithms/node_resynthesis/direct.hpp"
 #include "mockturtle/algorithms/akers_synthesis.hpp"
@@ -81,6 +87,7 @@
 #include "mockturtle/algorithms/shannon_decomposition.hpp"
 #include "mockturtle/algorithms/node_resynthesis.hpp"
 #include "mockturtle/algorithms/mig_resub.hpp"
+#include "mockturtle/algorithms/pass_manager.hpp"
 #include "mockturtle/algorithms/reconv_cut.hpp"
 #include "mockturtle/algorithms/resubstitution.hpp"
 #include "mockturtle/algorithms/aig_resub.hpp"
@@ -91,7 +98,10 @@
 #include "mockturtle/utils/progress_bar.hpp"
 #include "mockturtle/utils/mixed_radix.hpp"
 #include "mockturtle/utils/node_map.hpp"
+#include "mockturtle/utils/npn4_table.hpp"
 #include "mockturtle/utils/cuts.hpp"
+#include "mockturtle/utils/mapped_file.hpp"
+#include "mockturtle/utils/output_buffer.hpp"
 #include "mockturtle/networks/aig.hpp"
 #include "mockturtle/networks/events.hpp"
 #include "mockturtle/networks/klut.hpp"
@@ -110,6 +120,7 @@
 #include "mockturtle/generators/modular_arithmetic.hpp"
 #include "mockturtle/views/mffc_view.hpp"
 #include "mockturtle/views/immutable_view.hpp"
+#include "mockturtle/views/frozen_view.hpp"
 #include "mockturtle/views/topo_view.hpp"
 #include "mockturtle/views/window_view.hpp"
 #include "mockturtle/views/fanout_view.hpp"
@@ -34,8 +34,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <sparsepp/spp.h>
@@ -187,6 +192,174 @@ struct empty_storage_data
 {
 };
 
+/*! \brief Structural hash table which can be filled on demand.
+ *
+ * Wraps a sparse hash map, but a deferred fill function can be registered
+ * with `defer`.  The function is called on the first access to the table,
+ * which allows to restore a network from a snapshot without paying for
+ * structural hashing unless nodes are created or looked up.  The number of
+ * entries is known in advance, such that `size()` does not fill the table.
+ *
+ * Filling is guarded by `std::call_once`, such that several threads can
+ * read or copy the same table.  Modifying the table is not thread-safe.
+ */
+template<typename Node, typename T, typename NodeHasher>
+class node_hash_map
+{
+public:
+  using map_type = spp::sparse_hash_map<Node, T, NodeHasher>;
+  using fill_fn = std::function<void( map_type& )>;
+  using iterator = typename map_type::iterator;
+  using const_iterator = typename map_type::const_iterator;
+
+  node_hash_map() = default;
+
+  node_hash_map( node_hash_map const& other )
+      : _map( other.materialize() )
+  {
+  }
+
+  node_hash_map( node_hash_map&& other ) = default;
+
+  node_hash_map& operator=( node_hash_map const& other )
+  {
+    if ( this != &other )
+    {
+      _map = other.materialize();
+      _deferred.reset();
+    }
+    return *this;
+  }
+
+  node_hash_map& operator=( node_hash_map&& other ) = default;
+
+  /*! \brief Registers a function which fills the table with `size` entries. */
+  void defer( fill_fn fn, std::size_t size )
+  {
+    _map.clear();
+    _deferred = std::make_unique<deferred_fill>();
+    _deferred->fill = std::move( fn );
+    _deferred->size = size;
+  }
+
+  /*! \brief Returns true, if the table has not been filled yet. */
+  bool is_deferred() const
+  {
+    return _deferred && !_deferred->done.load( std::memory_order_acquire );
+  }
+
+  /*! \brief Fills the table, if it is deferred, and returns it. */
+  map_type const& materialize() const
+  {
+    if ( _deferred )
+    {
+      std::call_once( _deferred->once, [this]() {
+        _deferred->fill( _map );
+        _deferred->fill = {};
+        _deferred->done.store( true, std::memory_order_release );
+      } );
+    }
+    return _map;
+  }
+
+  std::size_t size() const
+  {
+    return is_deferred() ? _deferred->size : _map.size();
+  }
+
+  bool empty() const
+  {
+    return size() == 0u;
+  }
+
+  void clear()
+  {
+    _deferred.reset();
+    _map.clear();
+  }
+
+  void reserve( std::size_t size )
+  {
+    mutable_map().reserve( size );
+  }
+
+  void set_resizing_parameters( float shrink, float grow )
+  {
+    mutable_map().set_resizing_parameters( shrink, grow );
+  }
+
+  iterator find( Node const& key )
+  {
+    return mutable_map().find( key );
+  }
+
+  const_iterator find( Node const& key ) const
+  {
+    return materialize().find( key );
+  }
+
+  std::size_t count( Node const& key ) const
+  {
+    return materialize().count( key );
+  }
+
+  template<typename... Args>
+  auto erase( Args&&... args )
+  {
+    return mutable_map().erase( std::forward<Args>( args )... );
+  }
+
+  template<typename... Args>
+  auto insert( Args&&... args )
+  {
+    return mutable_map().insert( std::forward<Args>( args )... );
+  }
+
+  T& operator[]( Node const& key )
+  {
+    return mutable_map()[key];
+  }
+
+  iterator begin()
+  {
+    return mutable_map().begin();
+  }
+
+  iterator end()
+  {
+    return mutable_map().end();
+  }
+
+  const_iterator begin() const
+  {
+    return materialize().begin();
+  }
+
+  const_iterator end() const
+  {
+    return materialize().end();
+  }
+
+private:
+  struct deferred_fill
+  {
+    std::once_flag once;
+    std::atomic<bool> done{false};
+    fill_fn fill;
+    std::size_t size{0u};
+  };
+
+  map_type& mutable_map()
+  {
+    materialize();
+    return _map;
+  }
+
+private:
+  mutable map_type _map;
+  std::unique_ptr<deferred_fill> _deferred;
+};
+
 template<typename Node, typename T = empty_storage_data, typename NodeHasher = node_hash<Node>>
 struct storage
 {
@@ -207,7 +380,7 @@ struct storage
   std::vector<typename node_type::pointer_type> outputs;
   std::unordered_map<uint64_t, latch_info> latch_information;
 
-  spp::sparse_hash_map<node_type, uint64_t, NodeHasher> hash;
+  node_hash_map<node_type, uint64_t, NodeHasher> hash;
 
   T data;
 };
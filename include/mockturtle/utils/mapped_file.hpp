@@ -0,0 +1,140 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file mapped_file.hpp
+  \brief Read-only memory-mapped files
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mockturtle
+{
+
+/*! \brief Read-only view on the contents of a file.
+ *
+ * The file is mapped into memory, such that readers can parse it in place
+ * without copying it into stream buffers.  If the file cannot be mapped
+ * (or on platforms without `mmap`), its contents are read into a buffer.
+ */
+class mapped_file
+{
+public:
+  explicit mapped_file( std::string const& filename )
+  {
+#ifndef _WIN32
+    const auto fd = ::open( filename.c_str(), O_RDONLY );
+    if ( fd < 0 )
+    {
+      return;
+    }
+    struct stat st;
+    if ( fstat( fd, &st ) == 0 && st.st_size > 0 )
+    {
+      auto* map = mmap( nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if ( map != MAP_FAILED )
+      {
+        madvise( map, st.st_size, MADV_SEQUENTIAL );
+        _map = static_cast<char const*>( map );
+        _size = st.st_size;
+        _is_open = true;
+      }
+    }
+    ::close( fd );
+    if ( _is_open )
+    {
+      return;
+    }
+#endif
+
+    std::ifstream in( filename, std::ios::binary );
+    if ( !in.good() )
+    {
+      return;
+    }
+    _buffer.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+    _size = _buffer.size();
+    _is_open = true;
+  }
+
+  ~mapped_file()
+  {
+#ifndef _WIN32
+    if ( _map != nullptr )
+    {
+      munmap( const_cast<char*>( _map ), _size );
+    }
+#endif
+  }
+
+  mapped_file( mapped_file const& ) = delete;
+  mapped_file& operator=( mapped_file const& ) = delete;
+
+  /*! \brief Returns whether the file could be opened. */
+  bool is_open() const
+  {
+    return _is_open;
+  }
+
+  /*! \brief Returns a pointer to the file contents. */
+  char const* data() const
+  {
+    return _map != nullptr ? _map : _buffer.data();
+  }
+
+  /*! \brief Returns the size of the file in bytes. */
+  std::size_t size() const
+  {
+    return _size;
+  }
+
+  /*! \brief Returns the file contents. */
+  std::string_view view() const
+  {
+    return std::string_view( data(), _size );
+  }
+
+private:
+  bool _is_open{false};
+  char const* _map{nullptr};
+  std::size_t _size{0u};
+  std::vector<char> _buffer;
+};
+
+} // namespace mockturtle
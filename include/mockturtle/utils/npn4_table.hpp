@@ -0,0 +1,242 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file npn4_table.hpp
+  \brief Precomputed NPN transforms of all 4-input functions
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/detail/constants.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/static_truth_table.hpp>
+
+namespace mockturtle
+{
+
+/*! \brief NPN transforms of all 4-input functions.
+ *
+ * The table stores for each of the 65,536 functions over 4 variables the
+ * index of its NPN class together with a transform that maps the class
+ * representative into the function.  Each entry is packed into a single
+ * 32-bit word: the class index in bits 0--7, the phase in bits 8--12 and the
+ * index of the permutation (into the 24 permutations of 4 elements) in bits
+ * 13--17.  Representative, phase, and permutation are the same as the ones
+ * returned by ``kitty::exact_npn_canonization``: if ``y`` is obtained from
+ * the inputs ``x`` by ``y[i] = x[perm[i]] ^ ( ( phase >> perm[i] ) & 1 )``,
+ * then the function equals the representative applied to ``y``,
+ * complemented if bit 4 of the phase is set.
+ *
+ * The table is built once on first use and shared by all database-based
+ * resynthesis functions; use ``npn4_transforms()`` to access it.
+ */
+class npn4_table
+{
+public:
+  npn4_table()
+      : _transforms( 1u << 16, unassigned )
+  {
+    std::array<uint8_t, 4> perm{{0, 1, 2, 3}};
+    do
+    {
+      _perms.push_back( perm );
+    } while ( std::next_permutation( perm.begin(), perm.end() ) );
+
+    build_steps();
+
+    /* functions are visited in increasing order, therefore the first
+       unassigned function is the smallest one of a new class */
+    for ( uint32_t f = 0u; f < ( 1u << 16 ); ++f )
+    {
+      if ( _transforms[f] != unassigned )
+      {
+        continue;
+      }
+
+      const auto index = static_cast<uint32_t>( _representatives.size() );
+      _representatives.push_back( static_cast<uint16_t>( f ) );
+
+      /* the canonization assigns to each function the first step in which
+         the representative is met, either in positive or negative polarity */
+      for ( auto const& step : _steps )
+      {
+        uint16_t g = 0u;
+        for ( auto x = 0u; x < 16u; ++x )
+        {
+          if ( ( f >> x ) & 1 )
+          {
+            g |= 1u << step.minterms[x];
+          }
+        }
+
+        const auto entry = index | ( step.phase << 8 ) | ( step.perm << 13 );
+        if ( _transforms[g] == unassigned )
+        {
+          _transforms[g] = entry;
+        }
+        if ( _transforms[static_cast<uint16_t>( ~g )] == unassigned )
+        {
+          _transforms[static_cast<uint16_t>( ~g )] = entry | ( 1u << 12 );
+        }
+      }
+    }
+
+    assert( _representatives.size() == 222u );
+  }
+
+  /*! \brief Number of NPN classes (222). */
+  uint32_t num_classes() const
+  {
+    return static_cast<uint32_t>( _representatives.size() );
+  }
+
+  /*! \brief Index of the NPN class of a function. */
+  uint32_t class_index( uint16_t function ) const
+  {
+    return _transforms[function] & 0xff;
+  }
+
+  /*! \brief Representative of an NPN class. */
+  uint16_t representative( uint32_t index ) const
+  {
+    return _representatives[index];
+  }
+
+  /*! \brief Phase that maps the representative into the function. */
+  uint32_t phase( uint16_t function ) const
+  {
+    return ( _transforms[function] >> 8 ) & 0x1f;
+  }
+
+  /*! \brief Permutation that maps the representative into the function. */
+  std::array<uint8_t, 4> const& perm( uint16_t function ) const
+  {
+    return _perms[( _transforms[function] >> 13 ) & 0x1f];
+  }
+
+private:
+  struct step_t
+  {
+    std::array<uint8_t, 16> minterms;
+    uint32_t phase;
+    uint32_t perm;
+  };
+
+  /* replays the swap and flip sequence of kitty::exact_npn_canonization on
+     the projections, which yields for every step the minterm that moves to
+     each position together with the phase and permutation returned for it */
+  void build_steps()
+  {
+    const auto& swaps = kitty::detail::swaps[2u];
+    const auto& flips = kitty::detail::flips[2u];
+
+    std::array<kitty::static_truth_table<4>, 4> vars;
+    for ( auto i = 0u; i < 4u; ++i )
+    {
+      kitty::create_nth_var( vars[i], i );
+    }
+
+    const auto add_step = [&]( int best_swap, int best_flip ) {
+      step_t step;
+      for ( auto x = 0u; x < 16u; ++x )
+      {
+        step.minterms[x] = 0u;
+        for ( auto i = 0u; i < 4u; ++i )
+        {
+          step.minterms[x] |= kitty::get_bit( vars[i], x ) << i;
+        }
+      }
+
+      std::array<uint8_t, 4> perm{{0, 1, 2, 3}};
+      for ( auto i = 0; i <= best_swap; ++i )
+      {
+        std::swap( perm[swaps[i]], perm[swaps[i] + 1] );
+      }
+      step.perm = static_cast<uint32_t>( std::find( _perms.begin(), _perms.end(), perm ) - _perms.begin() );
+
+      step.phase = 0u;
+      for ( auto i = 0; i <= best_flip; ++i )
+      {
+        step.phase ^= 1u << flips[i];
+      }
+
+      _steps.push_back( step );
+    };
+
+    add_step( -1, -1 );
+    for ( auto i = 0u; i < swaps.size(); ++i )
+    {
+      for ( auto& v : vars )
+      {
+        kitty::swap_adjacent_inplace( v, swaps[i] );
+      }
+      add_step( i, -1 );
+    }
+
+    for ( auto j = 0u; j < flips.size(); ++j )
+    {
+      for ( auto& v : vars )
+      {
+        kitty::swap_adjacent_inplace( v, 0 );
+        kitty::flip_inplace( v, flips[j] );
+      }
+      add_step( -1, j );
+
+      for ( auto i = 0u; i < swaps.size(); ++i )
+      {
+        for ( auto& v : vars )
+        {
+          kitty::swap_adjacent_inplace( v, swaps[i] );
+        }
+        add_step( i, j );
+      }
+    }
+  }
+
+private:
+  static constexpr uint32_t unassigned = 0xffffffff;
+
+  std::vector<uint32_t> _transforms;
+  std::vector<uint16_t> _representatives;
+  std::vector<std::array<uint8_t, 4>> _perms;
+  std::vector<step_t> _steps;
+};
+
+/*! \brief Returns the shared table of 4-input NPN transforms. */
+inline npn4_table const& npn4_transforms()
+{
+  static const npn4_table table;
+  return table;
+}
+
+} /* namespace mockturtle */
@@ -0,0 +1,234 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file output_buffer.hpp
+  \brief Buffered text output for network writers
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace mockturtle
+{
+
+/*! \brief Buffered text emitter on top of an output stream.
+ *
+ * Text is collected in a reusable buffer which is passed to the underlying
+ * stream in large blocks.  Integers and hexadecimal truth tables are
+ * converted directly into the buffer, such that writers can emit names such
+ * as `n42` without constructing intermediate strings.  The buffer is flushed
+ * when it exceeds its capacity and when the emitter is destroyed.
+ *
+ * Alternatively, the emitter can append to a memory buffer, which is then
+ * never flushed.
+ *
+ * Example
+ *
+   \verbatim embed:rst
+
+   .. code-block:: c++
+
+      output_buffer out( os );
+      out << "n" << ntk.node_to_index( n ) << " = " << 'x' << 3u << '\n';
+   \endverbatim
+ */
+class output_buffer
+{
+public:
+  explicit output_buffer( std::ostream& os, std::size_t capacity = 1u << 16 )
+      : _os( &os ),
+        _capacity( capacity ),
+        _buffer( _own_buffer )
+  {
+    _buffer.reserve( capacity + 64u );
+  }
+
+  /*! \brief Appends all output to `target`. */
+  explicit output_buffer( std::vector<char>& target )
+      : _capacity( std::numeric_limits<std::size_t>::max() ),
+        _buffer( target )
+  {
+  }
+
+  ~output_buffer()
+  {
+    flush();
+  }
+
+  output_buffer( output_buffer const& ) = delete;
+  output_buffer& operator=( output_buffer const& ) = delete;
+
+  /*! \brief Passes the buffered text to the output stream. */
+  void flush()
+  {
+    if ( !_os )
+    {
+      return;
+    }
+
+    if ( !_buffer.empty() )
+    {
+      _os->write( _buffer.data(), _buffer.size() );
+      _buffer.clear();
+    }
+    _os->flush();
+  }
+
+  output_buffer& operator<<( char c )
+  {
+    _buffer.push_back( c );
+    check();
+    return *this;
+  }
+
+  output_buffer& operator<<( std::string_view s )
+  {
+    _buffer.insert( _buffer.end(), s.begin(), s.end() );
+    check();
+    return *this;
+  }
+
+  output_buffer& operator<<( char const* s )
+  {
+    return *this << std::string_view( s );
+  }
+
+  output_buffer& operator<<( std::string const& s )
+  {
+    return *this << std::string_view( s );
+  }
+
+  template<typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>>>
+  output_buffer& operator<<( T value )
+  {
+    if constexpr ( std::is_signed_v<T> )
+    {
+      if ( value < 0 )
+      {
+        _buffer.push_back( '-' );
+        return write_unsigned( uint64_t( 0 ) - static_cast<uint64_t>( value ) );
+      }
+    }
+    return write_unsigned( static_cast<uint64_t>( value ) );
+  }
+
+  /*! \brief Writes a truth table in hexadecimal format (as `kitty::print_hex`). */
+  template<typename TT>
+  output_buffer& write_hex( TT const& tt )
+  {
+    static constexpr char digits[] = "0123456789abcdef";
+    const auto chunk_size = std::min<uint64_t>( tt.num_vars() <= 1 ? 1 : ( tt.num_bits() >> 2 ), 16 );
+    for ( auto it = tt.crbegin(); it != tt.crend(); ++it )
+    {
+      auto word = *it;
+      const auto pos = _buffer.size();
+      _buffer.resize( pos + chunk_size );
+      for ( auto i = chunk_size; i > 0u; --i )
+      {
+        _buffer[pos + i - 1u] = digits[word & 0xf];
+        word >>= 4;
+      }
+    }
+    check();
+    return *this;
+  }
+
+  /*! \brief Writes elements separated by a delimiter.
+   *
+   * The function `fn` is called with the buffer and each element.
+   */
+  template<class Iterator, class Fn>
+  output_buffer& write_joined( Iterator begin, Iterator end, std::string_view delimiter, Fn&& fn )
+  {
+    for ( auto it = begin; it != end; ++it )
+    {
+      if ( it != begin )
+      {
+        *this << delimiter;
+      }
+      fn( *this, *it );
+    }
+    return *this;
+  }
+
+private:
+  output_buffer& write_unsigned( uint64_t value )
+  {
+    static constexpr char pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    char tmp[20];
+    auto* p = tmp + sizeof( tmp );
+    while ( value >= 100u )
+    {
+      const auto r = static_cast<uint32_t>( value % 100u ) * 2u;
+      value /= 100u;
+      *--p = pairs[r + 1u];
+      *--p = pairs[r];
+    }
+    if ( value < 10u )
+    {
+      *--p = static_cast<char>( '0' + value );
+    }
+    else
+    {
+      const auto r = static_cast<uint32_t>( value ) * 2u;
+      *--p = pairs[r + 1u];
+      *--p = pairs[r];
+    }
+    _buffer.insert( _buffer.end(), p, tmp + sizeof( tmp ) );
+    check();
+    return *this;
+  }
+
+  void check()
+  {
+    if ( _buffer.size() >= _capacity )
+    {
+      _os->write( _buffer.data(), _buffer.size() );
+      _buffer.clear();
+    }
+  }
+
+private:
+  std::ostream* _os{nullptr};
+  std::size_t _capacity;
+  std::vector<char> _own_buffer;
+  std::vector<char>& _buffer;
+};
+
+} // namespace mockturtle
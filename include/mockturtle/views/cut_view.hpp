@@ -149,8 +149,8 @@ public:
 
   inline bool is_pi( node const& pi ) const
   {
-    const auto beg = _nodes.begin() + _num_constants;
-    return std::find( beg, beg + _num_leaves, pi ) != beg + _num_leaves;
+    const auto it = _node_to_index.find( pi );
+    return it != _node_to_index.end() && it->second >= _num_constants && it->second < _num_constants + _num_leaves;
   }
 
   template<typename Fn>
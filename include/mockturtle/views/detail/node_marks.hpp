@@ -0,0 +1,87 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file node_marks.hpp
+  \brief Reusable dense node markers for window construction
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+/* dense set of node indices; starting a new set bumps a generation
+   counter instead of clearing the markers, such that the buffer is
+   reused across window constructions */
+class node_marks
+{
+public:
+  void reset( std::size_t size )
+  {
+    if ( _marks.size() < size )
+    {
+      _marks.resize( size, 0u );
+    }
+    if ( ++_generation == 0u )
+    {
+      std::fill( _marks.begin(), _marks.end(), 0u );
+      _generation = 1u;
+    }
+  }
+
+  void insert( uint64_t index )
+  {
+    _marks[index] = _generation;
+  }
+
+  bool contains( uint64_t index ) const
+  {
+    return index < _marks.size() && _marks[index] == _generation;
+  }
+
+private:
+  std::vector<uint32_t> _marks;
+  uint32_t _generation{0u};
+};
+
+/* per-thread markers used while constructing window views; a view
+   must only use them inside its constructor */
+inline node_marks& window_node_marks()
+{
+  thread_local node_marks marks;
+  return marks;
+}
+
+} // namespace detail
+
+} // namespace mockturtle
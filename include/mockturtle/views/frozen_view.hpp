@@ -0,0 +1,191 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file frozen_view.hpp
+  \brief Read-only view for concurrent readers of a network
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../networks/events.hpp"
+#include "../traits.hpp"
+#include "immutable_view.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Implements a read-only view that can be traversed concurrently.
+ *
+ * The `const` methods `incr_trav_id`, `set_visited`, and `set_value` of the
+ * networks write into the shared storage, such that several threads cannot
+ * traverse the same network at the same time.  This view reimplements these
+ * methods, together with `trav_id`, `visited`, `value`, `incr_value`,
+ * `decr_value`, `clear_visited`, and `clear_values`, on side tables which
+ * are owned by the view.  All methods that change the network, including
+ * `incr_fanout_size` and `decr_fanout_size`, are deleted.
+ *
+ * The view also returns its own `events`, such that views on top of it,
+ * e.g., `fanout_view`, do not register callbacks in the events of the
+ * network, which are shared by all copies.  Since the network cannot change,
+ * these events are never triggered.
+ *
+ * Copies of a frozen view share the network storage, but each copy owns its
+ * own side tables and events.  To run an analysis in several threads, give each thread
+ * its own copy of the view.  The side tables are initialized to 0 and do not
+ * reflect the values of the underlying network.  The underlying network must
+ * not be modified while frozen views of it are in use.
+ *
+ * **Required network functions:**
+ * - `size`
+ * - `node_to_index`
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      aig_network aig = ...;
+      frozen_view frozen{aig};
+
+      std::vector<std::thread> threads;
+      for ( auto i = 0u; i < 4u; ++i )
+      {
+        threads.emplace_back( [frozen, i]() {
+          // frozen is a per-thread copy
+          topo_view topo{frozen};
+          ...
+        } );
+      }
+      for ( auto& t : threads )
+      {
+        t.join();
+      }
+   \endverbatim
+ */
+template<typename Ntk>
+class frozen_view : public immutable_view<Ntk>
+{
+public:
+  using storage = typename Ntk::storage;
+  using node = typename Ntk::node;
+  using signal = typename Ntk::signal;
+
+  explicit frozen_view( Ntk const& ntk )
+      : immutable_view<Ntk>( ntk ),
+        _visited( ntk.size(), 0u ),
+        _values( ntk.size(), 0u )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+    static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+  }
+
+#pragma region Value
+  void clear_values() const
+  {
+    std::fill( _values.begin(), _values.end(), 0u );
+  }
+
+  uint32_t value( node const& n ) const
+  {
+    return _values[this->node_to_index( n )];
+  }
+
+  void set_value( node const& n, uint32_t v ) const
+  {
+    _values[this->node_to_index( n )] = v;
+  }
+
+  uint32_t incr_value( node const& n ) const
+  {
+    return _values[this->node_to_index( n )]++;
+  }
+
+  uint32_t decr_value( node const& n ) const
+  {
+    return --_values[this->node_to_index( n )];
+  }
+#pragma endregion
+
+#pragma region Visited flags
+  void clear_visited() const
+  {
+    std::fill( _visited.begin(), _visited.end(), 0u );
+  }
+
+  uint32_t visited( node const& n ) const
+  {
+    return _visited[this->node_to_index( n )];
+  }
+
+  void set_visited( node const& n, uint32_t v ) const
+  {
+    _visited[this->node_to_index( n )] = v;
+  }
+
+  uint32_t trav_id() const
+  {
+    return _trav_id;
+  }
+
+  void incr_trav_id() const
+  {
+    ++_trav_id;
+  }
+#pragma endregion
+
+  auto& events() const
+  {
+    return _local_events;
+  }
+
+  uint32_t incr_fanout_size( node const& n ) const = delete;
+  uint32_t decr_fanout_size( node const& n ) const = delete;
+  signal create_ro( std::string const& name = {} ) = delete;
+  uint32_t create_ri( signal const& f, int8_t reset = 0, std::string const& name = {} ) = delete;
+  signal create_xor3( signal const& a, signal const& b, signal const& c ) = delete;
+  void substitute_node( node const& old_node, signal const& new_signal ) = delete;
+  void replace_in_node( node const& n, node const& old_node, signal new_signal ) = delete;
+  void replace_in_outputs( node const& old_node, signal const& new_signal ) = delete;
+  void take_out_node( node const& n ) = delete;
+
+private:
+  mutable std::vector<uint32_t> _visited;
+  mutable std::vector<uint32_t> _values;
+  mutable uint32_t _trav_id{0u};
+  mutable network_events<typename Ntk::base_type> _local_events;
+};
+
+template<class T>
+frozen_view( T const& )->frozen_view<T>;
+
+} // namespace mockturtle
@@ -116,7 +116,8 @@ public:
 
   inline bool is_pi( node const& pi ) const
   {
-    return std::find( _leaves.begin(), _leaves.end(), pi ) != _leaves.end();
+    const auto it = _node_to_index.find( pi );
+    return it != _node_to_index.end() && it->second >= _num_constants && it->second < _num_constants + _num_leaves;
   }
 
   template<typename Fn>
@@ -253,6 +254,24 @@ private:
     _inner.push_back( _root );
     _node_to_index.emplace( _root, _node_to_index.size() );
 
+    /* the inner nodes are sorted by index, which is a topological order if
+       all fanins have smaller indices */
+    auto is_sorted = true;
+    for ( auto const& n : _inner )
+    {
+      Ntk::foreach_fanin( n, [&]( auto const& f ) {
+        if ( Ntk::node_to_index( Ntk::get_node( f ) ) >= Ntk::node_to_index( n ) )
+        {
+          is_sorted = false;
+        }
+        return is_sorted;
+      } );
+      if ( !is_sorted )
+        break;
+    }
+    if ( is_sorted )
+      return;
+
     /* sort topologically */
     _topo.clear();
     _colors.clear();
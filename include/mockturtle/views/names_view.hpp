@@ -34,11 +34,125 @@
 
 #include "../traits.hpp"
 
-#include <map>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace mockturtle
 {
 
+namespace detail
+{
+
+/* names stored in one contiguous character pool, each terminated by '\0';
+   slots refer to names by their offset into the pool plus one, 0 means that
+   the slot has no name */
+class name_table
+{
+public:
+  bool has( uint64_t slot ) const
+  {
+    return slot < _refs.size() && _refs[slot] != 0u;
+  }
+
+  std::string_view get( uint64_t slot ) const
+  {
+    if ( !has( slot ) )
+    {
+      throw std::out_of_range( "name_table: slot has no name" );
+    }
+    auto const* p = _pool.data() + _refs[slot] - 1u;
+    return {p, std::strlen( p )};
+  }
+
+  void set( uint64_t slot, std::string_view name )
+  {
+    if ( slot >= _refs.size() )
+    {
+      _refs.resize( slot + 1u, 0u );
+    }
+
+    if ( _refs[slot] != 0u )
+    {
+      /* overwrite in place if the new name fits */
+      const auto previous = get( slot ).size();
+      if ( name.size() <= previous )
+      {
+        auto* p = _pool.data() + _refs[slot] - 1u;
+        std::memcpy( p, name.data(), name.size() );
+        p[name.size()] = '\0';
+        _garbage += previous - name.size();
+        return;
+      }
+      _garbage += previous + 1u;
+    }
+
+    _refs[slot] = _pool.size() + 1u;
+    _pool.append( name );
+    _pool.push_back( '\0' );
+    compact();
+  }
+
+  void erase( uint64_t slot )
+  {
+    if ( !has( slot ) )
+    {
+      return;
+    }
+    _garbage += get( slot ).size() + 1u;
+    _refs[slot] = 0u;
+    compact();
+  }
+
+private:
+  /* rebuilds the pool once more than half of it is unused */
+  void compact()
+  {
+    if ( _garbage < 4096u || 2u * _garbage < _pool.size() )
+    {
+      return;
+    }
+
+    std::string pool;
+    pool.reserve( _pool.size() - _garbage );
+    for ( auto& ref : _refs )
+    {
+      if ( ref != 0u )
+      {
+        auto const* p = _pool.data() + ref - 1u;
+        ref = pool.size() + 1u;
+        pool.append( p );
+        pool.push_back( '\0' );
+      }
+    }
+    _pool = std::move( pool );
+    _garbage = 0u;
+  }
+
+private:
+  std::vector<uint64_t> _refs;
+  std::string _pool;
+  uint64_t _garbage{0u};
+};
+
+} // namespace detail
+
+/*! \brief Assigns names to signals and primary outputs.
+ *
+ * Names are kept in a table indexed by node (and complementation), which
+ * refers into a single contiguous string pool; assigning and looking up
+ * names takes constant time.  Names of deleted nodes are removed through
+ * network events, and when a node is substituted, its names are moved to
+ * the substituting signal unless that one is already named.
+ *
+ * Copies of the view have their own names.  Each view removes its event
+ * callback from the network when it is destroyed.
+ */
 template<class Ntk>
 class names_view : public Ntk
 {
@@ -49,34 +163,44 @@ public:
 
 public:
   names_view( Ntk const& ntk = Ntk() )
-    : Ntk( ntk )
+    : Ntk( ntk ),
+      _signal_names( std::make_shared<detail::name_table>() )
   {
+    register_events();
   }
 
   names_view( names_view<Ntk> const& named_ntk )
-    : Ntk( named_ntk )
-    , _signal_names( named_ntk._signal_names )
-    , _output_names( named_ntk._output_names )
+    : Ntk( named_ntk ),
+      _signal_names( std::make_shared<detail::name_table>( *named_ntk._signal_names ) ),
+      _output_names( named_ntk._output_names )
   {
+    register_events();
   }
 
   names_view<Ntk>& operator=( names_view<Ntk> const& named_ntk )
   {
-    std::map<signal, std::string> new_signal_names;
+    auto new_signal_names = std::make_shared<detail::name_table>();
     std::vector<signal> current_pis;
-    Ntk::foreach_pi( [&]( auto const& n ) {
+    Ntk::foreach_pi( [&, this]( auto const& n ) {
         current_pis.emplace_back( Ntk::make_signal( n ) );
       });
-    named_ntk.foreach_pi( [&]( auto const& n, auto i ) {
-        if ( const auto it = _signal_names.find( current_pis[i] ); it != _signal_names.end() )
-          new_signal_names[named_ntk.make_signal( n )] = it->second;
+    named_ntk.foreach_pi( [&, this]( auto const& n, auto i ) {
+        if ( const auto slot = signal_slot( current_pis[i] ); _signal_names->has( slot ) )
+          new_signal_names->set( named_ntk.signal_slot( named_ntk.make_signal( n ) ), _signal_names->get( slot ) );
       } );
 
+    unregister_events();
     Ntk::operator=( named_ntk );
     _signal_names = new_signal_names;
+    register_events();
     return *this;
   }
 
+  ~names_view()
+  {
+    unregister_events();
+  }
+
   signal create_pi( std::string const& name = {} )
   {
     const auto s = Ntk::create_pi( name );
@@ -97,39 +221,104 @@ public:
     }
   }
 
+  void substitute_node( node const& old_node, signal const& new_signal )
+  {
+    const auto f = Ntk::make_signal( old_node );
+    if ( has_name( f ) && !has_name( new_signal ) )
+    {
+      set_name( new_signal, get_name( f ) );
+    }
+    if constexpr ( !std::is_same_v<signal, node> )
+    {
+      if ( has_name( !f ) && !has_name( !new_signal ) )
+      {
+        set_name( !new_signal, get_name( !f ) );
+      }
+    }
+    Ntk::substitute_node( old_node, new_signal );
+  }
+
   bool has_name( signal const& s ) const
   {
-    return ( _signal_names.find( s ) != _signal_names.end() );
+    return _signal_names->has( signal_slot( s ) );
   }
 
   void set_name( signal const& s, std::string const& name )
   {
-    _signal_names[s] = name;
+    _signal_names->set( signal_slot( s ), name );
   }
 
   std::string get_name( signal const& s ) const
   {
-    return _signal_names.at( s );
+    return std::string( _signal_names->get( signal_slot( s ) ) );
   }
 
   bool has_output_name( uint32_t index ) const
   {
-    return ( _output_names.find( index ) != _output_names.end() );
+    return _output_names.has( index );
   }
 
   void set_output_name( uint32_t index, std::string const& name )
   {
-    _output_names[index] = name;
+    _output_names.set( index, name );
   }
 
   std::string get_output_name( uint32_t index ) const
   {
-    return _output_names.at( index );
+    return std::string( _output_names.get( index ) );
+  }
+
+private:
+  uint64_t signal_slot( signal const& s ) const
+  {
+    if constexpr ( std::is_same_v<signal, node> )
+    {
+      return Ntk::node_to_index( s );
+    }
+    else
+    {
+      return ( static_cast<uint64_t>( Ntk::node_to_index( Ntk::get_node( s ) ) ) << 1 ) | ( Ntk::is_complemented( s ) ? 1u : 0u );
+    }
+  }
+
+  /* callback in the network events, identified by the view that registered it */
+  struct delete_event
+  {
+    names_view* view;
+
+    void operator()( node const& n ) const
+    {
+      const auto index = static_cast<uint64_t>( view->node_to_index( n ) );
+      if constexpr ( std::is_same_v<signal, node> )
+      {
+        view->_signal_names->erase( index );
+      }
+      else
+      {
+        view->_signal_names->erase( index << 1 );
+        view->_signal_names->erase( ( index << 1 ) | 1u );
+      }
+    }
+  };
+
+  void register_events()
+  {
+    Ntk::events().on_delete.push_back( delete_event{this} );
+  }
+
+  void unregister_events()
+  {
+    auto& on_delete = Ntk::events().on_delete;
+    on_delete.erase( std::remove_if( on_delete.begin(), on_delete.end(), [this]( auto const& fn ) {
+                       const auto event = fn.template target<delete_event>();
+                       return event != nullptr && event->view == this;
+                     } ),
+                     on_delete.end() );
   }
 
 private:
-  std::map<signal, std::string> _signal_names;
-  std::map<uint32_t, std::string> _output_names;
+  std::shared_ptr<detail::name_table> _signal_names;
+  detail::name_table _output_names;
 }; /* names_view */
 
 template<class T>
@@ -34,15 +34,16 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <unordered_map>
 #include <vector>
-#include <set>
 #include <cassert>
 
 #include "../traits.hpp"
 #include "../networks/detail/foreach.hpp"
+#include "detail/node_marks.hpp"
 #include "immutable_view.hpp"
 
+#include <sparsepp/spp.h>
+
 namespace mockturtle
 {
 
@@ -114,8 +115,8 @@ public:
 
   inline bool is_pi( node const& pi ) const
   {
-    const auto beg = _nodes.begin() + _num_constants;
-    return std::find( beg, beg + _num_leaves, pi ) != beg + _num_leaves;
+    const auto it = _node_to_index.find( pi );
+    return it != _node_to_index.end() && it->second >= _num_constants && it->second < _num_constants + _num_leaves;
   }
 
   template<typename Fn>
@@ -148,6 +149,13 @@ public:
   }
 
 private:
+  /* during construction, a node is in the window if and only if it is
+     marked with the current traversal ID */
+  inline bool in_window( node const& n ) const
+  {
+    return this->visited( n ) == this->trav_id();
+  }
+
   void add_node( node const& n )
   {
     _node_to_index[n] = _nodes.size();
@@ -155,7 +163,7 @@ private:
 
     auto fanout_counter = 0;
     this->foreach_fanin( n, [&]( const auto& f ) {
-        if ( std::find( _nodes.begin(), _nodes.end(), this->get_node( f ) ) != _nodes.end() )
+        if ( in_window( this->get_node( f ) ) )
         {
           fanout_counter++;
         }
@@ -178,20 +186,24 @@ private:
 
   void extend( Ntk const& ntk )
   {
-    std::set<node> new_nodes;
+    /* a node can only become part of the window when one of its fanins
+       was added, hence only the fanouts of the nodes added in the last
+       round are candidates */
+    std::vector<node> new_nodes;
+    auto begin = 0u;
     do
     {
       new_nodes.clear();
-      for ( const auto& n : _nodes )
+      const auto end = static_cast<uint32_t>( _nodes.size() );
+      for ( auto i = begin; i < end; ++i )
       {
-        ntk.foreach_fanout( n, [&]( auto const& p ){
-            /* skip node if it is already in _nodes */
-            if ( std::find( _nodes.begin(), _nodes.end(), p ) != _nodes.end() ) return;
+        ntk.foreach_fanout( _nodes[i], [&]( auto const& p ){
+            /* skip node if it is already in the window */
+            if ( in_window( p ) ) return;
 
             auto all_children_in_nodes = true;
             ntk.foreach_fanin( p, [&]( auto const& s ){
-                auto const& child = ntk.get_node( s );
-                if ( std::find( _nodes.begin(), _nodes.end(), child ) == _nodes.end() )
+                if ( !in_window( ntk.get_node( s ) ) )
                 {
                   all_children_in_nodes = false;
                   return false;
@@ -202,14 +214,17 @@ private:
             if ( all_children_in_nodes )
             {
               assert( p != 0 );
-              assert( !is_pi( p ) );
-              new_nodes.insert( p );
+              new_nodes.push_back( p );
             }
           });
       }
+      begin = end;
 
+      std::sort( new_nodes.begin(), new_nodes.end() );
+      new_nodes.erase( std::unique( new_nodes.begin(), new_nodes.end() ), new_nodes.end() );
       for ( const auto& n : new_nodes )
       {
+        this->set_visited( n, this->trav_id() );
         add_node( n );
       }
     } while ( !new_nodes.empty() );
@@ -217,36 +232,28 @@ private:
 
   void add_roots( Ntk const& ntk )
   {
-    /* compute po nodes */
-    std::vector<node> pos;
+    /* mark po nodes */
+    auto& pos = detail::window_node_marks();
+    pos.reset( ntk.size() );
     ntk.foreach_po( [&]( auto const& s ){
-        pos.push_back( ntk.get_node( s ) );
+        pos.insert( ntk.node_to_index( ntk.get_node( s ) ) );
       });
 
-    /* compute window outputs */
+    /* compute window outputs, every node is visited once, so each root
+       is added at most once */
     for ( const auto& n : _nodes )
     {
-      // if ( ntk.is_constant( n ) || ntk.is_pi( n ) ) continue;
-
-      if ( std::find( pos.begin(), pos.end(), n ) != pos.end() )
+      if ( pos.contains( ntk.node_to_index( n ) ) )
       {
-        auto s = this->make_signal( n );
-        if ( std::find( _roots.begin(), _roots.end(), s ) == _roots.end() )
-        {
-          _roots.push_back( s );
-        }
+        _roots.push_back( this->make_signal( n ) );
         continue;
       }
 
       ntk.foreach_fanout( n, [&]( auto const& p ){
-          if ( std::find( _nodes.begin(), _nodes.end(), p ) == _nodes.end() )
+          if ( !in_window( p ) )
           {
-            auto s = this->make_signal( n );
-            if ( std::find( _roots.begin(), _roots.end(), s ) == _roots.end() )
-            {
-              _roots.push_back( s );
-              return false;
-            }
+            _roots.push_back( this->make_signal( n ) );
+            return false;
           }
           return true;
       });
@@ -257,7 +264,7 @@ public:
   unsigned _num_constants{1};
   unsigned _num_leaves{0};
   std::vector<node> _nodes;
-  std::unordered_map<node, uint32_t> _node_to_index;
+  spp::sparse_hash_map<node, uint32_t> _node_to_index;
   std::vector<signal> _roots;
   std::vector<unsigned> _fanout_size;
 };
@@ -224,3 +224,84 @@ TEST_CASE( "cleanup LUT network with nested constant propagation", "[cleanup]" )
     CHECK( ( i == 0 ? ntk.get_constant( false ) : a ) == f );
   });
 }
+
+template<class Ntk>
+Ntk network_with_dead_nodes()
+{
+  Ntk ntk;
+
+  const auto a = ntk.create_pi();
+  const auto b = ntk.create_pi();
+  const auto c = ntk.create_pi();
+
+  const auto f1 = ntk.create_and( a, b );
+  const auto f2 = ntk.create_xor( f1, c );
+  const auto f3 = ntk.create_or( f2, a );
+  ntk.create_po( f3 );
+  ntk.create_po( f1 );
+
+  /* dangling node */
+  ntk.create_nand( a, c );
+
+  /* remove MFFC of f2 */
+  ntk.substitute_node( ntk.get_node( f2 ), ntk.create_and( b, c ) );
+
+  return ntk;
+}
+
+template<class Ntk>
+void test_compact_network()
+{
+  auto ntk = network_with_dead_nodes<Ntk>();
+
+  const auto expected = simulate<kitty::static_truth_table<3>>( ntk );
+  const auto cleaned = cleanup_dangling( ntk );
+  const auto f1 = ntk.get_node( ntk.po_at( 1 ) );
+
+  node_map<uint32_t, Ntk> index( ntk );
+  ntk.foreach_node( [&]( auto const& n ) { index[n] = static_cast<uint32_t>( ntk.node_to_index( n ) ); } );
+
+  const auto remap = compact_network( ntk );
+
+  CHECK( ntk.size() == cleaned.size() );
+  CHECK( ntk.num_gates() == cleaned.num_gates() );
+  CHECK( ntk.num_pis() == 3u );
+  CHECK( ntk.num_pos() == 2u );
+  CHECK( simulate<kitty::static_truth_table<3>>( ntk ) == expected );
+
+  /* fanout sizes are recomputed */
+  std::vector<uint32_t> fanouts( ntk.size(), 0u );
+  ntk.foreach_gate( [&]( auto const& n ) {
+    ntk.foreach_fanin( n, [&]( auto const& f ) { fanouts[ntk.get_node( f )]++; } );
+  } );
+  ntk.foreach_po( [&]( auto const& f ) { fanouts[ntk.get_node( f )]++; } );
+  ntk.foreach_node( [&]( auto const& n ) {
+    CHECK( !ntk.is_dead( n ) );
+    CHECK( ntk.fanout_size( n ) == fanouts[n] );
+  } );
+
+  /* structural hashing finds existing gates */
+  const auto size = ntk.size();
+  CHECK( ntk.create_and( ntk.make_signal( ntk.pi_at( 0 ) ), ntk.make_signal( ntk.pi_at( 1 ) ) ) == ntk.po_at( 1 ) );
+  CHECK( ntk.size() == size );
+  CHECK( remap[f1] == ntk.get_node( ntk.po_at( 1 ) ) );
+
+  const auto compacted = compact_node_map( ntk, index, remap );
+  ntk.foreach_node( [&]( auto const& n ) { CHECK( remap[compacted[n]] == n ); } );
+
+  /* keep dangling nodes */
+  auto ntk2 = network_with_dead_nodes<Ntk>();
+  compact_network_params ps;
+  ps.remove_dangling = false;
+  compact_network( ntk2, ps );
+  CHECK( ntk2.size() > cleaned.size() );
+  CHECK( simulate<kitty::static_truth_table<3>>( ntk2 ) == expected );
+}
+
+TEST_CASE( "compact networks in-place", "[cleanup]" )
+{
+  test_compact_network<aig_network>();
+  test_compact_network<xag_network>();
+  test_compact_network<mig_network>();
+  test_compact_network<xmg_network>();
+}
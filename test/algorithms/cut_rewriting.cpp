@@ -1,12 +1,24 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
 #include <mockturtle/algorithms/cut_rewriting.hpp>
+#include <mockturtle/algorithms/equivalence_checking.hpp>
+#include <mockturtle/algorithms/miter.hpp>
 #include <mockturtle/algorithms/node_resynthesis/akers.hpp>
 #include <mockturtle/algorithms/node_resynthesis/exact.hpp>
 #include <mockturtle/algorithms/node_resynthesis/mig_npn.hpp>
+#include <mockturtle/algorithms/node_resynthesis/xag_npn.hpp>
 #include <mockturtle/algorithms/node_resynthesis/xmg3_npn.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xag.hpp>
 #include <mockturtle/networks/xmg.hpp>
 #include <mockturtle/traits.hpp>
 
@@ -75,6 +87,92 @@ TEST_CASE( "Cut rewriting with Akers synthesis", "[cut_rewriting]" )
   CHECK( mig.num_gates() == 1 );
 }
 
+TEST_CASE( "Parallel cut rewriting of bad MAJ", "[cut_rewriting]" )
+{
+  mig_network mig;
+  const auto a = mig.create_pi();
+  const auto b = mig.create_pi();
+  const auto c = mig.create_pi();
+
+  const auto f = mig.create_maj( a, mig.create_maj( a, b, c ), c );
+  mig.create_po( f );
+
+  mig_npn_resynthesis resyn;
+  cut_rewriting_params ps;
+  ps.num_threads = 2u;
+  ps.partition_size = 1u;
+  cut_rewriting( mig, resyn, ps );
+
+  mig = cleanup_dangling( mig );
+
+  CHECK( mig.size() == 5 );
+  CHECK( mig.num_pis() == 3 );
+  CHECK( mig.num_pos() == 1 );
+  CHECK( mig.num_gates() == 1 );
+}
+
+/* XAG with redundant structures spread over several partitions */
+static xag_network redundant_xag()
+{
+  xag_network xag;
+  std::vector<xag_network::signal> pis( 6u );
+  std::generate( pis.begin(), pis.end(), [&]() { return xag.create_pi(); } );
+
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    const auto a = pis[i], b = pis[( i + 1 ) % 6], c = pis[( i + 2 ) % 6];
+    xag.create_po( xag.create_xor( xag.create_and( a, b ), xag.create_and( a, !c ) ) );
+    xag.create_po( xag.create_and( xag.create_xor( a, b ), xag.create_xor( b, !c ) ) );
+  }
+  return xag;
+}
+
+/* records the threads that call each copy of the rewriting function */
+struct recording_resynthesis
+{
+  using calls_t = std::map<recording_resynthesis const*, std::set<std::thread::id>>;
+
+  xag_npn_resynthesis<xag_network> resyn;
+  std::shared_ptr<std::mutex> mutex{std::make_shared<std::mutex>()};
+  std::shared_ptr<calls_t> calls{std::make_shared<calls_t>()};
+
+  template<typename LeavesIterator, typename Fn>
+  void operator()( xag_network& ntk, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn )
+  {
+    {
+      std::lock_guard<std::mutex> lock( *mutex );
+      ( *calls )[this].insert( std::this_thread::get_id() );
+    }
+    resyn( ntk, function, begin, end, fn );
+  }
+};
+
+TEST_CASE( "Parallel cut rewriting of XAG", "[cut_rewriting]" )
+{
+  auto xag = redundant_xag();
+  const auto orig = cleanup_dangling( xag );
+
+  recording_resynthesis resyn;
+  cut_rewriting_params ps;
+  ps.cut_enumeration_ps.cut_size = 4u;
+  ps.num_threads = 4u;
+  ps.partition_size = 8u;
+  cut_rewriting( xag, resyn, ps );
+
+  xag = cleanup_dangling( xag );
+
+  CHECK( xag.num_gates() < orig.num_gates() );
+  CHECK( *equivalence_checking( *miter<xag_network>( orig, xag ) ) );
+
+  /* every worker has its own copy */
+  CHECK( !resyn.calls->empty() );
+  CHECK( resyn.calls->count( &resyn ) == 0u );
+  for ( auto const& [fn, threads] : *resyn.calls )
+  {
+    CHECK( threads.size() == 1u );
+  }
+}
+
 TEST_CASE( "Cut rewriting from constant", "[cut_rewriting]" )
 {
   mig_network mig;
@@ -1,9 +1,12 @@
 #include <catch.hpp>
 
+#include <algorithm>
 #include <vector>
 
 #include <mockturtle/algorithms/dont_cares.hpp>
 #include <mockturtle/networks/aig.hpp>
+#include <mockturtle/views/depth_view.hpp>
+#include <mockturtle/views/fanout_view.hpp>
 
 using namespace mockturtle;
 
@@ -57,3 +60,94 @@ TEST_CASE( "SDCs in simple AIG using satisfiability checker", "[dont_cares]" )
   CHECK( !checker.is_dont_care( aig.get_node( f3 ), std::vector<bool>{{true, false}} ) );
   CHECK( checker.is_dont_care( aig.get_node( f3 ), std::vector<bool>{{true, true}} ) );
 }
+
+TEST_CASE( "SDCs in simple AIG using windowed don't cares", "[dont_cares]" )
+{
+  aig_network aig;
+  auto a = aig.create_pi();
+  auto b = aig.create_pi();
+  auto f1 = aig.create_and( a, b );
+  auto f2 = aig.create_and( a, !b );
+  auto f3 = aig.create_and( f1, f2 );
+  aig.create_po( f3 );
+
+  windowed_dont_cares_params ps;
+  windowed_dont_cares_stats st;
+  windowed_dont_cares<aig_network> dcs( aig, ps, st );
+
+  const auto care = dcs.care( {aig.get_node( f1 ), aig.get_node( f2 )} );
+  CHECK( care._bits[0] == 0x7u );
+  CHECK( st.num_queries == 1u );
+  CHECK( st.num_exhaustive == 1u );
+  CHECK( st.num_dont_cares == 1u );
+}
+
+TEST_CASE( "ODCs in simple AIG using windowed don't cares", "[dont_cares]" )
+{
+  aig_network aig;
+  auto a = aig.create_pi();
+  auto b = aig.create_pi();
+  auto f1 = aig.create_and( a, b );
+  auto f2 = aig.create_and( a, !b );
+  auto f3 = aig.create_and( f1, f2 );
+  aig.create_po( f3 );
+
+  depth_view depth_aig{aig};
+  fanout_view fanout_aig{depth_aig};
+
+  windowed_dont_cares_params ps;
+  ps.max_tfo_levels = 1u;
+  windowed_dont_cares_stats st;
+  windowed_dont_cares dcs( fanout_aig, ps, st );
+
+  std::vector<node<aig_network>> leaves{{aig.get_node( a ), aig.get_node( b )}};
+  CHECK( dcs.care( aig.get_node( f1 ), leaves )._bits[0] == 0x2u );
+  CHECK( dcs.care( aig.get_node( f2 ), leaves )._bits[0] == 0x8u );
+
+  /* without fanout levels only satisfiability don't cares remain */
+  ps.max_tfo_levels = 0u;
+  CHECK( dcs.care( aig.get_node( f1 ), leaves )._bits[0] == 0xfu );
+}
+
+TEST_CASE( "Sampled SDCs confirmed by SAT", "[dont_cares]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> xs( 8u );
+  std::generate( xs.begin(), xs.end(), [&]() { return aig.create_pi(); } );
+
+  /* chains of majority and parity functions over reconvergent inputs */
+  auto m = xs[0], p = xs[0];
+  for ( auto i = 1u; i + 1u < xs.size(); ++i )
+  {
+    m = aig.create_maj( m, xs[i], xs[i + 1u] );
+    p = aig.create_xor( p, aig.create_and( xs[i], m ) );
+    aig.create_po( p );
+  }
+  aig.create_po( m );
+
+  /* a single simulation word covers at most 6 window inputs */
+  windowed_dont_cares_params ps;
+  ps.num_words = 1u;
+  ps.max_sat_calls = 64u;
+  windowed_dont_cares_stats st;
+  windowed_dont_cares<aig_network> dcs( aig, ps, st );
+
+  aig.foreach_gate( [&]( auto const& n ) {
+    std::vector<node<aig_network>> leaves;
+    aig.foreach_fanin( n, [&]( auto const& f ) {
+      aig.foreach_fanin( aig.get_node( f ), [&]( auto const& g ) {
+        leaves.push_back( aig.get_node( g ) );
+      } );
+    } );
+    std::sort( leaves.begin(), leaves.end() );
+    leaves.erase( std::unique( leaves.begin(), leaves.end() ), leaves.end() );
+    if ( leaves.size() < 2u )
+      return;
+
+    CHECK( dcs.care( leaves ) == ~satisfiability_dont_cares( aig, leaves, 12u ) );
+  } );
+
+  CHECK( st.num_exhaustive < st.num_queries );
+  CHECK( st.num_sat_calls > 0u );
+  CHECK( st.num_unresolved == 0u );
+}
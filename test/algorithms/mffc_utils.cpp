@@ -0,0 +1,124 @@
+#include <catch.hpp>
+
+#include <vector>
+
+#include <mockturtle/algorithms/detail/mffc_utils.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+
+using namespace mockturtle;
+
+template<class Ntk>
+static void check_against_recursive_mffc_size( Ntk const& ntk )
+{
+  ntk.clear_values();
+  ntk.foreach_node( [&]( auto const& n ) { ntk.set_value( n, ntk.fanout_size( n ) ); } );
+
+  detail::mffc_engine<Ntk> mffcs( ntk );
+  mffcs.compute_all();
+
+  ntk.foreach_node( [&]( auto const& n ) {
+    const auto expected = detail::mffc_size( ntk, n );
+    CHECK( mffcs.size( n ) == expected );
+    CHECK( mffcs.mffc_size( n ) == expected );
+    CHECK( mffcs.collect( n ).size() == expected );
+  } );
+
+  /* reference counters are restored */
+  ntk.foreach_node( [&]( auto const& n ) {
+    CHECK( mffcs.size( n ) == mffcs.mffc_size( n ) );
+  } );
+}
+
+/* full adder with shared XOR, a reconvergent AND tree, and a dangling node */
+template<class Ntk>
+static Ntk mffc_network()
+{
+  Ntk ntk;
+  const auto a = ntk.create_pi();
+  const auto b = ntk.create_pi();
+  const auto c = ntk.create_pi();
+  const auto d = ntk.create_pi();
+
+  const auto x1 = ntk.create_xor( a, b );
+  const auto sum = ntk.create_xor( x1, c );
+  const auto carry = ntk.create_or( ntk.create_and( a, b ), ntk.create_and( x1, c ) );
+  const auto g1 = ntk.create_and( c, d );
+  const auto g2 = ntk.create_and( g1, a );
+  const auto g3 = ntk.create_and( !g1, b );
+  ntk.create_po( sum );
+  ntk.create_po( carry );
+  ntk.create_po( ntk.create_or( g2, g3 ) );
+  ntk.create_po( g2 );
+
+  ntk.create_and( a, d );
+  return ntk;
+}
+
+TEST_CASE( "MFFC engine agrees with recursive MFFC size", "[mffc_utils]" )
+{
+  check_against_recursive_mffc_size( mffc_network<aig_network>() );
+  check_against_recursive_mffc_size( mffc_network<mig_network>() );
+}
+
+TEST_CASE( "MFFC engine after substitution", "[mffc_utils]" )
+{
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  const auto f1 = aig.create_and( a, b );
+  const auto f2 = aig.create_and( f1, c );
+  aig.create_po( f2 );
+
+  /* f2 now has a fanin with a larger index */
+  const auto g1 = aig.create_and( a, c );
+  const auto g2 = aig.create_and( g1, b );
+  aig.substitute_node( aig.get_node( f1 ), g2 );
+  REQUIRE( aig.is_dead( aig.get_node( f1 ) ) );
+  REQUIRE( aig.get_node( f2 ) < aig.get_node( g2 ) );
+
+  detail::mffc_engine<aig_network> mffcs( aig );
+  mffcs.compute_all();
+  CHECK( mffcs.mffc_size( aig.get_node( f2 ) ) == 3u );
+  CHECK( mffcs.mffc_size( aig.get_node( g2 ) ) == 2u );
+  CHECK( mffcs.root( aig.get_node( g1 ) ) == aig.get_node( f2 ) );
+
+  check_against_recursive_mffc_size( aig );
+}
+
+TEST_CASE( "label MFFCs of a small AIG", "[mffc_utils]" )
+{
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  const auto f1 = aig.create_and( a, b );
+  const auto f2 = aig.create_and( f1, c );
+  const auto f3 = aig.create_and( !f1, !c );
+  const auto f4 = aig.create_or( f2, f3 );
+  const auto f5 = aig.create_and( f2, a );
+  aig.create_po( f4 );
+  aig.create_po( f5 );
+
+  detail::mffc_engine<aig_network> mffcs( aig );
+  mffcs.compute_all();
+
+  const auto n = [&]( auto const& f ) { return aig.get_node( f ); };
+
+  CHECK( mffcs.mffc_size( n( f5 ) ) == 1u );
+  CHECK( mffcs.mffc_size( n( f4 ) ) == 2u );
+  CHECK( mffcs.mffc_size( n( f2 ) ) == 1u );
+  CHECK( mffcs.mffc_size( n( f1 ) ) == 1u );
+  CHECK( mffcs.mffc_size( n( a ) ) == 0u );
+
+  /* f1 is shared by f2 and f3, f2 is shared by f4 and f5 */
+  CHECK( mffcs.dominator( n( f3 ) ) == n( f4 ) );
+  CHECK( mffcs.dominator( n( f2 ) ) == n( f2 ) );
+  CHECK( mffcs.dominator( n( f1 ) ) == n( f1 ) );
+  CHECK( mffcs.root( n( f3 ) ) == n( f4 ) );
+  CHECK( mffcs.root( n( f4 ) ) == n( f4 ) );
+
+  const auto& nodes = mffcs.collect( n( f4 ) );
+  CHECK( nodes == std::vector<node<aig_network>>{n( f4 ), n( f3 )} );
+}
@@ -5,6 +5,7 @@
 #include <mockturtle/algorithms/node_resynthesis.hpp>
 #include <mockturtle/algorithms/node_resynthesis/akers.hpp>
 #include <mockturtle/algorithms/node_resynthesis/direct.hpp>
+#include <mockturtle/algorithms/node_resynthesis/exact.hpp>
 #include <mockturtle/algorithms/node_resynthesis/mig_npn.hpp>
 #include <mockturtle/algorithms/node_resynthesis/xmg_npn.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
@@ -360,3 +361,94 @@ TEST_CASE( "Node resynthesis with direct synthesis", "[node_resynthesis]" )
     CHECK( simulate<kitty::dynamic_truth_table>( xmg, {3u} )[0] == tt );
   }
 }
+
+/* 24 3-input LUTs with 8 distinct functions in 5 NPN classes */
+static klut_network repeated_functions()
+{
+  klut_network klut;
+  std::vector<klut_network::signal> signals;
+  for ( auto i = 0u; i < 4u; ++i )
+  {
+    signals.push_back( klut.create_pi() );
+  }
+
+  const std::vector<std::string> functions = {"e8", "96", "80", "d4", "2b", "69", "ca", "1e"};
+  for ( auto i = 0u; i < 24u; ++i )
+  {
+    kitty::dynamic_truth_table tt( 3u );
+    kitty::create_from_hex_string( tt, functions[i % 8] );
+    const auto n = signals.size();
+    signals.push_back( klut.create_node( {signals[n - 1], signals[n - 2 - i % 2], signals[n - 4]}, tt ) );
+  }
+  klut.create_po( signals.back() );
+  klut.create_po( signals[signals.size() - 5] );
+  return klut;
+}
+
+TEST_CASE( "Node resynthesis with parallel presynthesis", "[node_resynthesis]" )
+{
+  const auto klut = repeated_functions();
+
+  const auto resynthesize = [&]( uint32_t num_threads ) {
+    exact_resynthesis_params eps;
+    eps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+    exact_aig_resynthesis<aig_network> resyn( false, eps );
+
+    node_resynthesis_params ps;
+    ps.num_threads = num_threads;
+    node_resynthesis_stats st;
+    const auto aig = node_resynthesis<aig_network>( klut, resyn, ps, &st );
+    CHECK( eps.cache->size() == 8u );
+    if ( num_threads > 1u )
+    {
+      CHECK( st.num_functions == 8u );
+    }
+    return aig;
+  };
+
+  const auto aig1 = resynthesize( 1u );
+  const auto aig4 = resynthesize( 4u );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 4u );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig4, sim ) == simulate<kitty::dynamic_truth_table>( klut, sim ) );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig1, sim ) == simulate<kitty::dynamic_truth_table>( klut, sim ) );
+  CHECK( aig1.num_gates() == aig4.num_gates() );
+}
+
+TEST_CASE( "Node resynthesis with function cache", "[node_resynthesis]" )
+{
+  const auto klut = repeated_functions();
+
+  mig_npn_resynthesis resyn;
+  default_simulator<kitty::dynamic_truth_table> sim( 4u );
+  const auto expected = simulate<kitty::dynamic_truth_table>( klut, sim );
+
+  node_resynthesis_params ps;
+  ps.cache_functions = true;
+  node_resynthesis_stats st;
+  const auto mig1 = node_resynthesis<mig_network>( klut, resyn, ps, &st );
+  CHECK( st.num_templates == 8u );
+  CHECK( st.num_template_hits == 16u );
+  CHECK( simulate<kitty::dynamic_truth_table>( mig1, sim ) == expected );
+  CHECK( mig1.num_gates() == node_resynthesis<mig_network>( klut, resyn ).num_gates() );
+
+  ps.cache_npn_classes = true;
+  node_resynthesis_stats st2;
+  const auto mig2 = node_resynthesis<mig_network>( klut, resyn, ps, &st2 );
+  CHECK( st2.num_templates == 5u );
+  CHECK( st2.num_template_hits == 19u );
+  CHECK( simulate<kitty::dynamic_truth_table>( mig2, sim ) == expected );
+
+  /* presynthesis only resynthesizes the class representatives */
+  exact_resynthesis_params eps;
+  eps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+  exact_aig_resynthesis<aig_network> exact( false, eps );
+  ps.num_threads = 4u;
+  node_resynthesis_stats st3;
+  const auto aig = node_resynthesis<aig_network>( klut, exact, ps, &st3 );
+  CHECK( st3.num_functions == 8u );
+  CHECK( st3.num_classes == 5u );
+  CHECK( eps.cache->size() == 5u );
+  CHECK( st3.num_templates == 5u );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig, sim ) == expected );
+}
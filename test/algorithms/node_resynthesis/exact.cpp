@@ -1,11 +1,16 @@
 #include <catch.hpp>
 
+#include <cstdio>
+#include <fstream>
+
 #include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operators.hpp>
 
 #include <mockturtle/algorithms/node_resynthesis/exact.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/xag.hpp>
 
 using namespace mockturtle;
@@ -100,3 +105,133 @@ TEST_CASE( "Exact XAG for XOR", "[exact]" )
   CHECK( xag.num_gates() == 1u );
   CHECK( simulate<kitty::dynamic_truth_table>( xag, sim )[0] == _xor );
 }
+
+TEST_CASE( "Exact LUT networks with persistent cache", "[exact]" )
+{
+  const std::string filename = "exact_lut.cache";
+  std::remove( filename.c_str() );
+
+  std::vector<kitty::dynamic_truth_table> functions;
+  for ( auto const& hex : {"e8", "17", "d4", "96", "69", "80", "7f", "2b"} )
+  {
+    kitty::dynamic_truth_table tt( 3u );
+    kitty::create_from_hex_string( tt, hex );
+    functions.push_back( tt );
+  }
+
+  const auto resynthesize_all = [&]( exact_resynthesis_params const& ps ) {
+    exact_resynthesis<klut_network> resyn( 2u, ps );
+    for ( auto const& function : functions )
+    {
+      klut_network klut;
+      std::vector<klut_network::signal> pis = {klut.create_pi(), klut.create_pi(), klut.create_pi()};
+      resyn( klut, function, pis.begin(), pis.end(), [&]( auto const& f ) {
+        klut.create_po( f );
+      } );
+
+      default_simulator<kitty::dynamic_truth_table> sim( 3u );
+      CHECK( klut.num_pos() == 1u );
+      CHECK( simulate<kitty::dynamic_truth_table>( klut, sim )[0] == function );
+    }
+  };
+
+  {
+    exact_resynthesis_params ps;
+    ps.persistent_cache = std::make_shared<exact_synthesis_cache>( filename );
+    CHECK( ps.persistent_cache->is_open() );
+    resynthesize_all( ps );
+
+    /* the functions are in the NPN classes of MAJ, XOR, and AND */
+    CHECK( ps.persistent_cache->num_entries() == 3u );
+    CHECK( ps.persistent_cache->num_misses() == 3u );
+    CHECK( ps.persistent_cache->num_hits() == 5u );
+  }
+
+  {
+    exact_resynthesis_params ps;
+    ps.persistent_cache = std::make_shared<exact_synthesis_cache>( filename );
+    CHECK( ps.persistent_cache->num_entries() == 3u );
+    resynthesize_all( ps );
+    CHECK( ps.persistent_cache->num_misses() == 0u );
+    CHECK( ps.persistent_cache->num_hits() == 8u );
+  }
+
+  /* corrupt the payload of the first record and leave a torn record */
+  {
+    std::fstream file( filename, std::ios::in | std::ios::out | std::ios::binary );
+    file.seekp( 16 + 8 );
+    file.put( '\xff' );
+    file.seekp( 0, std::ios::end );
+    file.write( "\x40\x00\x00\x00", 4 );
+  }
+
+  {
+    exact_resynthesis_params ps;
+    ps.persistent_cache = std::make_shared<exact_synthesis_cache>( filename );
+    CHECK( ps.persistent_cache->num_entries() == 2u );
+    resynthesize_all( ps );
+    CHECK( ps.persistent_cache->num_misses() == 1u );
+    CHECK( ps.persistent_cache->num_entries() == 3u );
+  }
+
+  {
+    exact_resynthesis_params ps;
+    ps.persistent_cache = std::make_shared<exact_synthesis_cache>( filename );
+    CHECK( ps.persistent_cache->num_entries() == 3u );
+    resynthesize_all( ps );
+    CHECK( ps.persistent_cache->num_misses() == 0u );
+  }
+
+  /* files of another format version are not used */
+  {
+    std::fstream file( filename, std::ios::in | std::ios::out | std::ios::binary );
+    file.seekp( 8 );
+    file.put( '\x02' );
+  }
+
+  {
+    exact_resynthesis_params ps;
+    ps.persistent_cache = std::make_shared<exact_synthesis_cache>( filename );
+    CHECK( !ps.persistent_cache->is_open() );
+    CHECK( ps.persistent_cache->num_entries() == 0u );
+    resynthesize_all( ps );
+    CHECK( ps.persistent_cache->num_entries() == 0u );
+  }
+
+  std::remove( filename.c_str() );
+}
+
+TEST_CASE( "Exact AIG with don't cares and persistent cache", "[exact]" )
+{
+  const std::string filename = "exact_aig.cache";
+  std::remove( filename.c_str() );
+
+  exact_resynthesis_params ps;
+  ps.persistent_cache = std::make_shared<exact_synthesis_cache>( filename );
+  exact_aig_resynthesis<aig_network> resyn( false, ps );
+
+  for ( auto i = 0u; i < 2u; ++i )
+  {
+    for ( auto const& [hex, dc_hex] : std::vector<std::pair<std::string, std::string>>{{"e8", "81"}, {"d4", "24"}, {"96", "c0"}, {"69", "03"}} )
+    {
+      kitty::dynamic_truth_table function( 3u ), dont_cares( 3u );
+      kitty::create_from_hex_string( function, hex );
+      kitty::create_from_hex_string( dont_cares, dc_hex );
+
+      aig_network aig;
+      std::vector<aig_network::signal> pis = {aig.create_pi(), aig.create_pi(), aig.create_pi()};
+      resyn( aig, function, dont_cares, pis.begin(), pis.end(), [&]( auto const& f ) {
+        aig.create_po( f );
+      } );
+
+      default_simulator<kitty::dynamic_truth_table> sim( 3u );
+      CHECK( aig.num_pos() == 1u );
+      CHECK( ( simulate<kitty::dynamic_truth_table>( aig, sim )[0] & ~dont_cares ) == ( function & ~dont_cares ) );
+    }
+  }
+
+  CHECK( ps.persistent_cache->num_hits() >= 4u );
+  CHECK( ps.persistent_cache->num_entries() == ps.persistent_cache->num_misses() );
+
+  std::remove( filename.c_str() );
+}
@@ -0,0 +1,220 @@
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+
+#include <mockturtle/algorithms/cleanup.hpp>
+#include <mockturtle/algorithms/cut_rewriting.hpp>
+#include <mockturtle/algorithms/node_resynthesis/dsd.hpp>
+#include <mockturtle/algorithms/node_resynthesis/npn6.hpp>
+#include <mockturtle/algorithms/node_resynthesis/shannon.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xag.hpp>
+
+using namespace mockturtle;
+
+template<class Ntk, class Resyn>
+static std::vector<kitty::dynamic_truth_table> resynthesize_functions( Resyn& resyn, std::vector<kitty::dynamic_truth_table> const& functions )
+{
+  Ntk ntk;
+  std::vector<signal<Ntk>> pis;
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    pis.push_back( ntk.create_pi() );
+  }
+
+  for ( auto const& function : functions )
+  {
+    resyn( ntk, function, pis.begin(), pis.begin() + function.num_vars(), [&]( auto const& f ) {
+      ntk.create_po( f );
+      return false;
+    } );
+  }
+
+  std::vector<kitty::dynamic_truth_table> result;
+  default_simulator<kitty::dynamic_truth_table> sim( 6u );
+  for ( auto const& tt : simulate<kitty::dynamic_truth_table>( ntk, sim ) )
+  {
+    result.push_back( tt );
+  }
+  return result;
+}
+
+TEST_CASE( "NPN6 resynthesis with XAG database", "[npn6]" )
+{
+  std::vector<kitty::dynamic_truth_table> functions;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    kitty::dynamic_truth_table tt( 6u );
+    kitty::create_random( tt, i );
+    functions.push_back( tt );
+    functions.push_back( ~tt );
+    functions.push_back( kitty::flip( kitty::swap( tt, 1, 4 ), 2 ) );
+  }
+  kitty::dynamic_truth_table tt5( 5u );
+  kitty::create_from_hex_string( tt5, "e8e8e8e8" );
+  functions.push_back( tt5 );
+
+  shannon_resynthesis<xag_network> shannon;
+  dsd_resynthesis<xag_network, decltype( shannon )> fallback( shannon );
+
+  npn6_resynthesis<xag_network, xag_network, decltype( fallback )> resyn( fallback );
+  const auto result = resynthesize_functions<xag_network>( resyn, functions );
+
+  REQUIRE( result.size() == functions.size() );
+  for ( auto i = 0u; i < functions.size(); ++i )
+  {
+    CHECK( kitty::shrink_to( result[i], functions[i].num_vars() ) == functions[i] );
+  }
+
+  /* a function and its complement have the same representative */
+  const auto num_structures = resyn.database_network().num_pos();
+  CHECK( num_structures <= 17u );
+
+  /* structures of the database are reused in a second run */
+  npn6_resynthesis_stats st2;
+  {
+    npn6_resynthesis<xag_network, xag_network, decltype( fallback )> resyn2( fallback, {}, &st2 );
+    resyn2.add_structures( resyn.database_network() );
+    const auto result2 = resynthesize_functions<xag_network>( resyn2, functions );
+    for ( auto i = 0u; i < functions.size(); ++i )
+    {
+      CHECK( kitty::shrink_to( result2[i], functions[i].num_vars() ) == functions[i] );
+    }
+  }
+  CHECK( st2.num_lookups == functions.size() );
+  CHECK( st2.num_misses == 0u );
+  CHECK( st2.num_classes >= num_structures );
+}
+
+/* fall-back function which waits for another lookup before synthesizing */
+template<class Fn>
+struct blocking_resynthesis
+{
+  Fn& fn;
+  std::atomic<bool>& released;
+
+  template<typename LeavesIterator, typename Callback>
+  void operator()( xag_network& ntk, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Callback&& callback )
+  {
+    while ( !released )
+    {
+      std::this_thread::yield();
+    }
+    fn( ntk, function, begin, end, callback );
+  }
+};
+
+TEST_CASE( "NPN6 lookups while a miss is synthesized", "[npn6]" )
+{
+  kitty::dynamic_truth_table known( 6u ), unknown( 6u );
+  kitty::create_from_hex_string( known, "8000000000000000" );
+  kitty::create_random( unknown, 42u );
+
+  shannon_resynthesis<xag_network> shannon;
+  dsd_resynthesis<xag_network, decltype( shannon )> dsd( shannon );
+  std::atomic<bool> released{false};
+  blocking_resynthesis<decltype( dsd )> fallback{dsd, released};
+
+  npn6_resynthesis<xag_network, xag_network, decltype( fallback )> resyn( fallback );
+  released = true;
+  resynthesize_functions<xag_network>( resyn, {known} );
+  released = false;
+
+  std::vector<kitty::dynamic_truth_table> result;
+  std::thread miss( [&]() {
+    auto copy = resyn;
+    result = resynthesize_functions<xag_network>( copy, {unknown} );
+  } );
+
+  /* succeeds while the other thread is inside the fall-back function */
+  auto copy = resyn;
+  CHECK( resynthesize_functions<xag_network>( copy, {known} ) == std::vector<kitty::dynamic_truth_table>{known} );
+  released = true;
+  miss.join();
+  CHECK( result == std::vector<kitty::dynamic_truth_table>{unknown} );
+}
+
+TEST_CASE( "NPN6 resynthesis with MIG database", "[npn6]" )
+{
+  std::vector<kitty::dynamic_truth_table> functions;
+  for ( auto i = 0u; i < 4u; ++i )
+  {
+    kitty::dynamic_truth_table tt( 5u + i % 2 );
+    kitty::create_random( tt, i );
+    functions.push_back( tt );
+    functions.push_back( ~tt );
+  }
+
+  shannon_resynthesis<mig_network> fallback;
+
+  npn6_resynthesis_stats st;
+  {
+    npn6_resynthesis<mig_network, mig_network, decltype( fallback )> resyn( fallback, {}, &st );
+    const auto result = resynthesize_functions<mig_network>( resyn, functions );
+
+    REQUIRE( result.size() == functions.size() );
+    for ( auto i = 0u; i < functions.size(); ++i )
+    {
+      CHECK( kitty::shrink_to( result[i], functions[i].num_vars() ) == functions[i] );
+    }
+  }
+  CHECK( st.num_lookups == 8u );
+  CHECK( st.num_misses == 4u );
+  CHECK( st.num_failures == 0u );
+}
+
+TEST_CASE( "Cut rewriting with 6-input cuts and NPN6 resynthesis", "[npn6]" )
+{
+  xag_network xag;
+  std::vector<xag_network::signal> pis;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    pis.push_back( xag.create_pi() );
+  }
+
+  auto f = xag.create_and( pis[0], pis[1] );
+  for ( auto i = 2u; i < 8u; ++i )
+  {
+    f = i % 2 ? xag.create_or( f, xag.create_and( pis[i], pis[i - 1] ) ) : xag.create_xor( f, xag.create_and( pis[i], !pis[i - 2] ) );
+  }
+  xag.create_po( f );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 8u );
+  const auto expected = simulate<kitty::dynamic_truth_table>( xag, sim );
+
+  auto xag_parallel = cleanup_dangling( xag );
+
+  shannon_resynthesis<xag_network> shannon;
+  dsd_resynthesis<xag_network, decltype( shannon )> fallback( shannon );
+
+  npn6_resynthesis_stats st;
+  cut_rewriting_params ps;
+  ps.cut_enumeration_ps.cut_size = 6;
+  {
+    npn6_resynthesis<xag_network, xag_network, decltype( fallback )> resyn( fallback, {}, &st );
+    cut_rewriting( xag, resyn, ps );
+    xag = cleanup_dangling( xag );
+  }
+  CHECK( simulate<kitty::dynamic_truth_table>( xag, sim ) == expected );
+  CHECK( st.num_lookups > 0u );
+
+  /* the workers use copies, whose statistics are summed up */
+  npn6_resynthesis_stats st_parallel;
+  {
+    npn6_resynthesis<xag_network, xag_network, decltype( fallback )> resyn( fallback, {}, &st_parallel );
+    ps.num_threads = 2u;
+    cut_rewriting( xag_parallel, resyn, ps );
+    xag_parallel = cleanup_dangling( xag_parallel );
+  }
+  CHECK( simulate<kitty::dynamic_truth_table>( xag_parallel, sim ) == expected );
+  CHECK( st_parallel.num_lookups == st.num_lookups );
+  CHECK( st_parallel.num_classes > 0u );
+}
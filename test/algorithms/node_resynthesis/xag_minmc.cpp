@@ -0,0 +1,256 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+#include <kitty/print.hpp>
+#include <kitty/spectral.hpp>
+#include <kitty/static_truth_table.hpp>
+
+#include <mockturtle/algorithms/cleanup.hpp>
+#include <mockturtle/algorithms/cut_rewriting.hpp>
+#include <mockturtle/algorithms/detail/walsh_spectra.hpp>
+#include <mockturtle/algorithms/node_resynthesis/xag_minmc.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/xag.hpp>
+
+using namespace mockturtle;
+
+/* returns a path in the temporary directory that does not exist yet, such
+   that concurrent test runs do not share database files */
+static std::string unique_temp_file( std::string const& extension )
+{
+  std::random_device rd;
+  std::filesystem::path path;
+  do
+  {
+    path = std::filesystem::temp_directory_path() / ( "mockturtle_minmc_" + std::to_string( rd() ) + extension );
+  } while ( std::filesystem::exists( path ) );
+  return path.string();
+}
+
+static void write_minmc_text_database( std::string const& filename )
+{
+  const auto line = []( std::string const& name, kitty::static_truth_table<6> const& original, uint32_t mc, std::string const& circuit ) {
+    return name + "\t" + kitty::to_hex( original ) + "\t" + kitty::to_hex( kitty::exact_spectral_canonization( original ) ) + "\t" + std::to_string( mc ) + "\t" + circuit + "\n";
+  };
+
+  std::vector<kitty::static_truth_table<6>> xs( 3 );
+  for ( auto i = 0u; i < 3u; ++i )
+  {
+    kitty::create_nth_var( xs[i], i );
+  }
+
+  std::ofstream out( filename );
+  out << line( "and", xs[0] & xs[1], 1u, "2 2 4 0 6" );
+  out << line( "and3", xs[0] & xs[1] & xs[2], 2u, "3 2 4 0 6 8 0 10" );
+
+  /* majority is in the same spectral class as AND, only the first entry of a class is used */
+  out << line( "maj", kitty::ternary_majority( xs[0], xs[1], xs[2] ), 1u, "3 4 2 0 6 2 0 8 10 0 12 2 0 14" );
+}
+
+static std::vector<kitty::dynamic_truth_table> resynthesize_minmc( xag_minmc_resynthesis& resyn, std::vector<kitty::dynamic_truth_table> const& functions, uint32_t& num_gates )
+{
+  xag_network xag;
+  std::vector<xag_network::signal> pis;
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    pis.push_back( xag.create_pi() );
+  }
+
+  for ( auto const& function : functions )
+  {
+    resyn( xag, function, pis.begin(), pis.end(), [&]( auto const& f ) {
+      xag.create_po( f );
+    } );
+  }
+
+  num_gates = xag.num_gates();
+  default_simulator<kitty::dynamic_truth_table> sim( 6u );
+  return simulate<kitty::dynamic_truth_table>( xag, sim );
+}
+
+TEST_CASE( "XAG MC resynthesis with text and binary database", "[xag_minmc]" )
+{
+  const auto text_db = unique_temp_file( ".txt" );
+  const auto binary_db = unique_temp_file( ".bin" );
+  write_minmc_text_database( text_db );
+
+  std::vector<kitty::dynamic_truth_table> functions;
+  std::vector<kitty::dynamic_truth_table> xs( 6, kitty::dynamic_truth_table( 6u ) );
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    kitty::create_nth_var( xs[i], i );
+  }
+  functions.push_back( ( xs[2] ^ xs[3] ) & ~xs[1] );
+  functions.push_back( ~kitty::ternary_majority( xs[1], ~xs[4], xs[5] ) ^ xs[0] );
+  functions.push_back( xs[3] & xs[5] ^ xs[2] );
+  functions.push_back( kitty::ternary_majority( xs[0], xs[2], xs[4] ) );
+  functions.push_back( ~( xs[1] & ~xs[3] & xs[5] ) );
+
+  xag_minmc_resynthesis_params ps;
+  ps.verify_database = true;
+  xag_minmc_resynthesis_stats st;
+
+  uint32_t num_gates_text{0u};
+  {
+    xag_minmc_resynthesis resyn( text_db, ps, &st );
+    CHECK( resyn.database_size() == 2u );
+    CHECK( resynthesize_minmc( resyn, functions, num_gates_text ) == functions );
+    CHECK( resyn.write_database( binary_db ) );
+
+    /* the 4-input AND function is not in the database */
+    xag_network xag;
+    std::vector<xag_network::signal> pis( 6, xag.get_constant( false ) );
+    auto called = false;
+    resyn( xag, xs[0] & xs[1] & xs[2] & xs[3], pis.begin(), pis.end(), [&]( auto const& ) { called = true; } );
+    CHECK( !called );
+  }
+  CHECK( st.cache_misses == 6u );
+  CHECK( st.unknown_function_aborts == 1u );
+
+  uint32_t num_gates_binary{0u};
+  {
+    xag_minmc_resynthesis resyn( binary_db, ps, &st );
+    CHECK( resyn.database_size() == 2u );
+    CHECK( resynthesize_minmc( resyn, functions, num_gates_binary ) == functions );
+
+    /* copies share the classification cache */
+    auto copy = resyn;
+    uint32_t num_gates_copy{0u};
+    CHECK( resynthesize_minmc( copy, functions, num_gates_copy ) == functions );
+    CHECK( copy.st.cache_hits == functions.size() );
+  }
+  CHECK( num_gates_text == num_gates_binary );
+
+  /* a record whose literals are out of bounds rejects the database */
+  {
+    std::fstream file( binary_db, std::ios::binary | std::ios::in | std::ios::out );
+    const uint32_t literals_offset = 1000u;
+    file.seekp( 24 + 16 );
+    file.write( reinterpret_cast<char const*>( &literals_offset ), sizeof( literals_offset ) );
+  }
+  {
+    xag_minmc_resynthesis resyn( binary_db, ps );
+    CHECK( resyn.database_size() == 0u );
+  }
+
+  std::remove( text_db.c_str() );
+  std::remove( binary_db.c_str() );
+}
+
+TEST_CASE( "Spectral signatures are invariant in spectral classes", "[xag_minmc]" )
+{
+  std::vector<uint64_t> functions;
+  for ( auto i = 0u; i < 100u; ++i )
+  {
+    kitty::static_truth_table<6> tt;
+    kitty::create_random( tt, i );
+    functions.push_back( *tt.cbegin() );
+    functions.push_back( *kitty::exact_spectral_canonization_limit( tt, 10000 ).first.cbegin() );
+  }
+
+  const auto signatures = detail::spectral_signatures( functions );
+  for ( auto i = 0u; i < functions.size(); i += 2u )
+  {
+    CHECK( signatures[i] == signatures[i + 1] );
+  }
+
+  kitty::static_truth_table<6> a, b;
+  kitty::create_from_hex_string( a, "8888888888888888" );
+  kitty::create_from_hex_string( b, "6666666666666666" );
+  CHECK( detail::spectral_signatures( {*a.cbegin()} ) != detail::spectral_signatures( {*b.cbegin()} ) );
+}
+
+TEST_CASE( "XAG MC resynthesis with batched classification", "[xag_minmc]" )
+{
+  const auto text_db = unique_temp_file( ".txt" );
+  write_minmc_text_database( text_db );
+
+  std::vector<kitty::dynamic_truth_table> xs( 6, kitty::dynamic_truth_table( 6u ) );
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    kitty::create_nth_var( xs[i], i );
+  }
+  std::vector<kitty::dynamic_truth_table> functions;
+  functions.push_back( ( xs[2] ^ xs[3] ) & ~xs[1] );
+  functions.push_back( ~kitty::ternary_majority( xs[1], ~xs[4], xs[5] ) ^ xs[0] );
+  functions.push_back( xs[0] & xs[4] & ~xs[5] );
+  functions.push_back( xs[3] & xs[5] ^ xs[2] );
+
+  xag_minmc_resynthesis_stats st;
+  {
+    xag_minmc_resynthesis resyn( text_db, {}, &st );
+
+    auto batch = functions;
+    batch.push_back( functions.front() );
+    batch.push_back( xs[0] & xs[1] & xs[2] & xs[3] );
+    resyn.presynthesize( batch, 2u );
+
+    uint32_t num_gates{0u};
+    CHECK( resynthesize_minmc( resyn, functions, num_gates ) == functions );
+
+    xag_network xag;
+    std::vector<xag_network::signal> pis( 6, xag.get_constant( false ) );
+    auto called = false;
+    resyn( xag, xs[0] & xs[1] & xs[2] & xs[3], pis.begin(), pis.end(), [&]( auto const& ) { called = true; } );
+    CHECK( !called );
+  }
+  CHECK( st.presynthesized == functions.size() );
+  CHECK( st.signature_rejects == 1u );
+  CHECK( st.cache_hits == functions.size() + 1u );
+  CHECK( st.cache_misses == 0u );
+  CHECK( st.unknown_function_aborts == 1u );
+
+  /* cut rewriting presynthesizes all cut functions */
+  xag_network xag;
+  std::vector<xag_network::signal> pis;
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    pis.push_back( xag.create_pi() );
+  }
+  const auto f1 = xag.create_and( xag.create_and( pis[0], pis[1] ), pis[2] );
+  const auto f2 = xag.create_or( xag.create_and( pis[3], pis[4] ), xag.create_and( pis[3], pis[5] ) );
+  xag.create_po( xag.create_xor( f1, f2 ) );
+  xag.create_po( xag.create_and( f1, f2 ) );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 6u );
+  const auto expected = simulate<kitty::dynamic_truth_table>( xag, sim );
+
+  /* copy the storage, the first run rewrites `xag` in-place */
+  auto xag_parallel = cleanup_dangling( xag );
+  const auto size = xag_parallel.size();
+
+  xag_minmc_resynthesis resyn( text_db );
+  cut_rewriting_params ps;
+  ps.cut_enumeration_ps.cut_size = 6u;
+  cut_rewriting( xag, resyn, ps );
+  xag = cleanup_dangling( xag );
+
+  CHECK( simulate<kitty::dynamic_truth_table>( xag, sim ) == expected );
+  CHECK( resyn.st.presynthesized + resyn.st.signature_rejects > 0u );
+  CHECK( resyn.st.cache_misses == 0u );
+
+  /* the workers use copies, whose statistics are summed up */
+  xag_minmc_resynthesis_stats st_parallel;
+  CHECK( xag_parallel.size() == size );
+  {
+    xag_minmc_resynthesis resyn_parallel( text_db, {}, &st_parallel );
+    ps.num_threads = 2u;
+    cut_rewriting( xag_parallel, resyn_parallel, ps );
+    xag_parallel = cleanup_dangling( xag_parallel );
+  }
+  CHECK( simulate<kitty::dynamic_truth_table>( xag_parallel, sim ) == expected );
+  CHECK( st_parallel.cache_hits > 0u );
+  CHECK( st_parallel.cache_misses == 0u );
+
+  std::remove( text_db.c_str() );
+}
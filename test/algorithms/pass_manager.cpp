@@ -0,0 +1,157 @@
+#include <catch.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+
+#include <mockturtle/algorithms/node_resynthesis/mig_npn.hpp>
+#include <mockturtle/algorithms/pass_manager.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/views/depth_view.hpp>
+
+using namespace mockturtle;
+
+/* chains of majority and parity functions over reconvergent inputs */
+template<class Ntk>
+static Ntk chains( uint32_t num_pis )
+{
+  Ntk ntk;
+  std::vector<signal<Ntk>> xs( num_pis );
+  std::generate( xs.begin(), xs.end(), [&]() { return ntk.create_pi(); } );
+
+  auto m = xs[0], p = xs[0];
+  for ( auto i = 1u; i + 1u < xs.size(); ++i )
+  {
+    m = ntk.create_maj( m, xs[i], xs[i + 1u] );
+    p = ntk.create_xor( p, ntk.create_and( xs[i], m ) );
+    ntk.create_po( p );
+  }
+  ntk.create_po( m );
+  return ntk;
+}
+
+TEST_CASE( "Run a flow with the pass manager", "[pass_manager]" )
+{
+  auto mig = chains<mig_network>( 8u );
+
+  default_simulator<kitty::dynamic_truth_table> sim( mig.num_pis() );
+  const auto expected = simulate<kitty::dynamic_truth_table>( mig, sim );
+
+  const auto num_on_add = mig.events().on_add.size();
+
+  mig_npn_resynthesis resyn;
+  pass_manager<mig_network> pm;
+  cut_rewriting_params ps;
+  ps.cut_enumeration_ps.cut_size = 4u;
+  pm.add_pass( "rw", cut_rewriting_pass<mig_network>( resyn, ps ) );
+  refactoring_params rf_ps;
+  rf_ps.max_pis = 4u;
+  pm.add_pass( "rf", refactoring_pass<mig_network>( resyn, rf_ps ) );
+  pm.add_pass( "rs", resubstitution_pass<mig_network>() );
+  pm.add_pass( "b", depth_rewriting_pass<mig_network>() );
+  pm.add_pass( "cleanup", cleanup_pass<mig_network>() );
+
+  pass_manager_stats st;
+  CHECK( pm.run( mig, "rs; rw; cleanup; b;cleanup;rf ; rs; cleanup", &st ) );
+  CHECK( simulate<kitty::dynamic_truth_table>( mig, sim ) == expected );
+
+  REQUIRE( st.passes.size() == 8u );
+  CHECK( st.passes[0].name == "rs" );
+  CHECK( st.passes[2].name == "cleanup" );
+  CHECK( st.passes[2].changed == analysis::all );
+  CHECK( st.passes[7].gates_after == mig.num_gates() );
+  CHECK( mig.events().on_add.size() == num_on_add );
+
+  /* unknown passes are reported before anything is run */
+  const auto size = mig.size();
+  CHECK( !pm.run( mig, "rs; unknown", &st ) );
+  CHECK( mig.size() == size );
+}
+
+TEST_CASE( "Share analyses between passes", "[pass_manager]" )
+{
+  auto aig = chains<aig_network>( 6u );
+
+  std::vector<uint32_t> depths;
+
+  pass_manager<aig_network> pm;
+  pm.add_pass( "depth", [&]( aig_network& ntk, analysis_manager<aig_network>& am ) {
+    auto const& levels = am.levels();
+    CHECK( levels.depth() == depth_view<aig_network>( ntk ).depth() );
+    depths.push_back( levels.depth() );
+    return analysis::none;
+  } );
+  pm.add_pass( "touch", []( aig_network& ntk, analysis_manager<aig_network>& am ) {
+    CHECK( am.is_valid( analysis::levels ) );
+    auto const& levels = am.levels();
+    signal<aig_network> deepest;
+    ntk.foreach_po( [&]( auto const& f ) {
+      if ( levels.level( ntk.get_node( f ) ) == levels.depth() )
+      {
+        deepest = f;
+      }
+    } );
+    ntk.create_po( ntk.create_and( deepest, ntk.make_signal( ntk.pi_at( 0 ) ) ) );
+    return analysis::levels;
+  } );
+  pm.add_pass( "cleanup", cleanup_pass<aig_network>() );
+
+  pass_manager_stats st;
+  CHECK( pm.run( aig, "depth; depth; depth", &st ) );
+  CHECK( st.analysis_st.num_computed == 1u );
+  CHECK( st.analysis_st.num_reused == 2u );
+
+  depths.clear();
+  CHECK( pm.run( aig, "depth; touch; depth; cleanup; depth", &st ) );
+  CHECK( st.analysis_st.num_computed == 3u );
+  CHECK( st.analysis_st.num_reused == 1u );
+  REQUIRE( depths.size() == 3u );
+  CHECK( depths[1] == depths[0] + 1u );
+  CHECK( depths[2] == depths[1] );
+}
+
+TEST_CASE( "Detect modifications and release analyses", "[pass_manager]" )
+{
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  const auto f1 = aig.create_and( a, b );
+  const auto f2 = aig.create_and( a, f1 );
+  aig.create_po( aig.create_or( f2, c ) );
+
+  std::weak_ptr<decltype( aig._storage )::element_type> storage;
+
+  pass_manager<aig_network> pm;
+  pm.add_pass( "rs", resubstitution_pass<aig_network>() );
+  pm.add_pass( "remember", [&]( aig_network& ntk, analysis_manager<aig_network>& am ) {
+    am.levels();
+    storage = ntk._storage;
+    return analysis::none;
+  } );
+  pm.add_pass( "released", [&]( aig_network&, analysis_manager<aig_network>& ) {
+    CHECK( storage.expired() );
+    return analysis::none;
+  } );
+  pm.add_pass( "cleanup", cleanup_pass<aig_network>() );
+
+  pass_manager_stats st;
+  CHECK( pm.run( aig, "remember; rs; remember; cleanup; released", &st ) );
+  CHECK( aig.num_gates() == 2u );
+
+  /* resubstitution is detected */
+  CHECK( st.passes[1].gates_after < st.passes[1].gates_before );
+  CHECK( st.passes[1].changed == analysis::levels );
+  CHECK( st.analysis_st.num_computed == 2u );
+  CHECK( st.analysis_st.num_reused == 1u );
+
+  /* passes that do not modify the network keep the levels */
+  CHECK( pm.run( aig, "rs; remember; rs; remember", &st ) );
+  CHECK( st.passes[0].changed == analysis::none );
+  CHECK( st.analysis_st.num_computed == 1u );
+  CHECK( st.analysis_st.num_reused == 3u );
+}
@@ -6,6 +6,7 @@
 #include <mockturtle/algorithms/xmg_resub.hpp>
 #include <mockturtle/algorithms/cleanup.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xmg.hpp>
@@ -56,6 +57,71 @@ TEST_CASE( "Resubstitution of AIG", "[resubstitution]" )
   CHECK( aig.num_gates() == 1 );
 }
 
+TEST_CASE( "Resubstitution of AIG reuses divisor truth tables", "[resubstitution]" )
+{
+  aig_network aig;
+
+  /* parity chain, in which the windows of neighboring XORs overlap */
+  std::vector<aig_network::signal> xs( 8 );
+  std::generate( xs.begin(), xs.end(), [&]() { return aig.create_pi(); } );
+  auto f = xs[0];
+  for ( auto i = 1u; i < xs.size(); ++i )
+  {
+    f = aig.create_xor( f, xs[i] );
+    aig.create_po( f );
+  }
+
+  const auto tts = simulate<kitty::static_truth_table<8>>( aig );
+
+  resubstitution_params ps;
+  resubstitution_stats st;
+  aig_resubstitution( aig, ps, &st );
+  aig = cleanup_dangling( aig );
+
+  CHECK( simulate<kitty::static_truth_table<8>>( aig ) == tts );
+  CHECK( st.num_simulated_divisors > 0u );
+  CHECK( st.num_reused_divisors > 0u );
+}
+
+TEST_CASE( "Parallel resubstitution of AIG", "[resubstitution]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> xs( 16 );
+  std::generate( xs.begin(), xs.end(), [&]() { return aig.create_pi(); } );
+  for ( auto i = 0u; i + 1u < xs.size(); ++i )
+  {
+    /* redundant AND in the style of `Resubstitution of AIG`, which is also
+       used by the next one, such that candidates of later rounds depend on
+       nodes that were changed before */
+    auto const f = aig.create_and( xs[i], aig.create_and( xs[i + 1u], xs[i] ) );
+    aig.create_po( f );
+    xs[i + 1u] = aig.create_and( f, xs[i + 1u] );
+  }
+  aig.create_po( xs.back() );
+
+  const auto tts = simulate<kitty::static_truth_table<16>>( aig );
+  const auto num_gates = aig.num_gates();
+
+  auto sequential = cleanup_dangling( aig );
+  aig_resubstitution( sequential );
+  sequential = cleanup_dangling( sequential );
+
+  resubstitution_params ps;
+  ps.num_threads = 4u;
+  ps.batch_size = 4u;
+  resubstitution_stats st;
+  aig_resubstitution( aig, ps, &st );
+  aig = cleanup_dangling( aig );
+
+  CHECK( simulate<kitty::static_truth_table<16>>( aig ) == tts );
+  CHECK( aig.num_gates() + st.estimated_gain <= num_gates );
+
+  /* the snapshots of the workers follow the changes of earlier rounds, such
+     that almost all redundancies are found, although they overlap */
+  CHECK( aig.num_gates() <= sequential.num_gates() + 1u );
+}
+
 TEST_CASE( "Resubstitution of MIG", "[resubstitution]" )
 {
   mig_network mig;
@@ -172,3 +238,32 @@ TEST_CASE( "Resubstitution of XAG to minimize ANDs", "[resubstitution]" )
   CHECK( xag.num_pos() == 1 );
   CHECK( xag.num_gates() == 2 );
 }
+
+TEST_CASE( "Resubstitution of XAG with observability don't cares", "[resubstitution]" )
+{
+  xag_network xag;
+
+  const auto a = xag.create_pi();
+  const auto b = xag.create_pi();
+
+  /* the AND is only observable if b is 1, where it equals a */
+  const auto f = xag.create_or( xag.create_and( a, b ), xag.create_not( b ) );
+  xag.create_po( f );
+  CHECK( xag.num_gates() == 2 );
+
+  const auto tt = simulate<kitty::static_truth_table<2>>( xag )[0];
+
+  resubstitution_params ps;
+  ps.use_dont_cares = true;
+  ps.dont_cares_ps.max_tfo_levels = 1u;
+
+  using view_t = depth_view<fanout_view<xag_network>>;
+  fanout_view<xag_network> fanout_view{xag};
+  view_t resub_view{fanout_view};
+  resubstitution_minmc_withDC( resub_view, ps );
+
+  xag = cleanup_dangling( xag );
+
+  CHECK( simulate<kitty::static_truth_table<2>>( xag )[0] == tt );
+  CHECK( xag.num_gates() == 1 );
+}
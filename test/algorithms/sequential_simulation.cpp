@@ -0,0 +1,150 @@
+#include <catch.hpp>
+
+#include <vector>
+
+#include <mockturtle/algorithms/sequential_simulation.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/algorithms/unrolling.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xmg.hpp>
+
+using namespace mockturtle;
+
+/* 3-bit counter with enable input, outputs carry-out and lowest bit */
+template<class Ntk>
+static Ntk counter( int8_t reset2 = 0 )
+{
+  Ntk ntk;
+  const auto en = ntk.create_pi();
+  const auto r0 = ntk.create_ro();
+  const auto r1 = ntk.create_ro();
+  const auto r2 = ntk.create_ro();
+
+  const auto c0 = ntk.create_and( r0, en );
+  const auto c1 = ntk.create_and( r1, c0 );
+  ntk.create_po( ntk.create_and( r2, c1 ) );
+  ntk.create_po( r0 );
+
+  ntk.create_ri( ntk.create_xor( r0, en ), 0 );
+  ntk.create_ri( ntk.create_xor( r1, c0 ), 0 );
+  ntk.create_ri( ntk.create_xor( r2, c1 ), reset2 );
+  return ntk;
+}
+
+template<class Ntk>
+static void check_counter()
+{
+  const auto ntk = counter<Ntk>();
+
+  sequential_simulation_params ps;
+  ps.num_words = 2u;
+  sequential_simulator sim( ntk, ps );
+
+  std::vector<uint32_t> state( 128u, 0u );
+  sim.run( 20u, [&]( uint32_t frame ) {
+    CHECK( sim.frame() == frame + 1u );
+    for ( auto t = 0u; t < 128u; ++t )
+    {
+      const bool en = ( sim.pi_word( 0u, t >> 6 ) >> ( t & 63 ) ) & 1;
+      CHECK( sim.po_value( 0u, t ) == ( en && state[t] == 7u ) );
+      CHECK( sim.po_value( 1u, t ) == ( state[t] & 1u ) );
+      state[t] = ( state[t] + ( en ? 1u : 0u ) ) & 7u;
+      for ( auto r = 0u; r < 3u; ++r )
+      {
+        CHECK( sim.register_value( r, t ) == ( ( state[t] >> r ) & 1u ) );
+      }
+    }
+  } );
+
+  /* always enabled */
+  sim.reset();
+  for ( auto i = 0u; i < 10u; ++i )
+  {
+    sim.step( {~uint64_t( 0 ), ~uint64_t( 0 )} );
+    CHECK( sim.po_word( 0u, 1u ) == ( i == 7u ? ~uint64_t( 0 ) : 0u ) );
+    CHECK( sim.register_word( 0u, 0u ) == ( ( i + 1u ) & 1u ? ~uint64_t( 0 ) : 0u ) );
+  }
+}
+
+TEST_CASE( "sequential simulation of a counter", "[sequential_simulation]" )
+{
+  check_counter<aig_network>();
+  check_counter<mig_network>();
+  check_counter<xmg_network>();
+  check_counter<klut_network>();
+}
+
+TEST_CASE( "sequential simulation with reset values", "[sequential_simulation]" )
+{
+  const auto one = counter<aig_network>( 1 );
+  sequential_simulator sim_one( one );
+  CHECK( sim_one.register_word( 0u, 0u ) == 0u );
+  CHECK( sim_one.register_word( 2u, 0u ) == ~uint64_t( 0 ) );
+
+  const auto unknown = counter<aig_network>( 2 );
+  sequential_simulator sim_unknown( unknown );
+  const auto w = sim_unknown.register_word( 2u, 0u );
+  CHECK( w != 0u );
+  CHECK( w != ~uint64_t( 0 ) );
+
+  sequential_simulation_params ps;
+  ps.random_unknown_reset = false;
+  sequential_simulator sim_zero( unknown, ps );
+  CHECK( sim_zero.register_word( 2u, 0u ) == 0u );
+}
+
+TEST_CASE( "unroll a counter", "[sequential_simulation]" )
+{
+  const auto aig = counter<aig_network>( 2 );
+  const auto unrolled = unroll( aig, 9u );
+
+  CHECK( unrolled.is_combinational() );
+  CHECK( unrolled.num_pis() == 1u + 9u );
+  CHECK( unrolled.num_pos() == 2u * 9u );
+
+  /* unknown reset of r2 is PI 0, enable of frame f is PI 1 + f */
+  for ( auto r2 = 0u; r2 < 2u; ++r2 )
+  {
+    std::vector<bool> assignment( unrolled.num_pis(), true );
+    assignment[0] = r2 == 1u;
+    const auto values = simulate<bool>( unrolled, default_simulator<bool>( assignment ) );
+
+    uint32_t state = r2 << 2;
+    for ( auto f = 0u; f < 9u; ++f )
+    {
+      CHECK( values[2u * f] == ( state == 7u ) );
+      CHECK( values[2u * f + 1u] == ( state & 1u ) );
+      state = ( state + 1u ) & 7u;
+    }
+  }
+
+  /* compare against sequential simulation */
+  const auto reset = counter<aig_network>();
+  unrolling_params ps;
+  ps.final_state_as_pos = true;
+  const auto unrolled_reset = unroll( reset, 5u, ps );
+  CHECK( unrolled_reset.num_pis() == 5u );
+  CHECK( unrolled_reset.num_pos() == 2u * 5u + 3u );
+
+  sequential_simulator sim( reset );
+  std::vector<std::vector<bool>> pos( 64u );
+  std::vector<std::vector<bool>> assignments( 64u );
+  sim.run( 5u, [&]( uint32_t ) {
+    for ( auto t = 0u; t < 64u; ++t )
+    {
+      assignments[t].push_back( ( sim.pi_word( 0u, 0u ) >> t ) & 1 );
+      pos[t].push_back( sim.po_value( 0u, t ) );
+      pos[t].push_back( sim.po_value( 1u, t ) );
+    }
+  } );
+  for ( auto t = 0u; t < 64u; ++t )
+  {
+    for ( auto r = 0u; r < 3u; ++r )
+    {
+      pos[t].push_back( sim.register_value( r, t ) );
+    }
+    CHECK( simulate<bool>( unrolled_reset, default_simulator<bool>( assignments[t] ) ) == pos[t] );
+  }
+}
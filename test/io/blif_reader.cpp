@@ -10,6 +10,7 @@
 #include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/algorithms/node_resynthesis.hpp>
 #include <mockturtle/algorithms/node_resynthesis/mig_npn.hpp>
+#include <mockturtle/views/names_view.hpp>
 
 #include <kitty/kitty.hpp>
 #include <lorina/blif.hpp>
@@ -224,3 +225,121 @@ TEST_CASE( "read a BLIF file containing latch declaration bug that requires upda
   CHECK( klut.num_latches() == 3 );
   CHECK( klut.num_gates() == 9 );
 }
+
+TEST_CASE( "read BLIF files with the fast reader", "[blif_reader]" )
+{
+  std::string comb{
+    "# comment\n"
+    ".model top\n"
+    ".inputs a b c d \\\n"
+    "  e f g h\n"
+    ".outputs y1 y2 y3 y4 y5\n"
+    ".names n2 y1\n"
+    "0 1\n"
+    ".names a b n1 # gate\n"
+    "11 1\n"
+    ".names c n1 n2\n"
+    "1- 1\n"
+    "-1 1\n"
+    ".names a b c d e f g h y2\n"
+    "1-1-1-1- 1\n"
+    "-1-1-1-1 1\n"
+    "0000000- 1\n"
+    ".names a c e y3\n"
+    "1-1 0\n"
+    "-00 0\n"
+    ".names one\n"
+    "1\n"
+    ".names zero\n"
+    ".names one zero y4\n"
+    "10 1\n"
+    ".names h y5\n"
+    "1 1\n"
+    ".end\n"};
+
+  klut_network klut;
+  CHECK( read_blif_fast( comb.data(), comb.size(), klut ) == lorina::return_code::success );
+  CHECK( klut.num_pis() == 8u );
+  CHECK( klut.num_pos() == 5u );
+
+  std::vector<kitty::dynamic_truth_table> xs( 8u, kitty::dynamic_truth_table( 8u ) );
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    kitty::create_nth_var( xs[i], i );
+  }
+  const auto one = ~xs[0].construct();
+  const std::vector<kitty::dynamic_truth_table> expected{
+      ~( xs[2] | ( xs[0] & xs[1] ) ),
+      ( xs[0] & xs[2] & xs[4] & xs[6] ) | ( xs[1] & xs[3] & xs[5] & xs[7] ) | ~( xs[0] | xs[1] | xs[2] | xs[3] | xs[4] | xs[5] | xs[6] ),
+      ~( ( xs[0] & xs[4] ) | ( ~xs[2] & ~xs[4] ) ),
+      one,
+      xs[7]};
+
+  default_simulator<kitty::dynamic_truth_table> sim( klut.num_pis() );
+  CHECK( simulate<kitty::dynamic_truth_table>( klut, sim ) == expected );
+
+  std::string seq{
+    ".model top\n"
+    ".inputs clock a b c\n"
+    ".outputs f\n"
+    ".names li1 a li0\n"
+    "01 1\n"
+    ".names lo0 n1 li1\n"
+    "01 1\n"
+    ".names a lo1 n1\n"
+    "01 1\n"
+    ".names c n1 li2\n"
+    "00 1\n"
+    ".names li1 lo2 f\n"
+    "00 1\n"
+    ".latch li0 lo0 fe clock 0\n"
+    ".latch li1 lo1 1\n"
+    ".latch li2 lo2 xx clock 2\n"
+    ".end\n"};
+
+  klut_network seq_klut;
+  CHECK( read_blif_fast( seq.data(), seq.size(), seq_klut ) == lorina::return_code::success );
+  CHECK( seq_klut.num_pis() == 4u );
+  CHECK( seq_klut.num_pos() == 1u );
+  CHECK( seq_klut.num_latches() == 3u );
+  CHECK( seq_klut.num_gates() == 5u );
+
+  seq_klut.foreach_ro( [&]( auto ro, auto i ) {
+    latch_info l_info = seq_klut._storage->latch_information[ro];
+    CHECK( l_info.control == "clock" );
+    CHECK( l_info.type == std::vector<std::string>{"fe", "re", "as"}[i] );
+    CHECK( l_info.init == std::vector<uint64_t>{0u, 1u, 2u}[i] );
+  } );
+
+  /* register input names follow the outputs, also if .outputs comes last */
+  std::string late_outputs{
+    ".model top\n"
+    ".inputs a\n"
+    ".latch li0 lo0 0\n"
+    ".latch li1 lo1 0\n"
+    ".outputs y1 y2\n"
+    ".names a lo1 li0\n"
+    "11 1\n"
+    ".names lo0 li1\n"
+    "0 1\n"
+    ".names lo0 y1\n"
+    "1 1\n"
+    ".names lo1 y2\n"
+    "1 1\n"
+    ".end\n"};
+
+  names_view<klut_network> named_klut;
+  CHECK( read_blif_fast( late_outputs.data(), late_outputs.size(), named_klut ) == lorina::return_code::success );
+  CHECK( named_klut.num_pos() == 2u );
+  CHECK( named_klut.get_output_name( 0u ) == "y1" );
+  CHECK( named_klut.get_output_name( 1u ) == "y2" );
+  CHECK( named_klut.get_output_name( 2u ) == "li0" );
+  CHECK( named_klut.get_output_name( 3u ) == "li1" );
+
+  /* undefined signals and cycles are reported */
+  klut_network error_klut;
+  std::string undefined{".inputs a\n.outputs y\n.names a b y\n11 1\n.end\n"};
+  CHECK( read_blif_fast( undefined.data(), undefined.size(), error_klut ) == lorina::return_code::parse_error );
+  std::string cycle{".inputs a\n.outputs y\n.names a z y\n11 1\n.names y z\n1 1\n.end\n"};
+  CHECK( read_blif_fast( cycle.data(), cycle.size(), error_klut ) == lorina::return_code::parse_error );
+}
@@ -0,0 +1,290 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/snapshot.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xag.hpp>
+#include <mockturtle/networks/xmg.hpp>
+#include <mockturtle/views/fanout_view.hpp>
+#include <mockturtle/views/names_view.hpp>
+
+using namespace mockturtle;
+
+/* full adder and a shared AND */
+template<class Ntk>
+static Ntk full_adder()
+{
+  Ntk ntk;
+  const auto a = ntk.create_pi();
+  const auto b = ntk.create_pi();
+  const auto c = ntk.create_pi();
+  const auto g = ntk.create_and( a, b );
+  const auto x = ntk.create_xor( a, b );
+  ntk.create_po( ntk.create_xor( x, c ) );
+  ntk.create_po( ntk.create_or( g, ntk.create_and( x, c ) ) );
+  ntk.create_po( !g );
+  return ntk;
+}
+
+template<class Ntk>
+static void check_round_trip()
+{
+  const auto ntk = full_adder<Ntk>();
+
+  std::vector<char> buffer;
+  write_snapshot( ntk, buffer );
+
+  Ntk restored;
+  REQUIRE( read_snapshot( buffer.data(), buffer.size(), restored ) );
+  CHECK( restored._storage->hash.is_deferred() );
+  CHECK( restored.size() == ntk.size() );
+  CHECK( restored.num_pis() == ntk.num_pis() );
+  CHECK( restored.num_pos() == ntk.num_pos() );
+  CHECK( restored.num_gates() == ntk.num_gates() );
+
+  default_simulator<kitty::dynamic_truth_table> sim( ntk.num_pis() );
+  CHECK( simulate<kitty::dynamic_truth_table>( restored, sim ) == simulate<kitty::dynamic_truth_table>( ntk, sim ) );
+
+  /* structural hashing finds existing gates after restoring */
+  restored.foreach_gate( [&]( auto const& n ) {
+    std::vector<signal<Ntk>> children;
+    restored.foreach_fanin( n, [&]( auto const& f ) { children.push_back( f ); } );
+    if constexpr ( std::is_same_v<Ntk, mig_network> || std::is_same_v<Ntk, xmg_network> )
+    {
+      if ( restored.is_maj( n ) )
+      {
+        CHECK( restored.get_node( restored.create_maj( children[0], children[1], children[2] ) ) == n );
+      }
+    }
+    else
+    {
+      if ( restored.is_and( n ) )
+      {
+        CHECK( restored.get_node( restored.create_and( children[0], children[1] ) ) == n );
+      }
+    }
+  } );
+  CHECK( !restored._storage->hash.is_deferred() );
+  CHECK( restored.size() == ntk.size() );
+  CHECK( restored.num_gates() == ntk.num_gates() );
+
+  /* snapshots of restored networks are identical */
+  std::vector<char> buffer2;
+  write_snapshot( restored, buffer2 );
+  CHECK( buffer == buffer2 );
+}
+
+TEST_CASE( "save and restore networks with snapshots", "[snapshot]" )
+{
+  check_round_trip<aig_network>();
+  check_round_trip<mig_network>();
+  check_round_trip<xag_network>();
+  check_round_trip<xmg_network>();
+}
+
+TEST_CASE( "copy deferred hash tables from several threads", "[snapshot]" )
+{
+  const auto aig = full_adder<aig_network>();
+  std::vector<char> buffer;
+  write_snapshot( aig, buffer );
+
+  aig_network restored;
+  REQUIRE( read_snapshot( buffer.data(), buffer.size(), restored ) );
+  REQUIRE( restored._storage->hash.is_deferred() );
+
+  auto const& st = *restored._storage;
+  std::vector<uint64_t> sizes( 4u );
+  std::vector<std::thread> threads;
+  for ( auto i = 0u; i < 4u; ++i )
+  {
+    threads.emplace_back( [&st, &sizes, i]() {
+      const auto copy = st;
+      sizes[i] = copy.hash.size();
+    } );
+  }
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  for ( auto const& size : sizes )
+  {
+    CHECK( size == aig._storage->hash.size() );
+  }
+  CHECK( !restored._storage->hash.is_deferred() );
+
+  /* const lookups fill the table as well */
+  aig_network other;
+  REQUIRE( read_snapshot( buffer.data(), buffer.size(), other ) );
+  auto const& hash = other._storage->hash;
+  CHECK( hash.count( aig._storage->nodes[4] ) == 1u );
+  CHECK( hash.find( aig._storage->nodes[4] ) != hash.end() );
+  CHECK( !hash.is_deferred() );
+}
+
+TEST_CASE( "save and restore k-LUT networks with snapshots", "[snapshot]" )
+{
+  klut_network klut;
+  const auto a = klut.create_pi();
+  const auto b = klut.create_pi();
+  const auto c = klut.create_pi();
+
+  kitty::dynamic_truth_table tt( 3u );
+  kitty::create_from_hex_string( tt, "e8" );
+  const auto f1 = klut.create_node( {a, b, c}, tt );
+  const auto f2 = klut.create_and( f1, c );
+  const auto f3 = klut.create_node( {a, f2, b}, ~tt );
+  klut.create_po( f3 );
+  klut.create_po( f2 );
+
+  const auto filename = std::string( "snapshot_test.mts" );
+  write_snapshot( klut, filename );
+
+  klut_network restored;
+  REQUIRE( read_snapshot( filename, restored ) );
+  std::remove( filename.c_str() );
+
+  CHECK( restored.size() == klut.size() );
+  CHECK( restored.num_gates() == klut.num_gates() );
+  CHECK( restored.node_function( f1 ) == tt );
+  CHECK( restored.node_function( f3 ) == ~tt );
+
+  default_simulator<kitty::dynamic_truth_table> sim( klut.num_pis() );
+  CHECK( simulate<kitty::dynamic_truth_table>( restored, sim ) == simulate<kitty::dynamic_truth_table>( klut, sim ) );
+
+  CHECK( restored.create_and( f1, c ) == f2 );
+  CHECK( restored.create_node( {a, b, c}, tt ) == f1 );
+  CHECK( restored.size() == klut.size() );
+}
+
+TEST_CASE( "save and restore sequential named networks with snapshots", "[snapshot]" )
+{
+  names_view<aig_network> aig;
+  const auto a = aig.create_pi( "a" );
+  const auto b = aig.create_pi( "b" );
+  const auto r = aig.create_ro( "r" );
+  const auto f = aig.create_and( a, r );
+  aig.set_name( !f, "nf" );
+  aig.create_po( aig.create_or( f, b ), "y" );
+  aig.create_ri( f, 1, "r_in" );
+  aig._storage->latch_information[aig.get_node( r )] = latch_info{"clk", 1, "re"};
+
+  std::vector<char> buffer;
+  write_snapshot( aig, buffer );
+
+  names_view<aig_network> restored;
+  REQUIRE( read_snapshot( buffer.data(), buffer.size(), restored ) );
+
+  CHECK( restored.num_pis() == 2u );
+  CHECK( restored.num_pos() == 1u );
+  CHECK( restored.num_latches() == 1u );
+  CHECK( restored.latch_reset( 0 ) == 1 );
+  CHECK( restored._storage->latch_information[aig.get_node( r )].control == "clk" );
+  CHECK( restored._storage->latch_information[aig.get_node( r )].type == "re" );
+  CHECK( restored.get_name( a ) == "a" );
+  CHECK( restored.get_name( b ) == "b" );
+  CHECK( restored.get_name( !f ) == "nf" );
+  CHECK( !restored.has_name( f ) );
+  CHECK( restored.get_output_name( 0 ) == "y" );
+
+  /* invalid data is rejected */
+  aig_network other;
+  CHECK( !read_snapshot( buffer.data(), buffer.size() - 1u, other ) );
+  CHECK( !read_snapshot( buffer.data(), 4u, other ) );
+  CHECK( other.size() == 1u );
+
+  mig_network mig;
+  CHECK( !read_snapshot( buffer.data(), buffer.size(), mig ) );
+}
+
+template<class Ntk, class Fn>
+static bool read_corrupted( Fn&& corrupt )
+{
+  auto ntk = full_adder<Ntk>();
+  corrupt( *ntk._storage );
+
+  std::vector<char> buffer;
+  write_snapshot( ntk, buffer );
+
+  Ntk restored;
+  const auto result = read_snapshot( buffer.data(), buffer.size(), restored );
+  CHECK( ( result || restored.size() == 1u ) );
+  return result;
+}
+
+TEST_CASE( "reject corrupted snapshots", "[snapshot]" )
+{
+  CHECK( read_corrupted<aig_network>( []( auto& ) {} ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.nodes.back().children[1].index = st.nodes.size(); } ) );
+  CHECK( !read_corrupted<mig_network>( []( auto& st ) { st.nodes.back().children[2].index = st.nodes.size(); } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.nodes.back().children[1] = st.nodes.back().children[0]; } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.inputs[1] = st.nodes.size(); } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.inputs[1] = st.inputs[0]; } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.inputs[1] = st.nodes.size() - 1u; } ) );
+  CHECK( !read_corrupted<xag_network>( []( auto& st ) { st.nodes[st.inputs[2]].children[0].data = 7u; } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.outputs[0].index = st.nodes.size(); } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { ++st.data.num_pis; } ) );
+  CHECK( !read_corrupted<xmg_network>( []( auto& st ) { ++st.data.num_pos; } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.data.latches.push_back( 0 ); } ) );
+  CHECK( !read_corrupted<aig_network>( []( auto& st ) { st.latch_information[st.nodes.size()] = latch_info{}; } ) );
+
+  /* k-LUT functions must exist and match the number of fanins */
+  const auto klut_corrupted = []( auto&& corrupt ) {
+    klut_network klut;
+    const auto a = klut.create_pi();
+    const auto b = klut.create_pi();
+    klut.create_po( klut.create_and( a, b ) );
+    corrupt( *klut._storage );
+
+    std::vector<char> buffer;
+    write_snapshot( klut, buffer );
+    klut_network restored;
+    return read_snapshot( buffer.data(), buffer.size(), restored );
+  };
+  CHECK( klut_corrupted( []( auto& ) {} ) );
+  CHECK( !klut_corrupted( []( auto& st ) { st.nodes.back().data[1].h1 = 2u * st.data.cache.size(); } ) );
+  CHECK( !klut_corrupted( []( auto& st ) { st.nodes.back().children.pop_back(); } ) );
+  CHECK( !klut_corrupted( []( auto& st ) { st.nodes.back().children[0].index = st.nodes.size(); } ) );
+  CHECK( !klut_corrupted( []( auto& st ) { st.outputs[0].index = st.nodes.size(); } ) );
+
+  /* snapshots with a flipped bit are rejected or give a network whose indexes are in range */
+  const auto aig = full_adder<names_view<aig_network>>();
+  std::vector<char> buffer;
+  write_snapshot( aig, buffer );
+  for ( auto i = 0u; i < 8u * buffer.size(); ++i )
+  {
+    auto corrupted = buffer;
+    corrupted[i >> 3] ^= static_cast<char>( 1 << ( i & 7 ) );
+
+    names_view<aig_network> restored;
+    if ( read_snapshot( corrupted.data(), corrupted.size(), restored ) )
+    {
+      fanout_view<names_view<aig_network>> fanouts( restored );
+      uint32_t num_edges{0};
+      fanouts.foreach_gate( [&]( auto const& n ) {
+        fanouts.foreach_fanout( n, [&]( auto const& ) { ++num_edges; } );
+      } );
+      CHECK( num_edges <= 2u * restored.num_gates() + restored.num_pos() );
+      restored.foreach_po( [&]( auto const& f ) {
+        CHECK( restored.get_node( f ) < restored.size() );
+        if ( restored.is_ci( restored.get_node( f ) ) )
+        {
+          CHECK( restored.ci_index( restored.get_node( f ) ) < restored.num_cis() );
+        }
+      } );
+
+      std::vector<char> buffer2;
+      write_snapshot( restored, buffer2 );
+      names_view<aig_network> restored2;
+      CHECK( read_snapshot( buffer2.data(), buffer2.size(), restored2 ) );
+    }
+  }
+}
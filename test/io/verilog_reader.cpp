@@ -1,11 +1,16 @@
 #include <catch.hpp>
 
+#include <random>
 #include <sstream>
 #include <string>
 
 #include <mockturtle/io/verilog_reader.hpp>
+#include <mockturtle/io/write_verilog.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
+#include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xag.hpp>
+#include <mockturtle/networks/xmg.hpp>
 #include <mockturtle/algorithms/cleanup.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
 
@@ -102,3 +107,115 @@ TEST_CASE( "read a VERILOG file to create large Montgomery multiplier", "[verilo
   CHECK( xag.num_pos() == 384u );
   CHECK( xag.num_gates() == 909459u );
 }
+
+TEST_CASE( "read a VERILOG file with the fast reader", "[verilog_reader]" )
+{
+  std::string file{
+    "// comment ; with a semicolon\n"
+    "module top( y1, y2, y3, a, b, c ) ;\n"
+    "  input a , b , c ;\n"
+    "  output y1 , y2 ;\n"
+    "  output [1:0] y3 ;\n"
+    "  wire zero, g0, g1 , g2 , g3 , g4 ;\n"
+    "  assign y1 = g3 ;\n"
+    "  assign g3 = a | g2 ; /* defined after use; */\n"
+    "  assign zero = 0 ;\n"
+    "  assign g0 = a ;\n"
+    "  assign g1 = ~c ;\n"
+    "  assign g2 = g0 & g1 ;\n"
+    "  assign g4 = ( ~a & b ) | ( ~a & c ) | ( b & c ) ;\n"
+    "  assign y2 = g4 ;\n"
+    "  nand g5 ( y3[0] , a , b , ~c ) ;\n"
+    "  xor ( y3[1], ~( a | zero ), b ^ c ) ;\n"
+    "endmodule\n"
+    "module other( x ) ;\n"
+    "  unsupported x ;\n"
+    "endmodule\n"};
+
+  for ( auto num_threads : {1u, 4u} )
+  {
+    mig_network mig;
+    CHECK( read_verilog_fast( file.data(), file.size(), mig, nullptr, num_threads ) == lorina::return_code::success );
+
+    CHECK( mig.num_pis() == 3 );
+    CHECK( mig.num_pos() == 4 );
+
+    default_simulator<kitty::dynamic_truth_table> sim( mig.num_pis() );
+    const auto tts = simulate<kitty::dynamic_truth_table>( mig, sim );
+    CHECK( kitty::to_hex( tts[0] ) == "aa" );
+    CHECK( kitty::to_hex( tts[1] ) == "d4" );
+    CHECK( kitty::to_hex( tts[2] ) == "f7" );
+    CHECK( kitty::to_hex( tts[3] ) == "69" );
+
+    /* the majority expression is a single gate */
+    CHECK( mig.is_maj( mig.get_node( mig.po_at( 1 ) ) ) );
+    CHECK( mig.fanout_size( mig.get_node( mig.po_at( 1 ) ) ) == 1u );
+  }
+}
+
+template<class Ntk>
+static void check_fast_verilog_round_trip( uint32_t bitwidth )
+{
+  Ntk ntk;
+  std::vector<signal<Ntk>> a( bitwidth ), b( bitwidth );
+  std::generate( a.begin(), a.end(), [&]() { return ntk.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return ntk.create_pi(); } );
+  for ( auto const& f : carry_ripple_multiplier( ntk, a, b ) )
+  {
+    ntk.create_po( f );
+  }
+
+  std::ostringstream out;
+  write_verilog( ntk, out );
+  const auto file = out.str();
+
+  std::vector<Ntk> reads;
+  for ( auto num_threads : {0u, 1u, 3u, 8u} )
+  {
+    auto& read = reads.emplace_back();
+    CHECK( read_verilog_fast( file.data(), file.size(), read, nullptr, num_threads ) == lorina::return_code::success );
+    CHECK( read.num_gates() == ntk.num_gates() );
+  }
+
+  /* compare under random input assignments */
+  std::mt19937 rng( 42u );
+  for ( auto round = 0u; round < 16u; ++round )
+  {
+    std::vector<bool> assignment( ntk.num_pis() );
+    std::generate( assignment.begin(), assignment.end(), [&]() { return rng() & 1u; } );
+    default_simulator<bool> sim( assignment );
+    const auto expected = simulate<bool>( ntk, sim );
+    for ( auto const& read : reads )
+    {
+      CHECK( simulate<bool>( read, sim ) == expected );
+    }
+  }
+}
+
+TEST_CASE( "read VERILOG files in parallel with the fast reader", "[verilog_reader]" )
+{
+  /* large enough to be split into several chunks */
+  check_fast_verilog_round_trip<aig_network>( 32u );
+  check_fast_verilog_round_trip<mig_network>( 24u );
+  check_fast_verilog_round_trip<xmg_network>( 24u );
+}
+
+TEST_CASE( "report errors in the fast VERILOG reader", "[verilog_reader]" )
+{
+  const auto read = []( std::string const& body ) {
+    const auto file = "module top( a, b, y ) ;\n  input a, b ;\n  output y ;\n" + body + "endmodule\n";
+    aig_network aig;
+    return read_verilog_fast( file.data(), file.size(), aig );
+  };
+
+  CHECK( read( "  assign y = a & b ;\n" ) == lorina::return_code::success );
+  CHECK( read( "  assign y = a & c ;\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  assign y = a & t ;\n  assign t = y ;\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  assign y = a & b ;\n  assign y = a ;\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  assign y = a & ;\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  assign x = a ;\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  ripple_carry_adder #(8) add1(.x1(a), .x2(b), .y(y));\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  input [x:0] c ;\n  assign y = a & b ;\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  input [99999999999:0] c ;\n  assign y = a & b ;\n" ) == lorina::return_code::parse_error );
+  CHECK( read( "  input [1:0] c ;\n  assign y = a & c[1] ;\n" ) == lorina::return_code::success );
+}
@@ -0,0 +1,120 @@
+#include <catch.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <lorina/aiger.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/aiger_reader.hpp>
+#include <mockturtle/io/write_aiger.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/views/names_view.hpp>
+
+using namespace mockturtle;
+
+/* chains of majority and parity functions, the last gate refers back to the
+ * first input such that its delta needs more than one byte */
+template<class Ntk>
+static Ntk chains( uint32_t num_pis )
+{
+  Ntk ntk;
+  std::vector<signal<Ntk>> xs( num_pis );
+  std::generate( xs.begin(), xs.end(), [&]() { return ntk.create_pi(); } );
+
+  auto m = xs[0], p = xs[0];
+  for ( auto i = 1u; i + 1u < xs.size(); ++i )
+  {
+    m = ntk.create_maj( m, xs[i], !xs[i + 1u] );
+    p = ntk.create_xor( p, ntk.create_and( xs[i], m ) );
+    ntk.create_po( p );
+  }
+  ntk.create_po( !m );
+  ntk.create_po( ntk.create_and( ntk.create_or( m, p ), xs[0] ) );
+  ntk.create_po( ntk.get_constant( true ) );
+  return ntk;
+}
+
+TEST_CASE( "write AIG into binary AIGER and read it back", "[write_aiger]" )
+{
+  const auto aig = chains<aig_network>( 12u );
+
+  std::ostringstream out;
+  write_aiger( aig, out );
+
+  std::vector<char> buffer;
+  write_aiger( aig, buffer );
+  CHECK( std::string( buffer.begin(), buffer.end() ) == out.str() );
+  CHECK( out.str().substr( 0, 4u ) == "aig " );
+
+  aig_network aig2;
+  std::istringstream in( out.str() );
+  CHECK( lorina::read_aiger( in, aiger_reader( aig2 ) ) == lorina::return_code::success );
+
+  CHECK( aig2.num_pis() == aig.num_pis() );
+  CHECK( aig2.num_pos() == aig.num_pos() );
+  CHECK( aig2.num_gates() == aig.num_gates() );
+
+  default_simulator<kitty::dynamic_truth_table> sim( aig.num_pis() );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig2, sim ) == simulate<kitty::dynamic_truth_table>( aig, sim ) );
+}
+
+TEST_CASE( "write MIG into binary AIGER", "[write_aiger]" )
+{
+  const auto mig = chains<mig_network>( 8u );
+
+  std::ostringstream out;
+  write_aiger( mig, out );
+
+  aig_network aig;
+  std::istringstream in( out.str() );
+  CHECK( lorina::read_aiger( in, aiger_reader( aig ) ) == lorina::return_code::success );
+
+  default_simulator<kitty::dynamic_truth_table> sim( mig.num_pis() );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig, sim ) == simulate<kitty::dynamic_truth_table>( mig, sim ) );
+}
+
+TEST_CASE( "write sequential AIG with names into binary AIGER", "[write_aiger]" )
+{
+  names_view<aig_network> aig;
+  const auto a = aig.create_pi( "a" );
+  const auto b = aig.create_pi( "b" );
+  const auto s0 = aig.create_ro( "s0" );
+  const auto s1 = aig.create_ro();
+  const auto s2 = aig.create_ro();
+  aig.set_name( s0, "s0" );
+  aig.set_name( s2, "s2" );
+
+  aig.create_po( aig.create_xor( a, s0 ), "y0" );
+  aig.create_po( !s1 );
+  aig.create_ri( aig.create_and( a, b ), 0 );
+  aig.create_ri( !aig.create_or( s0, b ), 1 );
+  aig.create_ri( s1, -1 );
+
+  std::ostringstream out;
+  write_aiger( aig, out );
+
+  aig_network aig2;
+  NameMap<aig_network> names;
+  std::istringstream in( out.str() );
+  CHECK( lorina::read_aiger( in, aiger_reader( aig2, &names ) ) == lorina::return_code::success );
+
+  CHECK( aig2.num_pis() == 2u );
+  CHECK( aig2.num_pos() == 2u );
+  CHECK( aig2.num_latches() == 3u );
+  CHECK( aig2.num_gates() == aig.num_gates() );
+  CHECK( aig2.latch_reset( 0 ) == 0 );
+  CHECK( aig2.latch_reset( 1 ) == 1 );
+  CHECK( aig2.latch_reset( 2 ) == -1 );
+
+  CHECK( names.has_name( aig2.make_signal( aig2.pi_at( 0 ) ), "a" ) );
+  CHECK( names.has_name( aig2.make_signal( aig2.pi_at( 1 ) ), "b" ) );
+  CHECK( names.has_name( aig2.make_signal( aig2.ro_at( 0 ) ), "s0" ) );
+  CHECK( names.has_name( aig2.make_signal( aig2.ro_at( 2 ) ), "s2" ) );
+  CHECK( names.has_name( aig2.po_at( 0 ), "y0" ) );
+  CHECK( aig2.ri_at( 2 ) == aig2.make_signal( aig2.ro_at( 1 ) ) );
+  CHECK( aig2.po_at( 1 ) == !aig2.make_signal( aig2.ro_at( 1 ) ) );
+}
@@ -1,5 +1,7 @@
 #include <catch.hpp>
 
+#include <sstream>
+
 #include <mockturtle/generators/arithmetic.hpp>
 #include <mockturtle/io/write_bench.hpp>
 #include <mockturtle/networks/aig.hpp>
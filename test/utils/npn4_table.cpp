@@ -0,0 +1,30 @@
+#include <catch.hpp>
+
+#include <mockturtle/utils/npn4_table.hpp>
+#include <kitty/constructors.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/static_truth_table.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "NPN transforms of all 4-input functions", "[npn4_table]" )
+{
+  auto const& npn = npn4_transforms();
+
+  CHECK( npn.num_classes() == 222u );
+  CHECK( &npn == &npn4_transforms() );
+
+  for ( uint64_t func = 0u; func < ( 1u << 16 ); ++func )
+  {
+    kitty::static_truth_table<4> tt;
+    kitty::create_from_words( tt, &func, &func + 1 );
+
+    const auto config = kitty::exact_npn_canonization( tt );
+    const auto f = static_cast<uint16_t>( func );
+    auto const& perm = npn.perm( f );
+
+    CHECK( npn.representative( npn.class_index( f ) ) == *std::get<0>( config ).cbegin() );
+    CHECK( npn.phase( f ) == std::get<1>( config ) );
+    CHECK( std::equal( perm.begin(), perm.end(), std::get<2>( config ).begin() ) );
+  }
+}
@@ -0,0 +1,52 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/print.hpp>
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/utils/output_buffer.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "write integers and strings into output buffer", "[output_buffer]" )
+{
+  std::ostringstream os;
+  {
+    output_buffer out( os, 8u );
+    out << "n" << 0u << ' ' << 7 << ' ' << 42u << ' ' << 100ul << ' ' << -123 << ' ' << UINT64_MAX << ' ' << std::string( "end" );
+  }
+  CHECK( os.str() == "n0 7 42 100 -123 18446744073709551615 end" );
+
+  std::ostringstream os2;
+  output_buffer out2( os2 );
+  std::vector<uint32_t> values{3u, 14u, 159u};
+  out2.write_joined( values.begin(), values.end(), " , ", []( auto& out, auto v ) { out << 'n' << v; } );
+  out2.flush();
+  CHECK( os2.str() == "n3 , n14 , n159" );
+}
+
+TEST_CASE( "write truth tables into output buffer", "[output_buffer]" )
+{
+  for ( auto num_vars = 0u; num_vars <= 8u; ++num_vars )
+  {
+    kitty::dynamic_truth_table tt( num_vars );
+    kitty::create_random( tt, num_vars );
+
+    std::ostringstream os;
+    output_buffer out( os );
+    out.write_hex( tt );
+    out.flush();
+    CHECK( os.str() == kitty::to_hex( tt ) );
+  }
+
+  kitty::static_truth_table<3> maj;
+  kitty::create_majority( maj );
+  std::ostringstream os;
+  output_buffer( os ).write_hex( maj );
+  CHECK( os.str() == "e8" );
+}
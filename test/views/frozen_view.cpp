@@ -0,0 +1,122 @@
+#include <catch.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/views/fanout_view.hpp>
+#include <mockturtle/views/frozen_view.hpp>
+#include <mockturtle/views/topo_view.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "create frozen view on AIG", "[frozen_view]" )
+{
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto f = aig.create_and( a, b );
+  aig.create_po( f );
+
+  aig.set_value( aig.get_node( f ), 7u );
+  aig.set_visited( aig.get_node( f ), 3u );
+  const auto trav_id = aig.trav_id();
+
+  frozen_view frozen{aig};
+  CHECK( is_network_type_v<decltype( frozen )> );
+  CHECK( !has_create_and_v<decltype( frozen )> );
+  CHECK( !has_substitute_node_v<decltype( frozen )> );
+  CHECK( frozen.size() == aig.size() );
+  CHECK( frozen.value( aig.get_node( f ) ) == 0u );
+  CHECK( frozen.visited( aig.get_node( f ) ) == 0u );
+
+  frozen.set_value( aig.get_node( f ), 2u );
+  CHECK( frozen.incr_value( aig.get_node( f ) ) == 2u );
+  CHECK( frozen.decr_value( aig.get_node( f ) ) == 2u );
+  frozen.incr_trav_id();
+  frozen.set_visited( aig.get_node( a ), frozen.trav_id() );
+
+  /* copies own their side tables */
+  auto copy = frozen;
+  copy.set_value( aig.get_node( f ), 5u );
+  CHECK( copy.visited( aig.get_node( a ) ) == frozen.trav_id() );
+  CHECK( frozen.value( aig.get_node( f ) ) == 2u );
+
+  /* network is untouched */
+  CHECK( aig.value( aig.get_node( f ) ) == 7u );
+  CHECK( aig.visited( aig.get_node( f ) ) == 3u );
+  CHECK( aig.visited( aig.get_node( a ) ) == 0u );
+  CHECK( aig.trav_id() == trav_id );
+}
+
+TEST_CASE( "traverse frozen view from several threads", "[frozen_view]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> a( 8u ), b( 8u );
+  std::generate( a.begin(), a.end(), [&]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return aig.create_pi(); } );
+  auto carry = aig.get_constant( false );
+  carry_ripple_adder_inplace( aig, a, b, carry );
+  std::for_each( a.begin(), a.end(), [&]( auto f ) { aig.create_po( f ); } );
+  aig.create_po( carry );
+
+  default_simulator<kitty::dynamic_truth_table> sim( aig.num_pis() );
+  const auto expected_tts = simulate<kitty::dynamic_truth_table>( aig, sim );
+  const auto expected_cuts = cut_enumeration( aig ).total_cuts();
+  uint32_t expected_fanouts{0u};
+  aig.foreach_gate( [&]( auto const& n ) {
+    aig.foreach_fanin( n, [&]( auto const& f ) {
+      expected_fanouts += aig.is_pi( aig.get_node( f ) ) ? 0u : 1u;
+    } );
+  } );
+
+  const frozen_view<aig_network> frozen{aig};
+  std::vector<uint32_t> topo_sizes( 4u );
+  std::vector<uint32_t> cuts( 4u );
+  std::vector<uint8_t> same_tts( 4u );
+  std::vector<uint32_t> fanouts( 4u );
+
+  std::vector<std::thread> threads;
+  for ( auto i = 0u; i < 4u; ++i )
+  {
+    threads.emplace_back( [frozen, i, &topo_sizes, &cuts, &same_tts, &fanouts, &expected_tts]() {
+      for ( auto j = 0u; j < 10u; ++j )
+      {
+        topo_view topo{frozen};
+        topo_sizes[i] = topo.size();
+      }
+      cuts[i] = cut_enumeration( frozen ).total_cuts();
+
+      default_simulator<kitty::dynamic_truth_table> local_sim( frozen.num_pis() );
+      same_tts[i] = simulate<kitty::dynamic_truth_table>( frozen, local_sim ) == expected_tts;
+
+      fanout_view fanout{frozen};
+      fanout.foreach_gate( [&]( auto const& n ) {
+        fanout.foreach_fanout( n, [&]( auto const& ) { ++fanouts[i]; } );
+      } );
+    } );
+  }
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  for ( auto i = 0u; i < 4u; ++i )
+  {
+    CHECK( topo_sizes[i] == aig.size() );
+    CHECK( cuts[i] == expected_cuts );
+    CHECK( same_tts[i] );
+    CHECK( fanouts[i] == expected_fanouts );
+  }
+  CHECK( aig.events().on_add.empty() );
+  CHECK( aig.events().on_modified.empty() );
+  CHECK( aig.events().on_delete.empty() );
+  CHECK( simulate<kitty::dynamic_truth_table>( frozen, sim ) == expected_tts );
+  CHECK( aig.trav_id() == 0u );
+}
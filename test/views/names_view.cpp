@@ -99,3 +99,112 @@ TEST_CASE( "copy names", "[names_view]" )
   test_copy_names_view<xmg_network>();
   test_copy_names_view<klut_network>();
 }
+
+template<typename Ntk>
+void test_names_after_substitution()
+{
+  names_view<Ntk> named_ntk;
+  auto const a = named_ntk.create_pi( "a" );
+  auto const b = named_ntk.create_pi( "b" );
+  auto const c = named_ntk.create_pi( "c" );
+  auto const t1 = named_ntk.create_and( a, b );
+  auto const t2 = named_ntk.create_and( t1, c );
+  auto const t3 = named_ntk.create_or( b, c );
+  named_ntk.create_po( t2, "f" );
+  named_ntk.set_name( t1, "t1" );
+  named_ntk.set_name( t2, "t2" );
+  named_ntk.set_name( t3, "t3" );
+
+  /* names are replaced in place or moved to the end of the pool */
+  named_ntk.set_name( t1, "x" );
+  CHECK( named_ntk.get_name( t1 ) == "x" );
+  named_ntk.set_name( t1, "a_longer_name" );
+  CHECK( named_ntk.get_name( t1 ) == "a_longer_name" );
+  CHECK( named_ntk.get_name( a ) == "a" );
+
+  /* the name of the substituted node moves to the new signal */
+  named_ntk.substitute_node( named_ntk.get_node( t1 ), a );
+  CHECK( named_ntk.get_name( a ) == "a" );
+  if constexpr ( has_is_dead_v<Ntk> )
+  {
+    /* names of deleted nodes are removed */
+    CHECK( !named_ntk.has_name( t1 ) );
+  }
+
+  named_ntk.substitute_node( named_ntk.get_node( t2 ), t3 );
+  CHECK( named_ntk.get_name( t3 ) == "t3" );
+  if constexpr ( has_is_dead_v<Ntk> )
+  {
+    /* names of deleted nodes are removed */
+    CHECK( !named_ntk.has_name( t2 ) );
+  }
+  CHECK( named_ntk.get_output_name( 0 ) == "f" );
+
+  auto const t4 = named_ntk.create_and( a, c );
+  named_ntk.set_name( t4, "t4" );
+  named_ntk.substitute_node( named_ntk.get_node( t4 ), b );
+  CHECK( named_ntk.get_name( b ) == "b" );
+
+  auto const t5 = named_ntk.create_and( b, c );
+  named_ntk.set_name( t5, "t5" );
+  auto const t6 = named_ntk.create_and( a, t3 );
+  named_ntk.substitute_node( named_ntk.get_node( t5 ), t6 );
+  CHECK( named_ntk.get_name( t6 ) == "t5" );
+}
+
+TEST_CASE( "names after substitution", "[names_view]" )
+{
+  test_names_after_substitution<aig_network>();
+  test_names_after_substitution<mig_network>();
+  test_names_after_substitution<xag_network>();
+  test_names_after_substitution<xmg_network>();
+  test_names_after_substitution<klut_network>();
+}
+
+TEST_CASE( "many names and complemented signals", "[names_view]" )
+{
+  names_view<aig_network> aig;
+  std::vector<aig_network::signal> pis;
+  for ( auto i = 0u; i < 1000u; ++i )
+  {
+    pis.push_back( aig.create_pi( "pi" + std::to_string( i ) ) );
+  }
+  for ( auto round = 0u; round < 10u; ++round )
+  {
+    for ( auto i = 0u; i < pis.size(); ++i )
+    {
+      aig.set_name( !pis[i], "not_pi" + std::to_string( i ) + "_" + std::to_string( round ) );
+    }
+  }
+  for ( auto i = 0u; i < pis.size(); ++i )
+  {
+    CHECK( aig.get_name( pis[i] ) == "pi" + std::to_string( i ) );
+    CHECK( aig.get_name( !pis[i] ) == "not_pi" + std::to_string( i ) + "_9" );
+  }
+  CHECK_THROWS( aig.get_name( aig.get_constant( false ) ) );
+}
+
+TEST_CASE( "names views remove their events", "[names_view]" )
+{
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto f = aig.create_and( a, b );
+  aig.create_po( f );
+
+  {
+    names_view named_ntk{aig};
+    named_ntk.set_name( f, "f" );
+    CHECK( aig.events().on_delete.size() == 1u );
+
+    names_view<aig_network> copy{named_ntk};
+    CHECK( aig.events().on_delete.size() == 2u );
+    copy = named_ntk;
+    CHECK( aig.events().on_delete.size() == 2u );
+  }
+  CHECK( aig.events().on_delete.empty() );
+
+  /* deleting a node does not call into a destroyed view */
+  aig.substitute_node( aig.get_node( f ), a );
+  CHECK( aig.is_dead( aig.get_node( f ) ) );
+}
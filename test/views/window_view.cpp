@@ -49,4 +49,45 @@ TEST_CASE( "create window view on AIG", "[window_view]" )
   CHECK( win3.size() == 7 );
   CHECK( win3.num_pis() == 2 );
   CHECK( win3.num_pos() == 1 ); // f4
+
+  win3.foreach_pi( [&]( auto const& n ) {
+    CHECK( win3.is_pi( n ) );
+  } );
+  win3.foreach_gate( [&]( auto const& n ) {
+    CHECK( !win3.is_pi( n ) );
+  } );
+  CHECK( !win3.is_pi( aig.get_node( aig.get_constant( false ) ) ) );
+}
+
+TEST_CASE( "extend window view on AIG", "[window_view]" )
+{
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  const auto f1 = aig.create_and( a, b );
+  const auto f2 = aig.create_and( f1, c );
+  const auto f3 = aig.create_and( f2, a );
+  const auto f4 = aig.create_and( f3, b );
+  const auto f5 = aig.create_and( f4, !c );
+  aig.create_po( f3 );
+  aig.create_po( f5 );
+
+  fanout_view<aig_network> fanout_ntk( aig );
+  fanout_ntk.clear_visited();
+
+  /* extension adds f2, ..., f5 over several rounds */
+  std::vector<node<aig_network>> leaves{aig.get_node( a ), aig.get_node( b ), aig.get_node( c )};
+  window_view<fanout_view<aig_network>> win( fanout_ntk, leaves, {aig.get_node( f1 )}, true );
+  CHECK( win.size() == 9 );
+  CHECK( win.num_pis() == 3 );
+  CHECK( win.num_gates() == 5 );
+  CHECK( win.num_pos() == 2 ); // f3, f5
+
+  std::vector<signal<aig_network>> roots;
+  win.foreach_po( [&]( auto const& f ) { roots.push_back( f ); } );
+  CHECK( roots == std::vector<signal<aig_network>>{f3, f5} );
+
+  CHECK( win.is_pi( aig.get_node( a ) ) );
+  CHECK( !win.is_pi( aig.get_node( f4 ) ) );
 }